@@ -0,0 +1,249 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file bench-brem-rel.cc
+//! Compare the rate of sampling bremsstrahlung photon energies from tables
+//! against rejection sampling of the differential cross section
+//---------------------------------------------------------------------------//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "base/Stopwatch.hh"
+#include "physics/base/ParticleParams.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "physics/base/SecondaryAllocatorPointers.hh"
+#include "physics/base/SecondaryAllocatorView.hh"
+#include "physics/em/BremRelDXsCalculator.hh"
+#include "physics/em/BremRelInteractor.hh"
+#include "physics/em/BremRelParams.hh"
+#include "physics/material/ElementView.hh"
+#include "physics/material/MaterialParams.hh"
+#include "random/distributions/GenerateCanonical.hh"
+
+using namespace celeritas;
+using std::cerr;
+using std::cout;
+using std::endl;
+
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Host-side data needed to sample an interaction.
+ */
+struct BenchData
+{
+    BremRelInteractorPointers shared;
+    BremRelParamsPointers     brem;
+    MaterialParamsPointers    materials;
+    ParticleParamsPointers    particles;
+    units::MevEnergy          gamma_cut;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the photon energy with the tabulated interactor.
+ */
+real_type run_table(const BenchData&              data,
+                    const std::vector<real_type>& energies,
+                    ElementDefId                  el_id)
+{
+    ParticleTrackState    particle_state;
+    ParticleStatePointers particle_states;
+    particle_states.vars  = {&particle_state, 1};
+    particle_state.def_id = data.shared.electron_id;
+
+    const Real3 direction = {0, 0, 1};
+
+    std::vector<SecondaryRecord> storage(energies.size());
+    SecondaryAllocatorPointers   secondary_ptrs;
+    ull_int                      secondary_size = 0;
+    secondary_ptrs.storage = make_span(storage);
+    secondary_ptrs.size    = &secondary_size;
+    SecondaryAllocatorView allocate(secondary_ptrs);
+
+    std::mt19937 rng(12345u);
+    real_type    gamma_energy = 0;
+
+    Stopwatch get_time;
+    for (real_type energy : energies)
+    {
+        particle_state.energy = units::MevEnergy{energy};
+        ParticleTrackView particle(
+            data.particles, particle_states, ThreadId{0});
+
+        BremRelInteractor interact(data.shared,
+                                   data.brem,
+                                   el_id,
+                                   data.gamma_cut,
+                                   particle,
+                                   direction,
+                                   allocate);
+        Interaction       result = interact(rng);
+        gamma_energy += Secondary(result.secondaries.front()).energy.value();
+    }
+    real_type time = get_time();
+
+    // Use the result so the loop can't be optimized away
+    if (!(gamma_energy > 0))
+    {
+        cerr << "No photons were emitted" << endl;
+    }
+    return time;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the photon energy by rejection on the differential cross section.
+ *
+ * The proposal is uniform in \f$ \ln k \f$ between the cut and the kinetic
+ * energy, and the majorant is the largest \f$ k\,d\sigma/dk \f$ on a coarse
+ * grid with a safety margin. This is representative of the per-secondary
+ * cost of evaluating the screening functions in a rejection loop.
+ */
+real_type run_rejection(const BenchData&              data,
+                        const std::vector<real_type>& energies,
+                        ElementDefId                  el_id)
+{
+    const ElementView element(data.materials, el_id);
+    const real_type   cut = data.gamma_cut.value();
+
+    std::mt19937 rng(12345u);
+    real_type    gamma_energy = 0;
+    ull_int      num_trials   = 0;
+
+    Stopwatch get_time;
+    for (real_type energy : energies)
+    {
+        BremRelDXsCalculator calc_dxs(element, units::MevEnergy{energy});
+        const real_type      log_range = std::log(energy / cut);
+
+        real_type dxs_max = 0;
+        for (int i = 0; i <= 8; ++i)
+        {
+            const real_type k = cut * std::exp(i * log_range / 8);
+            dxs_max = std::max(dxs_max,
+                               calc_dxs(units::MevEnergy{std::min(k, energy)}));
+        }
+        dxs_max *= 1.1;
+
+        real_type k;
+        do
+        {
+            k = std::min(cut * std::exp(generate_canonical(rng) * log_range),
+                         energy);
+            ++num_trials;
+        } while (generate_canonical(rng) * dxs_max
+                 > calc_dxs(units::MevEnergy{k}));
+        gamma_energy += k;
+    }
+    real_type time = get_time();
+
+    if (!(gamma_energy > 0) || num_trials < energies.size())
+    {
+        cerr << "No photons were emitted" << endl;
+    }
+    return time;
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute and run.
+ */
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> args(argv, argv + argc);
+    if (args.size() > 2 || (args.size() == 2 && args[1][0] == '-'))
+    {
+        cerr << "usage: " << args[0] << " [num_samples]" << endl;
+        return EXIT_FAILURE;
+    }
+
+    size_type num_samples = 1 << 20;
+    if (args.size() == 2)
+    {
+        num_samples = std::stoul(args[1]);
+    }
+
+    // Lead tungstate: a dense, high-Z scintillator
+    MaterialParams::Input mi;
+    mi.elements  = {{82, units::AmuMass{207.2}, "Pb"},
+                   {74, units::AmuMass{183.84}, "W"},
+                   {8, units::AmuMass{15.999}, "O"}};
+    mi.materials = {{6 * 1.84e22,
+                     293.,
+                     MatterState::solid,
+                     {{ElementDefId{0}, 1. / 6},
+                      {ElementDefId{1}, 1. / 6},
+                      {ElementDefId{2}, 4. / 6}},
+                     "PbWO4"}};
+    MaterialParams materials(mi);
+
+    ParticleParams particles(
+        {{"electron",
+          pdg::electron(),
+          units::MevMass{0.5109989461},
+          units::ElementaryCharge{-1},
+          ParticleDef::stable_decay_constant()},
+         {"gamma",
+          pdg::gamma(),
+          zero_quantity(),
+          zero_quantity(),
+          ParticleDef::stable_decay_constant()}});
+
+    // Ten points per decade from 1 GeV to 1 TeV
+    BremRelParams::Input bi;
+    bi.log_energy = {31, std::log(1e3), std::log(10.) / 10};
+    Stopwatch     get_setup_time;
+    BremRelParams brem(materials, bi);
+    real_type     setup_time = get_setup_time();
+
+    BenchData data;
+    data.shared.electron_id = particles.find(pdg::electron());
+    data.shared.gamma_id    = particles.find(pdg::gamma());
+    data.brem               = brem.host_pointers();
+    data.materials          = materials.host_pointers();
+    data.particles          = particles.host_pointers();
+    data.gamma_cut          = units::MevEnergy{0.1};
+
+    cout << "Table setup time: " << std::setprecision(4) << setup_time
+         << " s\n"
+         << "Time [s] for " << num_samples
+         << " samples off Pb with a 100 keV cut\n"
+         << std::setw(12) << "energy" << std::setw(14) << "rejection"
+         << std::setw(14) << "table" << std::setw(10) << "speedup"
+         << std::setw(14) << "table [1/s]" << endl;
+
+    // Log-uniform incident energies in each decade from 1 GeV to 1 TeV
+    std::mt19937 rng(54321u);
+    for (real_type emin : {1e3, 1e4, 1e5})
+    {
+        std::uniform_real_distribution<real_type> sample_loge(
+            std::log(emin), std::log(10 * emin));
+        std::vector<real_type> energies(num_samples);
+        for (real_type& e : energies)
+        {
+            e = std::exp(sample_loge(rng));
+        }
+
+        real_type reject_time = run_rejection(data, energies, ElementDefId{0});
+        real_type table_time  = run_table(data, energies, ElementDefId{0});
+        cout << std::setw(12) << std::scientific << std::setprecision(0)
+             << emin << std::setw(14) << std::fixed << std::setprecision(4)
+             << reject_time << std::setw(14) << table_time << std::setw(10)
+             << std::setprecision(2) << reject_time / table_time
+             << std::setw(14) << std::scientific << std::setprecision(3)
+             << num_samples / table_time << endl;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,131 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file bench-livermore-load.cc
+//! Compare load time and memory of Livermore data for a whole library
+//! against only the elements used by the problem materials
+//---------------------------------------------------------------------------//
+
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "base/Assert.hh"
+#include "base/Constants.hh"
+#include "base/Range.hh"
+#include "base/Stopwatch.hh"
+#include "io/LivermoreParamsBuilder.hh"
+#include "io/LivermoreParamsReader.hh"
+#include "physics/em/LivermoreParams.hh"
+#include "physics/material/MaterialParams.hh"
+
+using namespace celeritas;
+using std::cerr;
+using std::cout;
+using std::endl;
+
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Time the loading of Livermore data and print the resulting storage size.
+ */
+void run(const std::string&                              label,
+         const std::function<LivermoreParams::Input()>& load)
+{
+    cout << std::setw(24) << std::left << label << std::right;
+    try
+    {
+        Stopwatch              get_time;
+        LivermoreParams::Input inp  = load();
+        real_type              time = get_time();
+
+        // Storage of the processed data, as copied to the device
+        LivermoreParams livermore(inp);
+        size_type       num_bytes = livermore.make_image().size();
+
+        cout << std::setw(10) << inp.elements.size() << std::setw(12)
+             << std::fixed << std::setprecision(4) << time << std::setw(14)
+             << std::setprecision(1) << num_bytes / 1024.0 << endl;
+    }
+    catch (const RuntimeError& e)
+    {
+        cout << "  failed: " << e.what() << endl;
+    }
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute and run.
+ */
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> args(argv, argv + argc);
+    if (args.size() < 2 || args[1][0] == '-')
+    {
+        cerr << "usage: " << args[0] << " livermore_data_dir [Z ...]" << endl;
+        return EXIT_FAILURE;
+    }
+
+    // Elements in the problem: default to lead tungstate
+    std::vector<int> atomic_numbers;
+    for (auto i : range<size_type>(2, args.size()))
+    {
+        atomic_numbers.push_back(std::stoi(args[i]));
+    }
+    if (atomic_numbers.empty())
+    {
+        atomic_numbers = {82, 74, 8};
+    }
+
+    // One material per element; the masses don't affect the data loading
+    MaterialParams::Input mi;
+    for (auto i : range<unsigned int>(atomic_numbers.size()))
+    {
+        int z = atomic_numbers[i];
+        mi.elements.push_back(
+            {z, units::AmuMass{2.0 * z}, "Z" + std::to_string(z)});
+        mi.materials.push_back({constants::na_avogadro,
+                                293.,
+                                MatterState::solid,
+                                {{ElementDefId{i}, 1.0}},
+                                "mat" + std::to_string(i)});
+    }
+    MaterialParams materials(mi);
+
+    LivermoreParamsReader read_element(args[1].c_str());
+
+    cout << std::setw(24) << std::left << "method" << std::right
+         << std::setw(10) << "elements" << std::setw(12) << "time [s]"
+         << std::setw(14) << "size [kB]" << endl;
+
+    run("all elements, serial", [&read_element]() {
+        LivermoreParams::Input result;
+        for (int z : range(1, 101))
+        {
+            result.elements.push_back(read_element(z));
+        }
+        return result;
+    });
+
+    run("problem, serial", [&read_element, &atomic_numbers]() {
+        LivermoreParams::Input result;
+        for (int z : atomic_numbers)
+        {
+            result.elements.push_back(read_element(z));
+        }
+        return result;
+    });
+
+    run("problem, builder", [&read_element, &materials]() {
+        LivermoreParamsBuilder build_livermore(read_element);
+        return build_livermore(materials);
+    });
+
+    return EXIT_SUCCESS;
+}
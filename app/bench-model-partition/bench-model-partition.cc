@@ -0,0 +1,164 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file bench-model-partition.cc
+//! Compare per-model passes over all tracks against partitioned launches
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "base/Stopwatch.hh"
+#include "physics/base/ModelPartition.hh"
+
+using namespace celeritas;
+using std::cerr;
+using std::cout;
+using std::endl;
+
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Stand-in for an interaction kernel applied to a single track.
+ */
+inline void mock_interact(ModelId id, real_type* value)
+{
+    real_type x = *value;
+    for (unsigned int i = 0; i != 8; ++i)
+    {
+        x = std::sqrt(x * x + id.get() + 1) * real_type(0.5);
+    }
+    *value = x;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Launch every model over every track; models skip tracks they don't own.
+ */
+void interact_masked(const PhysicsStatePointers& states,
+                     size_type                   num_models,
+                     std::vector<real_type>*     values)
+{
+    for (size_type m = 0; m != num_models; ++m)
+    {
+        const ModelId model_id{static_cast<ModelId::value_type>(m)};
+        for (size_type slot = 0; slot != states.size(); ++slot)
+        {
+            if (states.state[slot].model_id != model_id)
+                continue;
+            mock_interact(model_id, &(*values)[slot]);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Partition the tracks by model and launch each model over only its range.
+ */
+void interact_partitioned(const PhysicsStatePointers&   states,
+                          size_type                     num_models,
+                          const ModelPartitionPointers& partition,
+                          std::vector<real_type>*       values)
+{
+    partition_by_model(states, partition);
+
+    for (size_type m = 0; m != num_models; ++m)
+    {
+        const ModelId model_id{static_cast<ModelId::value_type>(m)};
+        for (auto i = partition.offsets[m]; i != partition.offsets[m + 1]; ++i)
+        {
+            mock_interact(model_id, &(*values)[partition.track_order[i]]);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Time both strategies with the given number of active models.
+ */
+void run(size_type num_tracks, size_type num_models, unsigned int num_repeats)
+{
+    // Select a model uniformly for each track; a tenth do not interact
+    std::mt19937                rng(12345u);
+    std::bernoulli_distribution interacts(0.9);
+    std::uniform_int_distribution<ModelId::value_type> sample_model(
+        0, static_cast<ModelId::value_type>(num_models - 1));
+
+    std::vector<PhysicsTrackState> states(num_tracks);
+    for (PhysicsTrackState& state : states)
+    {
+        if (interacts(rng))
+        {
+            state.model_id = ModelId{sample_model(rng)};
+        }
+    }
+
+    PhysicsStatePointers state_ptrs;
+    state_ptrs.state = make_span(states);
+
+    std::vector<real_type>  values(num_tracks, 1);
+    std::vector<index_type> track_order(num_tracks);
+    std::vector<index_type> offsets(num_models + 1);
+    ModelPartitionPointers  partition;
+    partition.track_order = make_span(track_order);
+    partition.offsets     = make_span(offsets);
+
+    Stopwatch get_time;
+    for (unsigned int r = 0; r != num_repeats; ++r)
+    {
+        interact_masked(state_ptrs, num_models, &values);
+    }
+    real_type masked_time = get_time() / num_repeats;
+
+    get_time = {};
+    for (unsigned int r = 0; r != num_repeats; ++r)
+    {
+        interact_partitioned(state_ptrs, num_models, partition, &values);
+    }
+    real_type partitioned_time = get_time() / num_repeats;
+
+    // Throughput in millions of tracks per second
+    cout << std::setw(8) << num_models << std::setw(14) << std::fixed
+         << std::setprecision(2) << 1e-6 * num_tracks / masked_time
+         << std::setw(14) << 1e-6 * num_tracks / partitioned_time
+         << std::setw(10) << masked_time / partitioned_time << endl;
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute and run.
+ */
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> args(argv, argv + argc);
+    if (args.size() > 2 || (args.size() == 2 && args[1][0] == '-'))
+    {
+        cerr << "usage: " << args[0] << " [num_tracks]" << endl;
+        return EXIT_FAILURE;
+    }
+
+    size_type num_tracks = 1 << 20;
+    if (args.size() == 2)
+    {
+        num_tracks = std::stoul(args[1]);
+    }
+
+    cout << "Throughput [Mtrack/s] for " << num_tracks << " tracks\n"
+         << std::setw(8) << "models" << std::setw(14) << "masked"
+         << std::setw(14) << "partitioned" << std::setw(10) << "speedup"
+         << endl;
+    for (size_type num_models : {1, 2, 4, 8, 16, 32})
+    {
+        run(num_tracks, num_models, 5);
+    }
+
+    return EXIT_SUCCESS;
+}
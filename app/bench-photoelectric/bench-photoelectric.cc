@@ -0,0 +1,217 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file bench-photoelectric.cc
+//! Compare recalculating the photoelectric element cross section in the
+//! interactor against reusing the value from element selection
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "base/Constants.hh"
+#include "base/Stopwatch.hh"
+#include "io/LivermoreParamsBuilder.hh"
+#include "io/LivermoreParamsReader.hh"
+#include "physics/base/ParticleParams.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "physics/base/SecondaryAllocatorPointers.hh"
+#include "physics/base/SecondaryAllocatorView.hh"
+#include "physics/em/LivermoreParams.hh"
+#include "physics/em/PhotoelectricInteractor.hh"
+#include "physics/material/ElementSelector.hh"
+#include "physics/material/MaterialParams.hh"
+#include "physics/material/MaterialView.hh"
+
+using namespace celeritas;
+using std::cerr;
+using std::cout;
+using std::endl;
+
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Host-side data needed to select an element and sample an interaction.
+ */
+struct BenchData
+{
+    PhotoelectricInteractorPointers shared;
+    LivermoreParamsPointers         livermore;
+    MaterialParamsPointers          materials;
+    ParticleParamsPointers          particles;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Select an element and sample the interaction for every incident energy.
+ *
+ * If \c cached is true, the selected element's cross section is passed to the
+ * interactor; otherwise the interactor recalculates it.
+ */
+real_type run(const BenchData&              data,
+              const std::vector<real_type>& energies,
+              bool                          cached)
+{
+    ParticleTrackState    particle_state;
+    ParticleStatePointers particle_states;
+    particle_states.vars  = {&particle_state, 1};
+    particle_state.def_id = data.shared.gamma_id;
+
+    const Real3  direction = {0, 0, 1};
+    MaterialView material(data.materials, MaterialDefId{0});
+
+    std::vector<SecondaryRecord> storage(energies.size());
+    SecondaryAllocatorPointers   secondary_ptrs;
+    ull_int                      secondary_size = 0;
+    secondary_ptrs.storage = make_span(storage);
+    secondary_ptrs.size    = &secondary_size;
+    SecondaryAllocatorView allocate(secondary_ptrs);
+
+    std::vector<real_type> micro_xs_storage(material.num_elements());
+    std::mt19937           rng(12345u);
+    real_type              energy_deposition = 0;
+
+    Stopwatch get_time;
+    for (real_type energy : energies)
+    {
+        particle_state.energy = units::MevEnergy{energy};
+        ParticleTrackView particle(
+            data.particles, particle_states, ThreadId{0});
+
+        PhotoelectricMicroXsCalculator calc_micro_xs(
+            data.shared, data.livermore, particle);
+        ElementSelector select_element(
+            material, calc_micro_xs, make_span(micro_xs_storage));
+        ElementComponentId comp_id = select_element(rng);
+        ElementDefId el_id = material.elements()[comp_id.get()].element;
+
+        Interaction result;
+        if (cached)
+        {
+            PhotoelectricInteractor interact(
+                data.shared,
+                data.livermore,
+                el_id,
+                select_element.elemental_micro_xs()[comp_id.get()],
+                particle,
+                direction,
+                allocate);
+            result = interact(rng);
+        }
+        else
+        {
+            PhotoelectricInteractor interact(data.shared,
+                                             data.livermore,
+                                             el_id,
+                                             particle,
+                                             direction,
+                                             allocate);
+            result = interact(rng);
+        }
+        energy_deposition += result.energy_deposition.value();
+    }
+    real_type time = get_time();
+
+    // Use the result so the loop can't be optimized away
+    if (!(energy_deposition > 0))
+    {
+        cerr << "No energy was deposited" << endl;
+    }
+    return time;
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute and run.
+ */
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> args(argv, argv + argc);
+    if (args.size() < 2 || args.size() > 3 || args[1][0] == '-')
+    {
+        cerr << "usage: " << args[0] << " livermore_data_dir [num_samples]"
+             << endl;
+        return EXIT_FAILURE;
+    }
+
+    size_type num_samples = 1 << 20;
+    if (args.size() == 3)
+    {
+        num_samples = std::stoul(args[2]);
+    }
+
+    // Lead tungstate: a dense, high-Z scintillator
+    MaterialParams::Input mi;
+    mi.elements  = {{82, units::AmuMass{207.2}, "Pb"},
+                   {74, units::AmuMass{183.84}, "W"},
+                   {8, units::AmuMass{15.999}, "O"}};
+    mi.materials = {{6 * 1.84e22,
+                     293.,
+                     MatterState::solid,
+                     {{ElementDefId{0}, 1. / 6},
+                      {ElementDefId{1}, 1. / 6},
+                      {ElementDefId{2}, 4. / 6}},
+                     "PbWO4"}};
+    MaterialParams materials(mi);
+
+    // Load Livermore data for the material elements
+    LivermoreParamsBuilder build_livermore(
+        LivermoreParamsReader(args[1].c_str()));
+    LivermoreParams livermore(build_livermore(materials));
+
+    ParticleParams particles(
+        {{"electron",
+          pdg::electron(),
+          units::MevMass{0.5109989461},
+          units::ElementaryCharge{-1},
+          ParticleDef::stable_decay_constant()},
+         {"gamma",
+          pdg::gamma(),
+          zero_quantity(),
+          zero_quantity(),
+          ParticleDef::stable_decay_constant()}});
+
+    BenchData data;
+    data.shared.electron_id = particles.find(pdg::electron());
+    data.shared.gamma_id    = particles.find(pdg::gamma());
+    data.shared.inv_electron_mass
+        = 1 / particles.get(data.shared.electron_id).mass.value();
+    data.livermore = livermore.host_pointers();
+    data.materials = materials.host_pointers();
+    data.particles = particles.host_pointers();
+
+    cout << "Time [s] for " << num_samples << " samples in PbWO4\n"
+         << std::setw(12) << "energy" << std::setw(14) << "recalculated"
+         << std::setw(14) << "cached" << std::setw(10) << "speedup"
+         << endl;
+
+    // Log-uniform incident energies in each decade from 1 keV to 10 MeV
+    std::mt19937 rng(54321u);
+    for (real_type emin : {1e-3, 1e-2, 1e-1, 1.})
+    {
+        std::uniform_real_distribution<real_type> sample_loge(
+            std::log(emin), std::log(10 * emin));
+        std::vector<real_type> energies(num_samples);
+        for (real_type& e : energies)
+        {
+            e = std::exp(sample_loge(rng));
+        }
+
+        real_type recalc_time = run(data, energies, false);
+        real_type cached_time = run(data, energies, true);
+        cout << std::setw(12) << std::scientific << std::setprecision(0)
+             << emin << std::setw(14) << std::fixed << std::setprecision(4)
+             << recalc_time << std::setw(14) << cached_time << std::setw(10)
+             << std::setprecision(2) << recalc_time / cached_time << endl;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -15,7 +15,7 @@
 #include "random/distributions/ExponentialDistribution.hh"
 #include "physics/base/ParticleTrackView.hh"
 #include "physics/base/Units.hh"
-#include "physics/base/Secondary.hh"
+#include "physics/base/PackedSecondary.hh"
 #include "physics/base/SecondaryAllocatorView.hh"
 #include "physics/em/detail/KleinNishinaInteractor.hh"
 #include "PhysicsArrayCalculator.hh"
@@ -79,7 +79,7 @@ auto HostKNDemoRunner::operator()(demo_interactor::KNDemoRunArgs args)
     PhysicsArrayCalculator calc_xs(xs_host_ptrs);
 
     // Make secondary store
-    HostStackAllocatorStore<Secondary> secondaries(args.max_steps);
+    HostStackAllocatorStore<SecondaryRecord> secondaries(args.max_steps);
     auto secondary_host_ptrs = secondaries.host_pointers();
 
     // Make detector store
@@ -164,9 +164,9 @@ auto HostKNDemoRunner::operator()(demo_interactor::KNDemoRunArgs args)
 
             // Deposit energy from the secondary (all local)
             {
-                const auto& secondary = interaction.secondaries.front();
-                h.dir                 = secondary.direction;
-                h.energy_deposited    = secondary.energy;
+                const Secondary secondary(interaction.secondaries.front());
+                h.dir              = secondary.direction;
+                h.energy_deposited = secondary.energy;
                 detector_hit(h);
             }
 
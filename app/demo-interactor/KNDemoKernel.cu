@@ -7,10 +7,10 @@
 //---------------------------------------------------------------------------//
 #include "KNDemoKernel.hh"
 
-#include <thrust/device_ptr.h>
-#include <thrust/reduce.h>
 #include "base/ArrayUtils.hh"
 #include "base/Assert.hh"
+#include "base/BitMaskAlgorithms.hh"
+#include "base/BitMaskView.hh"
 #include "physics/base/ParticleTrackView.hh"
 #include "physics/base/SecondaryAllocatorView.hh"
 #include "physics/em/detail/KleinNishinaInteractor.hh"
@@ -38,6 +38,8 @@ __global__ void initialize_kn(ParamPointers const   params,
                               StatePointers const   states,
                               InitialPointers const init)
 {
+    BitMaskView alive(states.alive);
+
     // Grid-stride loop, see
     for (int tid = blockIdx.x * blockDim.x + threadIdx.x;
          tid < static_cast<int>(states.size());
@@ -51,7 +53,7 @@ __global__ void initialize_kn(ParamPointers const   params,
         states.direction[tid] = {0, 0, 1};
         states.position[tid]  = {0, 0, 0};
         states.time[tid]      = 0;
-        states.alive[tid]     = true;
+        alive.set(tid);
     }
 }
 
@@ -74,13 +76,14 @@ __global__ void iterate_kn(ParamPointers const              params,
     SecondaryAllocatorView allocate_secondaries(secondaries);
     DetectorView           detector_hit(detector);
     PhysicsArrayCalculator calc_xs(params.xs);
+    BitMaskView            alive(states.alive);
 
     for (int tid = blockIdx.x * blockDim.x + threadIdx.x;
          tid < static_cast<int>(states.size());
          tid += blockDim.x * gridDim.x)
     {
         // Skip loop if already dead
-        if (!states.alive[tid])
+        if (!alive.test(tid))
         {
             continue;
         }
@@ -116,7 +119,7 @@ __global__ void iterate_kn(ParamPointers const              params,
 
             // Deposit energy and kill
             detector_hit(h);
-            states.alive[tid] = false;
+            alive.reset(tid);
             continue;
         }
 
@@ -134,9 +137,9 @@ __global__ void iterate_kn(ParamPointers const              params,
         // Deposit energy from the secondary (effectively, an infinite energy
         // cutoff)
         {
-            const auto& secondary = interaction.secondaries.front();
-            h.dir                 = secondary.direction;
-            h.energy_deposited    = secondary.energy;
+            const Secondary secondary(interaction.secondaries.front());
+            h.dir              = secondary.direction;
+            h.energy_deposited = secondary.energy;
             detector_hit(h);
         }
 
@@ -157,7 +160,7 @@ void initialize(const CudaGridParams&  grid,
                 const StatePointers&   states,
                 const InitialPointers& initial)
 {
-    REQUIRE(states.alive.size() == states.size());
+    REQUIRE(states.alive.size == states.size());
     REQUIRE(states.rng.size() == states.size());
     initialize_kn<<<grid.grid_size, grid.block_size>>>(params, states, initial);
 }
@@ -184,16 +187,9 @@ void iterate(const CudaGridParams&              grid,
 /*!
  * Sum the total number of living particles.
  */
-size_type reduce_alive(Span<bool> alive)
+size_type reduce_alive(const BitMaskPointers& alive)
 {
-    size_type result = thrust::reduce(
-        thrust::device_pointer_cast(alive.data()),
-        thrust::device_pointer_cast(alive.data() + alive.size()),
-        size_type(0),
-        thrust::plus<size_type>());
-
-    CELER_CUDA_CALL(cudaDeviceSynchronize());
-    return result;
+    return device_count_set(alive);
 }
 
 //---------------------------------------------------------------------------//
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "base/BitMaskPointers.hh"
 #include "base/Span.hh"
 #include "base/Types.hh"
 #include "physics/base/ParticleParamsPointers.hh"
@@ -54,12 +55,12 @@ struct StatePointers
     celeritas::Span<celeritas::Real3>     position;
     celeritas::Span<celeritas::Real3>     direction;
     celeritas::Span<celeritas::real_type> time;
-    celeritas::Span<bool>                 alive;
+    celeritas::BitMaskPointers            alive;
 
     explicit CELER_FUNCTION operator bool() const
     {
         return particle && rng && !position.empty() && !direction.empty()
-               && !time.empty() && !alive.empty();
+               && !time.empty() && alive;
     }
 
     //! Number of tracks
@@ -86,7 +87,7 @@ void iterate(const CudaGridParams&                        grid,
 
 //---------------------------------------------------------------------------//
 // Sum the total number of living particles
-celeritas::size_type reduce_alive(celeritas::Span<bool> alive);
+celeritas::size_type reduce_alive(const celeritas::BitMaskPointers& alive);
 
 //---------------------------------------------------------------------------//
 } // namespace demo_interactor
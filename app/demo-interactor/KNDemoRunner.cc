@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "KNDemoRunner.hh"
 
+#include "base/Memory.hh"
 #include "base/Range.hh"
 #include "base/Stopwatch.hh"
 #include "random/cuda/RngStateStore.hh"
@@ -70,7 +71,8 @@ auto KNDemoRunner::operator()(KNDemoRunArgs args) -> result_type
     DeviceVector<Real3>     position(args.num_tracks);
     DeviceVector<Real3>     direction(args.num_tracks);
     DeviceVector<double>    time(args.num_tracks);
-    DeviceVector<bool>      alive(args.num_tracks);
+    DeviceVector<BitMaskPointers::word_type> alive(
+        BitMaskPointers::num_words(args.num_tracks));
     DetectorStore           detector(args.num_tracks, args.tally_grid);
 
     // Construct pointers to device data
@@ -89,7 +91,10 @@ auto KNDemoRunner::operator()(KNDemoRunArgs args) -> result_type
     state.position  = position.device_pointers();
     state.direction = direction.device_pointers();
     state.time      = time.device_pointers();
-    state.alive     = alive.device_pointers();
+    state.alive     = {alive.device_pointers(), args.num_tracks};
+
+    // Alive flags are set during initialization
+    device_memset_zero(alive.device_pointers());
 
     // Initialize particle states
     initialize(launch_params_, params, state, initial);
@@ -117,7 +122,7 @@ auto KNDemoRunner::operator()(KNDemoRunArgs args) -> result_type
         detector.bin_buffer();
 
         // Calculate and save number of living particles
-        result.alive.push_back(reduce_alive(alive.device_pointers()));
+        result.alive.push_back(reduce_alive(state.alive));
 
         if (--remaining_steps == 0)
         {
@@ -48,6 +48,94 @@ CELER_CONSTEXPR_FUNCTION T ipow(T v)
                           : v * ipow<(N - 1) / 2>(v) * ipow<(N - 1) / 2>(v);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Count the number of set bits in an integer (backport of C++20 popcount).
+ */
+CELER_FORCEINLINE_FUNCTION int popcount(unsigned int x)
+{
+#ifdef __CUDA_ARCH__
+    return __popc(x);
+#else
+    return __builtin_popcount(x);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Count the number of trailing zero bits (backport of C++20 countr_zero).
+ *
+ * The input must be nonzero.
+ */
+CELER_FORCEINLINE_FUNCTION int countr_zero(unsigned int x)
+{
+#ifdef __CUDA_ARCH__
+    return __ffs(x) - 1;
+#else
+    return __builtin_ctz(x);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the first element in a sorted range that is not less than the value.
+ *
+ * This is a device-compatible replacement for \c std::lower_bound using a
+ * binary search over random-access iterators.
+ */
+template<class RandomAccessIt, class T>
+inline CELER_FUNCTION RandomAccessIt lower_bound(RandomAccessIt first,
+                                                 RandomAccessIt last,
+                                                 const T&       value)
+{
+    auto count = last - first;
+    while (count > 0)
+    {
+        auto           step = count / 2;
+        RandomAccessIt it   = first + step;
+        if (*it < value)
+        {
+            first = it + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+    return first;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the first element in a sorted range that is greater than the value.
+ *
+ * This is a device-compatible replacement for \c std::upper_bound using a
+ * binary search over random-access iterators.
+ */
+template<class RandomAccessIt, class T>
+inline CELER_FUNCTION RandomAccessIt upper_bound(RandomAccessIt first,
+                                                 RandomAccessIt last,
+                                                 const T&       value)
+{
+    auto count = last - first;
+    while (count > 0)
+    {
+        auto           step = count / 2;
+        RandomAccessIt it   = first + step;
+        if (!(value < *it))
+        {
+            first = it + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+    return first;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Return the cube of the input value.
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cstdint>
 #include "Array.hh"
 #include "Types.hh"
 
@@ -45,6 +46,14 @@ inline CELER_FUNCTION Real3 from_spherical(real_type costheta, real_type phi);
 // Rotate the direction 'dir' according to the reference rotation axis 'rot'
 inline CELER_FUNCTION Real3 rotate(const Real3& dir, const Real3& rot);
 
+//---------------------------------------------------------------------------//
+// Encode a unit vector as two 16-bit octahedral coordinates
+inline CELER_FUNCTION std::uint32_t pack_direction(const Real3& dir);
+
+//---------------------------------------------------------------------------//
+// Decode a unit vector from two 16-bit octahedral coordinates
+inline CELER_FUNCTION Real3 unpack_direction(std::uint32_t packed);
+
 //---------------------------------------------------------------------------//
 // Test for being approximately a unit vector
 template<class T, std::size_t N, class SoftEq>
@@ -178,6 +178,72 @@ inline CELER_FUNCTION Real3 rotate(const Real3& dir, const Real3& rot)
     return result;
 }
 
+//---------------------------------------------------------------------------//
+namespace detail
+{
+//! Quantize a value in [-1, 1] to 16 bits
+inline CELER_FUNCTION std::uint32_t quantize_snorm16(real_type v)
+{
+    v = (v < -1 ? -1 : (v > 1 ? 1 : v));
+    return static_cast<std::uint32_t>(std::round((v + 1) * real_type(32767.5)));
+}
+
+//! Restore a 16-bit quantized value to [-1, 1]
+inline CELER_FUNCTION real_type dequantize_snorm16(std::uint32_t q)
+{
+    return q / real_type(32767.5) - 1;
+}
+
+//! Fold the lower octahedral hemisphere onto the outer triangles
+inline CELER_FUNCTION void octahedral_wrap(real_type* u, real_type* v)
+{
+    const real_type u_orig = *u;
+    *u = (1 - std::fabs(*v)) * (u_orig >= 0 ? 1 : -1);
+    *v = (1 - std::fabs(u_orig)) * (*v >= 0 ? 1 : -1);
+}
+} // namespace detail
+
+//---------------------------------------------------------------------------//
+/*!
+ * Encode a unit vector as two 16-bit octahedral coordinates.
+ *
+ * The direction is projected onto the L1 unit octahedron, whose lower half is
+ * folded outward onto the square \f$ [-1, 1]^2 \f$. Each coordinate of the
+ * square is stored as a 16-bit unsigned integer, so a direction occupies four
+ * bytes instead of 24. The angular error after a round trip is less than
+ * \f$ 10^{-4} \f$ radians.
+ */
+inline CELER_FUNCTION std::uint32_t pack_direction(const Real3& dir)
+{
+    const real_type inv_norm1
+        = 1 / (std::fabs(dir[0]) + std::fabs(dir[1]) + std::fabs(dir[2]));
+    real_type u = dir[0] * inv_norm1;
+    real_type v = dir[1] * inv_norm1;
+    if (dir[2] < 0)
+    {
+        detail::octahedral_wrap(&u, &v);
+    }
+    return (detail::quantize_snorm16(u) << 16u) | detail::quantize_snorm16(v);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Decode a unit vector from two 16-bit octahedral coordinates.
+ */
+inline CELER_FUNCTION Real3 unpack_direction(std::uint32_t packed)
+{
+    real_type u = detail::dequantize_snorm16(packed >> 16u);
+    real_type v = detail::dequantize_snorm16(packed & 0xffffu);
+    const real_type w = 1 - std::fabs(u) - std::fabs(v);
+    if (w < 0)
+    {
+        detail::octahedral_wrap(&u, &v);
+    }
+    Real3 result = {u, v, w};
+    normalize_direction(&result);
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Test for being approximately a unit vector.
@@ -91,6 +91,40 @@ CELER_FORCEINLINE_FUNCTION T atomic_max(T* address, T value)
 #endif
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Bitwise-or a value into the given address, returning old.
+ */
+template<class T>
+CELER_FORCEINLINE_FUNCTION T atomic_or(T* address, T value)
+{
+#ifdef __CUDA_ARCH__
+    return atomicOr(address, value);
+#else
+    REQUIRE(address);
+    T initial = *address;
+    *address |= value;
+    return initial;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Bitwise-and a value into the given address, returning old.
+ */
+template<class T>
+CELER_FORCEINLINE_FUNCTION T atomic_and(T* address, T value)
+{
+#ifdef __CUDA_ARCH__
+    return atomicAnd(address, value);
+#else
+    REQUIRE(address);
+    T initial = *address;
+    *address &= value;
+    return initial;
+#endif
+}
+
 #if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ <= 300)
 //---------------------------------------------------------------------------//
 /*!
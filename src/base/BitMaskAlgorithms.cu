@@ -0,0 +1,184 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BitMaskAlgorithms.cu
+//---------------------------------------------------------------------------//
+#include "BitMaskAlgorithms.hh"
+
+#include <thrust/device_ptr.h>
+#include <thrust/functional.h>
+#include <thrust/scan.h>
+#include <thrust/transform_reduce.h>
+#include "Algorithms.hh"
+#include "DeviceVector.hh"
+#include "KernelParamCalculator.cuda.hh"
+#include "NumericLimits.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// HELPER CLASSES
+//---------------------------------------------------------------------------//
+using word_type = BitMaskPointers::word_type;
+
+struct CountSet
+{
+    CELER_FUNCTION size_type operator()(word_type w) const
+    {
+        return popcount(w);
+    }
+};
+
+//---------------------------------------------------------------------------//
+// KERNELS
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the number of unset (valid) flags in each word.
+ */
+__global__ void count_unset_kernel(const BitMaskPointers mask,
+                                   Span<index_type>      counts)
+{
+    auto w = KernelParamCalculator::thread_id().get();
+    if (w < mask.words.size())
+    {
+        size_type begin = w * BitMaskPointers::bits_per_word();
+        size_type valid
+            = celeritas::min(BitMaskPointers::bits_per_word(),
+                             mask.size - begin);
+
+        // Ignore the unused bits of the last word so the count can't wrap
+        word_type word = mask.words[w];
+        if (valid < BitMaskPointers::bits_per_word())
+        {
+            word &= (word_type(1) << valid) - 1;
+        }
+        counts[w] = valid - popcount(word);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the indices of the unset flags of each word starting at its offset.
+ */
+__global__ void collect_unset_kernel(const BitMaskPointers mask,
+                                     Span<const index_type> offsets,
+                                     Span<index_type>       indices)
+{
+    auto w = KernelParamCalculator::thread_id().get();
+    if (w < mask.words.size())
+    {
+        size_type begin = w * BitMaskPointers::bits_per_word();
+        size_type end   = celeritas::min(
+            begin + BitMaskPointers::bits_per_word(), mask.size);
+
+        // Iterate over unset bits by finding set bits of the complement
+        word_type unset  = ~mask.words[w];
+        index_type offset = offsets[w];
+        while (unset != 0)
+        {
+            size_type i = begin + countr_zero(unset);
+            if (i >= end)
+                break;
+            indices[offset++] = i;
+            unset &= unset - 1;
+        }
+    }
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+// KERNEL INTERFACE
+//---------------------------------------------------------------------------//
+/*!
+ * Count the number of set flags in a device mask.
+ *
+ * This reads one bit per flag, rather than one byte for a \c bool array.
+ */
+size_type device_count_set(const BitMaskPointers& mask)
+{
+    REQUIRE(mask);
+    size_type result = thrust::transform_reduce(
+        thrust::device_pointer_cast(mask.words.data()),
+        thrust::device_pointer_cast(mask.words.data() + mask.words.size()),
+        CountSet{},
+        size_type(0),
+        thrust::plus<size_type>());
+
+    CELER_CUDA_CALL(cudaDeviceSynchronize());
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the number of set flags preceding each word of a device mask.
+ *
+ * The rank of flag \c i is then \c word_offsets[w] plus the population count
+ * of the lower bits of word \c w .
+ */
+void device_prefix_count(const BitMaskPointers& mask,
+                         Span<index_type>       word_offsets)
+{
+    REQUIRE(mask);
+    REQUIRE(word_offsets.size() == mask.words.size());
+    thrust::transform_exclusive_scan(
+        thrust::device_pointer_cast(mask.words.data()),
+        thrust::device_pointer_cast(mask.words.data() + mask.words.size()),
+        thrust::device_pointer_cast(word_offsets.data()),
+        CountSet{},
+        index_type(0),
+        thrust::plus<index_type>());
+
+    CELER_CUDA_CALL(cudaDeviceSynchronize());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the (sorted) indices of unset flags and return how many there are.
+ *
+ * This is a stream compaction over the mask: a per-word count and exclusive
+ * scan give each word its output offset, and each word then writes its unset
+ * indices independently.
+ */
+size_type
+device_collect_unset(const BitMaskPointers& mask, Span<index_type> indices)
+{
+    REQUIRE(mask);
+    REQUIRE(indices.size() >= mask.size);
+    REQUIRE(mask.size <= numeric_limits<index_type>::max());
+
+    KernelParamCalculator calc_launch_params;
+    auto                  lparams = calc_launch_params(mask.words.size());
+
+    // Count unset flags in each word and get the output offset of each word
+    DeviceVector<index_type> offsets(mask.words.size() + 1);
+    count_unset_kernel<<<lparams.grid_size, lparams.block_size>>>(
+        mask, offsets.device_pointers());
+    thrust::exclusive_scan(
+        thrust::device_pointer_cast(offsets.device_pointers().data()),
+        thrust::device_pointer_cast(offsets.device_pointers().data()
+                                    + offsets.size()),
+        thrust::device_pointer_cast(offsets.device_pointers().data()),
+        index_type(0));
+
+    // Write indices
+    collect_unset_kernel<<<lparams.grid_size, lparams.block_size>>>(
+        mask, offsets.device_pointers(), indices);
+    CELER_CUDA_CALL(cudaDeviceSynchronize());
+
+    // The trailing element of the scan is the total count
+    index_type result;
+    CELER_CUDA_CALL(cudaMemcpy(&result,
+                               offsets.device_pointers().data()
+                                   + mask.words.size(),
+                               sizeof(index_type),
+                               cudaMemcpyDeviceToHost));
+    ENSURE(result <= mask.size);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,32 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BitMaskAlgorithms.hh
+//! Parallel operations on device-resident bit masks
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "BitMaskPointers.hh"
+#include "Span.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// Count the number of set flags in a device mask
+size_type device_count_set(const BitMaskPointers& mask);
+
+//---------------------------------------------------------------------------//
+// Calculate the number of set flags preceding each word of a device mask
+void device_prefix_count(const BitMaskPointers& mask,
+                         Span<index_type>       word_offsets);
+
+//---------------------------------------------------------------------------//
+// Write the (sorted) indices of unset flags and return how many there are
+size_type
+device_collect_unset(const BitMaskPointers& mask, Span<index_type> indices);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
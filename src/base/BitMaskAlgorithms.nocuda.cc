@@ -0,0 +1,31 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BitMaskAlgorithms.nocuda.cc
+//---------------------------------------------------------------------------//
+#include "BitMaskAlgorithms.hh"
+
+#include "Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+size_type device_count_set(const BitMaskPointers&)
+{
+    CHECK_UNREACHABLE;
+}
+
+void device_prefix_count(const BitMaskPointers&, Span<index_type>)
+{
+    CHECK_UNREACHABLE;
+}
+
+size_type device_collect_unset(const BitMaskPointers&, Span<index_type>)
+{
+    CHECK_UNREACHABLE;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
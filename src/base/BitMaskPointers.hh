@@ -0,0 +1,53 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BitMaskPointers.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "Macros.hh"
+#include "Span.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Storage for a packed array of flags, one bit per element.
+ *
+ * Unused bits in the last word must always be zero so that whole-word
+ * population counts are exact.
+ */
+struct BitMaskPointers
+{
+    //!@{
+    //! Type aliases
+    using word_type = unsigned int;
+    //!@}
+
+    Span<word_type> words;
+    size_type       size = 0; //!< Number of flags
+
+    //! Number of bits in each storage word
+    static CELER_CONSTEXPR_FUNCTION size_type bits_per_word()
+    {
+        return 8 * sizeof(word_type);
+    }
+
+    //! Number of storage words needed for the given number of flags
+    static CELER_CONSTEXPR_FUNCTION size_type num_words(size_type size)
+    {
+        return (size + bits_per_word() - 1) / bits_per_word();
+    }
+
+    //! Whether the interface is initialized
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return size > 0 && words.size() == num_words(size);
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,81 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BitMaskView.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "BitMaskPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Access and modify a packed array of flags.
+ *
+ * Setting and resetting individual flags is atomic so that many threads can
+ * update flags sharing the same word. The counting and searching methods are
+ * serial and are intended for host code or for a single thread; see
+ * BitMaskAlgorithms.hh for parallel versions over the whole mask.
+ *
+ * \code
+    BitMaskView alive(ptrs);
+    if (alive.test(thread_id.get()))
+        alive.reset(thread_id.get());
+   \endcode
+ */
+class BitMaskView
+{
+  public:
+    //!@{
+    //! Type aliases
+    using Pointers  = BitMaskPointers;
+    using word_type = BitMaskPointers::word_type;
+    //!@}
+
+  public:
+    // Construct with pointers
+    explicit inline CELER_FUNCTION BitMaskView(const Pointers& ptrs);
+
+    //! Number of flags
+    CELER_FUNCTION size_type size() const { return ptrs_.size; }
+
+    // Whether the flag at the given index is set
+    inline CELER_FUNCTION bool test(size_type i) const;
+
+    // Set the flag at the given index
+    inline CELER_FUNCTION void set(size_type i);
+
+    // Clear the flag at the given index
+    inline CELER_FUNCTION void reset(size_type i);
+
+    // Number of set flags
+    inline CELER_FUNCTION size_type count() const;
+
+    // Number of set flags with index less than i
+    inline CELER_FUNCTION size_type rank(size_type i) const;
+
+    // Index of the first set flag at or after i, or size() if none
+    inline CELER_FUNCTION size_type find_next(size_type i) const;
+
+  private:
+    const Pointers& ptrs_;
+
+    //// HELPER FUNCTIONS ////
+
+    static CELER_CONSTEXPR_FUNCTION size_type word_index(size_type i)
+    {
+        return i / Pointers::bits_per_word();
+    }
+    static CELER_CONSTEXPR_FUNCTION word_type bit(size_type i)
+    {
+        return word_type(1) << (i % Pointers::bits_per_word());
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "BitMaskView.i.hh"
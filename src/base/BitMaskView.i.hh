@@ -0,0 +1,111 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BitMaskView.i.hh
+//---------------------------------------------------------------------------//
+
+#include "Algorithms.hh"
+#include "Assert.hh"
+#include "Atomics.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with pointers.
+ */
+CELER_FUNCTION BitMaskView::BitMaskView(const Pointers& ptrs) : ptrs_(ptrs)
+{
+    REQUIRE(ptrs);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether the flag at the given index is set.
+ */
+CELER_FUNCTION bool BitMaskView::test(size_type i) const
+{
+    REQUIRE(i < this->size());
+    return (ptrs_.words[word_index(i)] & bit(i)) != 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Set the flag at the given index.
+ */
+CELER_FUNCTION void BitMaskView::set(size_type i)
+{
+    REQUIRE(i < this->size());
+    atomic_or(&ptrs_.words[word_index(i)], bit(i));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Clear the flag at the given index.
+ */
+CELER_FUNCTION void BitMaskView::reset(size_type i)
+{
+    REQUIRE(i < this->size());
+    atomic_and(&ptrs_.words[word_index(i)], static_cast<word_type>(~bit(i)));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of set flags.
+ */
+CELER_FUNCTION size_type BitMaskView::count() const
+{
+    size_type result = 0;
+    for (word_type w : ptrs_.words)
+    {
+        result += popcount(w);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of set flags with index less than i.
+ */
+CELER_FUNCTION size_type BitMaskView::rank(size_type i) const
+{
+    REQUIRE(i <= this->size());
+    size_type result = 0;
+    size_type w      = 0;
+    for (size_type end = word_index(i); w != end; ++w)
+    {
+        result += popcount(ptrs_.words[w]);
+    }
+    if (i % Pointers::bits_per_word() != 0)
+    {
+        result += popcount(ptrs_.words[w] & (bit(i) - 1));
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Index of the first set flag at or after i, or size() if none.
+ */
+CELER_FUNCTION size_type BitMaskView::find_next(size_type i) const
+{
+    REQUIRE(i <= this->size());
+    if (i == this->size())
+        return i;
+
+    // Mask off bits below i in the first word
+    size_type w    = word_index(i);
+    word_type word = ptrs_.words[w] & ~(bit(i) - 1);
+    while (word == 0)
+    {
+        if (++w == ptrs_.words.size())
+            return this->size();
+        word = ptrs_.words[w];
+    }
+    return w * Pointers::bits_per_word() + countr_zero(word);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,59 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file DeviceArena.cc
+//---------------------------------------------------------------------------//
+#include "DeviceArena.hh"
+
+#include "Memory.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate device memory for all reserved segments.
+ */
+void DeviceArena::allocate()
+{
+    REQUIRE(!this->is_allocated());
+    REQUIRE(size_ > 0);
+    allocation_ = DeviceAllocation(size_);
+    ENSURE(this->is_allocated());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Fill the whole arena (including padding) with zeros.
+ */
+void DeviceArena::clear()
+{
+    REQUIRE(this->is_allocated());
+    device_memset_zero(allocation_.device_pointers());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the entire arena to device, e.g. to restore from a checkpoint.
+ */
+void DeviceArena::copy_to_device(Span<const Byte> bytes)
+{
+    REQUIRE(this->is_allocated());
+    REQUIRE(bytes.size() == size_);
+    allocation_.copy_to_device(bytes);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the entire arena to host, e.g. to write a checkpoint.
+ */
+void DeviceArena::copy_to_host(Span<Byte> bytes) const
+{
+    REQUIRE(this->is_allocated());
+    REQUIRE(bytes.size() == size_);
+    allocation_.copy_to_host(bytes);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
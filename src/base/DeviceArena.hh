@@ -0,0 +1,103 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file DeviceArena.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+#include <vector>
+#include "DeviceAllocation.hh"
+#include "OpaqueId.hh"
+#include "Span.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Carve many typed device arrays out of a single allocation.
+ *
+ * All segments are reserved up front (which only records their labels, sizes,
+ * and aligned offsets) and then allocated together. The whole arena can then
+ * be zeroed with a single memset or copied to and from the host with a single
+ * memcpy. The list of segments doubles as a per-component memory breakdown.
+ *
+ * \code
+    DeviceArena arena;
+    auto pos_id = arena.reserve<Real3>("pos", num_tracks);
+    auto step_id = arena.reserve<real_type>("next_step", num_tracks);
+    arena.allocate();
+    Span<Real3> pos = arena.device_pointers(pos_id);
+   \endcode
+ */
+class DeviceArena
+{
+  public:
+    //! Label and extent of a sub-allocation
+    struct Segment
+    {
+        std::string label;
+        size_type   offset; //!< Offset from the start of the arena [bytes]
+        size_type   size;   //!< Size of the segment [bytes]
+    };
+
+    //!@{
+    //! Type aliases
+    using VecSegment = std::vector<Segment>;
+    template<class T>
+    using SegmentId = OpaqueId<T, size_type>;
+    //!@}
+
+  public:
+    //! Alignment of each segment, matching the guarantee of cudaMalloc
+    static CELER_CONSTEXPR_FUNCTION size_type alignment() { return 256; }
+
+    // Construct with no segments
+    DeviceArena() = default;
+
+    // Reserve space for an array of elements
+    template<class T>
+    inline SegmentId<T> reserve(std::string label, size_type count);
+
+    // Allocate device memory for all reserved segments
+    void allocate();
+
+    // Fill the whole arena with zeros
+    void clear();
+
+    //// ACCESSORS ////
+
+    //! Total number of bytes needed for all segments, including padding
+    size_type size_bytes() const { return size_; }
+
+    //! Whether the segments have been allocated
+    bool is_allocated() const { return !allocation_.empty(); }
+
+    //! Reserved segments, in allocation order
+    const VecSegment& segments() const { return segments_; }
+
+    //// DEVICE ACCESSORS ////
+
+    // Get a view to the device data for a segment
+    template<class T>
+    inline Span<T> device_pointers(SegmentId<T> id);
+
+    // Copy the entire arena to device
+    void copy_to_device(Span<const Byte> bytes);
+
+    // Copy the entire arena to host
+    void copy_to_host(Span<Byte> bytes) const;
+
+  private:
+    VecSegment       segments_;
+    size_type        size_ = 0;
+    DeviceAllocation allocation_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "DeviceArena.i.hh"
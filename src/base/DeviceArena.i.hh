@@ -0,0 +1,59 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file DeviceArena.i.hh
+//---------------------------------------------------------------------------//
+
+#include <type_traits>
+#include <utility>
+#include "Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Reserve space for an array of elements.
+ *
+ * Segments can only be reserved before the arena is allocated. Each segment
+ * begins at an offset that is a multiple of \c alignment() .
+ */
+template<class T>
+auto DeviceArena::reserve(std::string label, size_type count) -> SegmentId<T>
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Arena element is not trivially copyable");
+    static_assert(std::is_trivially_destructible<T>::value,
+                  "Arena element is not trivially destructible");
+    static_assert(alignof(T) <= DeviceArena::alignment(),
+                  "Arena element alignment is too strict");
+    REQUIRE(!this->is_allocated());
+
+    Segment seg;
+    seg.label  = std::move(label);
+    seg.offset = (size_ + alignment() - 1) / alignment() * alignment();
+    seg.size   = count * sizeof(T);
+    size_      = seg.offset + seg.size;
+    segments_.push_back(std::move(seg));
+
+    return SegmentId<T>(segments_.size() - 1);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a view to the device data for a segment.
+ */
+template<class T>
+Span<T> DeviceArena::device_pointers(SegmentId<T> id)
+{
+    REQUIRE(this->is_allocated());
+    REQUIRE(id < segments_.size());
+    const Segment& seg = segments_[id.get()];
+    return {reinterpret_cast<T*>(allocation_.device_pointers().data()
+                                 + seg.offset),
+            seg.size / sizeof(T)};
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
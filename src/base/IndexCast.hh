@@ -0,0 +1,44 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file IndexCast.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <limits>
+#include <type_traits>
+#include "Assert.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a host-side size to a (possibly narrower) index type.
+ *
+ * This should be used when constructing device storage whose elements are
+ * indices or sizes, so that a problem too large for the configured \c
+ * index_type fails at setup rather than silently wrapping during transport.
+ *
+ * \code
+    index_type num_tracks = checked_index_cast(inp.num_tracks);
+   \endcode
+ */
+template<class T = index_type, class U>
+inline T checked_index_cast(U value)
+{
+    static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value,
+                  "Index type must be an unsigned integer");
+    static_assert(std::is_integral<U>::value && std::is_unsigned<U>::value,
+                  "Value must be an unsigned integer");
+    INSIST(static_cast<unsigned long long>(value)
+               <= std::numeric_limits<T>::max(),
+           "Value " << value << " exceeds the range of the "
+                    << 8 * sizeof(T) << "-bit index type");
+    return static_cast<T>(value);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,207 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ParamsImage.cc
+//---------------------------------------------------------------------------//
+#include "ParamsImage.hh"
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <utility>
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a fixed capacity.
+ *
+ * The capacity should be the sum of \c padded_size for every array that will
+ * be allocated. The buffer is zero-initialized so that padding bytes are
+ * deterministic.
+ */
+ParamsImage::ParamsImage(size_type capacity) : data_(capacity)
+{
+    REQUIRE(capacity > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Take ownership of another image's buffer.
+ *
+ * Moving a vector never reallocates its storage, so the pointers stored
+ * inside the image still point into it. The other image is left empty.
+ */
+ParamsImage::ParamsImage(ParamsImage&& other) noexcept
+    : data_(std::move(other.data_))
+    , size_(std::exchange(other.size_, 0))
+    , relocations_(std::move(other.relocations_))
+{
+    other.data_.clear();
+    other.relocations_.clear();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Take ownership of another image's buffer.
+ */
+ParamsImage& ParamsImage::operator=(ParamsImage&& other) noexcept
+{
+    if (this != &other)
+    {
+        data_        = std::move(other.data_);
+        size_        = std::exchange(other.size_, 0);
+        relocations_ = std::move(other.relocations_);
+        other.data_.clear();
+        other.relocations_.clear();
+    }
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read an image from a binary stream.
+ *
+ * The stored offsets are converted back into pointers to the new host buffer.
+ * Since the stream is external input, the header and every offset are
+ * validated even in release builds: each relocation must be a pointer-sized
+ * slot inside the image that points inside the image.
+ */
+ParamsImage ParamsImage::read(std::istream& is)
+{
+    std::uint64_t size            = 0;
+    std::uint64_t num_relocations = 0;
+    is.read(reinterpret_cast<char*>(&size), sizeof(size));
+    is.read(reinterpret_cast<char*>(&num_relocations),
+            sizeof(num_relocations));
+    INSIST(is && size > 0, "Failed to read params image header");
+    INSIST(num_relocations <= size / sizeof(Byte*),
+           "Params image header has " << num_relocations
+                                      << " relocations for an image of "
+                                      << size << " bytes");
+
+    ParamsImage result(size);
+    result.size_ = size;
+    result.relocations_.resize(num_relocations);
+    for (size_type& offset : result.relocations_)
+    {
+        std::uint64_t temp;
+        is.read(reinterpret_cast<char*>(&temp), sizeof(temp));
+        offset = temp;
+    }
+    is.read(reinterpret_cast<char*>(result.data_.data()), size);
+    INSIST(is, "Failed to read params image data");
+
+    // Convert offsets (relative to a null base) into host pointers
+    for (size_type offset : result.relocations_)
+    {
+        INSIST(offset <= result.size_ - sizeof(Byte*),
+               "Params image relocation at " << offset
+                                             << " is out of bounds");
+        Byte* dst = result.data_.data() + offset;
+        std::uintptr_t ptr_offset;
+        std::memcpy(&ptr_offset, dst, sizeof(ptr_offset));
+        INSIST(ptr_offset < result.size_,
+               "Params image relocation at " << offset
+                                             << " points out of bounds");
+        Byte* ptr = result.data_.data() + ptr_offset;
+        std::memcpy(dst, &ptr, sizeof(ptr));
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the image with all relocations rebased to another address.
+ *
+ * The result can be copied byte-for-byte to a buffer starting at \c base
+ * (e.g. device or shared memory) without any further pointer fixup.
+ */
+std::vector<Byte> ParamsImage::relocated(const Byte* base) const
+{
+    REQUIRE(base);
+    std::vector<Byte> result(data_.begin(), data_.begin() + size_);
+    for (size_type offset : relocations_)
+    {
+        this->relocate(result.data() + offset, data_.data() + offset, base);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy to a single new device allocation.
+ */
+DeviceAllocation ParamsImage::copy_to_device() const
+{
+    REQUIRE(size_ > 0);
+    DeviceAllocation result(size_);
+    std::vector<Byte> temp = this->relocated(result.device_pointers().data());
+    result.copy_to_device(make_span(temp));
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the image to a binary stream.
+ *
+ * Relocated pointers are written as offsets from the start of the image, so
+ * the output does not depend on the host address of the image.
+ */
+void ParamsImage::write(std::ostream& os) const
+{
+    std::uint64_t temp = size_;
+    os.write(reinterpret_cast<const char*>(&temp), sizeof(temp));
+    temp = relocations_.size();
+    os.write(reinterpret_cast<const char*>(&temp), sizeof(temp));
+    for (size_type offset : relocations_)
+    {
+        temp = offset;
+        os.write(reinterpret_cast<const char*>(&temp), sizeof(temp));
+    }
+
+    // Relocate to a null base so that pointers become offsets
+    std::vector<Byte> bytes(data_.begin(), data_.begin() + size_);
+    for (size_type offset : relocations_)
+    {
+        const Byte* ptr;
+        std::memcpy(&ptr, data_.data() + offset, sizeof(ptr));
+        std::uintptr_t ptr_offset = this->offset_of(ptr);
+        std::memcpy(bytes.data() + offset, &ptr_offset, sizeof(ptr_offset));
+    }
+    os.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    INSIST(os, "Failed to write params image");
+}
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Rebase the pointer at \c src (which points into this image) to \c base.
+ */
+void ParamsImage::relocate(Byte*       dst,
+                           const Byte* src,
+                           const Byte* base) const
+{
+    const Byte* ptr;
+    std::memcpy(&ptr, src, sizeof(ptr));
+    ptr = base + this->offset_of(ptr);
+    std::memcpy(dst, &ptr, sizeof(ptr));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the offset of a pointer into the image.
+ */
+size_type ParamsImage::offset_of(const void* ptr) const
+{
+    const Byte* p = static_cast<const Byte*>(ptr);
+    REQUIRE(p >= data_.data() && p < data_.data() + size_);
+    return p - data_.data();
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,151 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ParamsImage.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <iosfwd>
+#include <type_traits>
+#include <vector>
+#include "DeviceAllocation.hh"
+#include "Span.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Relocatable contiguous image of shared parameter data.
+ *
+ * A params class packs all of its POD arrays into a single host buffer whose
+ * size is computed up front. Spans stored *inside* the image that point to
+ * other data inside the image are registered as relocations. The image can
+ * then be:
+ * - uploaded to the device in a single copy, with every registered span
+ *   rebased to the device address;
+ * - written to and read from a stream, with pointers stored as offsets;
+ * - copied to any other buffer (e.g. shared memory) using \c relocated .
+ *
+ * By convention the first allocation in the image is a "root" pointer
+ * struct (e.g. \c MaterialParamsPointers ) that can be retrieved as seen from
+ * any base address with \c root .
+ *
+ * Because the image stores pointers into its own buffer, it cannot be copied.
+ * Moving transfers the heap buffer without reallocating it, so the stored
+ * pointers remain valid, and leaves the source empty.
+ *
+ * \code
+    ParamsImage image(ParamsImage::padded_size<FooPointers>(1)
+                      + ParamsImage::padded_size<Bar>(bars.size()));
+    FooPointers& root = image.allocate<FooPointers>(1).front();
+    root.bars = image.insert(make_span(bars));
+    image.add_relocation(root.bars);
+
+    DeviceAllocation device_data = image.copy_to_device();
+    FooPointers device_ptrs = image.root<FooPointers>(
+        device_data.device_pointers().data());
+   \endcode
+ */
+class ParamsImage
+{
+  public:
+    //!@{
+    //! Type aliases
+    using SpanBytes      = Span<Byte>;
+    using constSpanBytes = Span<const Byte>;
+    //!@}
+
+  public:
+    //! Alignment of each array in the image [bytes]
+    static CELER_CONSTEXPR_FUNCTION size_type alignment() { return 16; }
+
+    // Space required to store an array of elements in the image
+    template<class T>
+    static inline size_type padded_size(size_type count);
+
+    // Construct empty
+    ParamsImage() = default;
+
+    // Construct with a fixed capacity
+    explicit ParamsImage(size_type capacity);
+
+    // Read an image from a binary stream
+    static ParamsImage read(std::istream& is);
+
+    //!@{
+    //! Stored pointers would dangle in a copy
+    ParamsImage(const ParamsImage&) = delete;
+    ParamsImage& operator=(const ParamsImage&) = delete;
+    //!@}
+
+    // Take ownership of another image's buffer
+    ParamsImage(ParamsImage&& other) noexcept;
+
+    // Take ownership of another image's buffer
+    ParamsImage& operator=(ParamsImage&& other) noexcept;
+
+    //// CONSTRUCTION ////
+
+    // Allocate a default-initialized array inside the image
+    template<class T>
+    inline Span<T> allocate(size_type count);
+
+    // Copy an array into the image
+    template<class T>
+    inline Span<std::remove_const_t<T>> insert(Span<T> data);
+
+    // Mark a span stored in the image as pointing into the image
+    template<class T>
+    inline void add_relocation(Span<T>& span);
+
+    //// ACCESSORS ////
+
+    //! Number of bytes used
+    size_type size() const { return size_; }
+
+    //! Maximum number of bytes
+    size_type capacity() const { return data_.size(); }
+
+    //! Number of registered relocations
+    size_type num_relocations() const { return relocations_.size(); }
+
+    //! View to the host data
+    constSpanBytes data() const { return {data_.data(), size_}; }
+
+    // Get the root object as seen from the given base address
+    template<class T>
+    inline T root(const Byte* base) const;
+
+    // Get the root object on the host
+    template<class T>
+    inline T root() const;
+
+    //// RELOCATION ////
+
+    // Copy the image with all relocations rebased to another address
+    std::vector<Byte> relocated(const Byte* base) const;
+
+    // Copy to a single new device allocation
+    DeviceAllocation copy_to_device() const;
+
+    // Write the image to a binary stream with pointers as offsets
+    void write(std::ostream& os) const;
+
+  private:
+    std::vector<Byte>      data_;
+    size_type              size_ = 0;
+    std::vector<size_type> relocations_;
+
+    //// HELPER FUNCTIONS ////
+
+    void      relocate(Byte* dst, const Byte* src, const Byte* base) const;
+    size_type offset_of(const void* ptr) const;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "ParamsImage.i.hh"
@@ -0,0 +1,125 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ParamsImage.i.hh
+//---------------------------------------------------------------------------//
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include "Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Space required to store an array of elements in the image.
+ */
+template<class T>
+size_type ParamsImage::padded_size(size_type count)
+{
+    return (count * sizeof(T) + alignment() - 1) / alignment() * alignment();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate a default-initialized array inside the image.
+ */
+template<class T>
+Span<T> ParamsImage::allocate(size_type count)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Image element is not trivially copyable");
+    static_assert(alignof(T) <= ParamsImage::alignment(),
+                  "Image element alignment is too strict");
+    REQUIRE(size_ + padded_size<T>(count) <= this->capacity());
+
+    T* result = reinterpret_cast<T*>(data_.data() + size_);
+    for (size_type i = 0; i != count; ++i)
+    {
+        new (result + i) T;
+    }
+    size_ += padded_size<T>(count);
+    return {result, count};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy an array into the image.
+ */
+template<class T>
+Span<std::remove_const_t<T>> ParamsImage::insert(Span<T> data)
+{
+    auto result = this->allocate<std::remove_const_t<T>>(data.size());
+    std::copy(data.begin(), data.end(), result.begin());
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Mark a span stored in the image as pointing into the image.
+ *
+ * Empty spans are reset to null and are not relocated.
+ */
+template<class T>
+void ParamsImage::add_relocation(Span<T>& span)
+{
+    static_assert(std::is_standard_layout<Span<T>>::value,
+                  "Span data pointer must be at the start of the object");
+    REQUIRE(this->offset_of(&span) + sizeof(Span<T>) <= size_);
+    if (span.empty())
+    {
+        span = {};
+        return;
+    }
+    REQUIRE(this->offset_of(span.data()) + span.size_bytes() <= size_);
+
+    relocations_.push_back(this->offset_of(&span));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the root object as seen from the given base address.
+ *
+ * The root object must be the first allocation in the image. Spans inside it
+ * are rebased to the given address, so if \c base is the start of a device
+ * copy of the image the result is suitable for passing to a kernel.
+ */
+template<class T>
+T ParamsImage::root(const Byte* base) const
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Root object is not trivially copyable");
+    REQUIRE(base);
+    REQUIRE(sizeof(T) <= size_);
+
+    Byte temp[sizeof(T)];
+    std::memcpy(temp, data_.data(), sizeof(T));
+    for (size_type offset : relocations_)
+    {
+        if (offset + sizeof(Byte*) <= sizeof(T))
+        {
+            this->relocate(temp + offset, data_.data() + offset, base);
+        }
+    }
+
+    T result;
+    std::memcpy(&result, temp, sizeof(T));
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the root object on the host.
+ */
+template<class T>
+T ParamsImage::root() const
+{
+    return this->root<T>(data_.data());
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
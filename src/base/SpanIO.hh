@@ -26,6 +26,11 @@ std::ostream& operator<<(std::ostream& os, const Span<T, E>& s)
 
     os.width(0);
     os << '{';
+    if (size == 0)
+    {
+        os << '}';
+        return os;
+    }
     if (width > 2 + (size - 1))
     {
         // Subtract width for spaces and braces
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <cstddef>
+#include "celeritas_config.h"
 #include "Array.hh"
 #include "OpaqueId.hh"
 
@@ -18,6 +19,13 @@ namespace celeritas
 //! Standard type for container sizes.
 using size_type = std::size_t;
 
+//! Compact index and size type for device-resident track data
+#if CELERITAS_COMPACT_INDEX
+using index_type = unsigned int;
+#else
+using index_type = std::size_t;
+#endif
+
 //! Equivalent to container size but compatible with CUDA atomics
 using ull_int = unsigned long long int;
 
@@ -0,0 +1,116 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LivermoreParamsBuilder.cc
+//---------------------------------------------------------------------------//
+#include "LivermoreParamsBuilder.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "base/Algorithms.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the reader for a single element.
+ */
+LivermoreParamsBuilder::LivermoreParamsBuilder(
+    LivermoreParamsReader read_element)
+    : read_element_(std::move(read_element))
+    , num_threads_(std::max(std::thread::hardware_concurrency(), 1u))
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Set the maximum number of reader threads.
+ */
+void LivermoreParamsBuilder::num_threads(unsigned int count)
+{
+    REQUIRE(count > 0);
+    num_threads_ = count;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read the data for all elements in the materials.
+ */
+auto LivermoreParamsBuilder::operator()(const MaterialParams& materials) const
+    -> result_type
+{
+    const auto elements = materials.host_pointers().elements;
+    REQUIRE(!elements.empty());
+
+    // Collect the unique atomic numbers
+    std::vector<int> unique_z;
+    for (const auto& el : elements)
+    {
+        unique_z.push_back(el.atomic_number);
+    }
+    std::sort(unique_z.begin(), unique_z.end());
+    unique_z.erase(std::unique(unique_z.begin(), unique_z.end()),
+                   unique_z.end());
+
+    // Read each element on a pool of threads, saving the first failure
+    std::vector<LivermoreParams::ElementInput> el_data(unique_z.size());
+    std::vector<std::exception_ptr>            errors(unique_z.size());
+    std::atomic<size_type>                     next_index{0};
+
+    auto read_elements = [&]() {
+        for (size_type i = next_index++; i < unique_z.size(); i = next_index++)
+        {
+            try
+            {
+                el_data[i] = read_element_(unique_z[i]);
+            }
+            catch (...)
+            {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    const unsigned int num_threads
+        = celeritas::min<size_type>(num_threads_, unique_z.size());
+    std::vector<std::thread> threads;
+    for (unsigned int i = 1; i < num_threads; ++i)
+    {
+        threads.emplace_back(read_elements);
+    }
+    read_elements();
+    for (std::thread& t : threads)
+    {
+        t.join();
+    }
+    for (const std::exception_ptr& e : errors)
+    {
+        if (e)
+        {
+            std::rethrow_exception(e);
+        }
+    }
+
+    // Copy the element data in the order of the element IDs
+    result_type result;
+    result.elements.reserve(elements.size());
+    for (const auto& el : elements)
+    {
+        auto iter = std::lower_bound(
+            unique_z.begin(), unique_z.end(), el.atomic_number);
+        CHECK(iter != unique_z.end() && *iter == el.atomic_number);
+        result.elements.push_back(el_data[iter - unique_z.begin()]);
+    }
+
+    ENSURE(result.elements.size() == elements.size());
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
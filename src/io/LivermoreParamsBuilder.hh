@@ -0,0 +1,54 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LivermoreParamsBuilder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "physics/em/LivermoreParams.hh"
+#include "physics/material/MaterialParams.hh"
+#include "LivermoreParamsReader.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Build Livermore photoelectric input for the elements in a problem.
+ *
+ * The data for each unique atomic number in the material definitions is read
+ * exactly once, with the files for different elements parsed concurrently on
+ * host threads. The resulting input is indexed by \c ElementDefId so that it
+ * can be used directly with the element IDs selected from the materials.
+ *
+ * \code
+    LivermoreParamsBuilder build_livermore(LivermoreParamsReader{});
+    LivermoreParams livermore(build_livermore(*material_params));
+   \endcode
+ */
+class LivermoreParamsBuilder
+{
+  public:
+    //!@{
+    //! Type aliases
+    using result_type = LivermoreParams::Input;
+    //!@}
+
+  public:
+    // Construct with the reader for a single element
+    explicit LivermoreParamsBuilder(LivermoreParamsReader read_element);
+
+    // Set the maximum number of reader threads (default: hardware threads)
+    void num_threads(unsigned int count);
+
+    // Read the data for all elements in the materials
+    result_type operator()(const MaterialParams& materials) const;
+
+  private:
+    LivermoreParamsReader read_element_;
+    unsigned int          num_threads_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
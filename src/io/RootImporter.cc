@@ -10,6 +10,7 @@
 #include <cstdlib>
 #include <iomanip>
 #include <iostream>
+#include <map>
 #include <tuple>
 
 #include <TFile.h>
@@ -51,6 +52,11 @@ RootImporter::result_type RootImporter::operator()()
     geant_data.geometry        = this->load_geometry_data();
     geant_data.material_params = this->load_material_data();
 
+    // Point geometry and physics tables at the merged materials
+    remap_material_ids(*geant_data.material_params,
+                       geant_data.geometry.get(),
+                       &geant_data.processes);
+
     // Sort processes based on particle def IDs, process types, etc.
     {
         const ParticleParams& particles = *geant_data.particle_params;
@@ -266,5 +272,87 @@ MatterState RootImporter::to_matter_state(const ImportMaterialState state)
     CHECK_UNREACHABLE;
 }
 
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Map imported material IDs to the (merged) IDs stored in MaterialParams.
+ *
+ * The material parameters must have been constructed from the geometry's
+ * materials in order. Volumes are relinked to the stored material IDs, only
+ * the first of each set of identical materials is kept in the geometry, and
+ * the per-material vectors of every physics table are reduced the same way.
+ */
+void remap_material_ids(const MaterialParams&       materials,
+                        GdmlGeometryMap*            geometry,
+                        std::vector<ImportProcess>* processes)
+{
+    REQUIRE(geometry);
+    REQUIRE(processes);
+
+    // Stored ID of each imported material
+    std::map<mat_id, MaterialDefId> to_stored;
+    std::vector<mat_id>             stored_to_input;
+    for (const auto& mat_key : geometry->matid_to_material_map())
+    {
+        MaterialDefId input_id(to_stored.size());
+        REQUIRE(mat_key.first == input_id.get());
+        MaterialDefId id = materials.canonical_id(input_id);
+        if (id.get() == stored_to_input.size())
+        {
+            stored_to_input.push_back(mat_key.first);
+        }
+        to_stored[mat_key.first] = id;
+    }
+    CHECK(stored_to_input.size() == materials.num_materials());
+    if (stored_to_input.size() == to_stored.size())
+    {
+        // No materials were merged
+        return;
+    }
+
+    // Rebuild the geometry with the stored material IDs
+    GdmlGeometryMap result;
+    for (const auto& elem_key : geometry->elemid_to_element_map())
+    {
+        result.add_element(elem_key.first, elem_key.second);
+    }
+    for (auto id : range<mat_id>(stored_to_input.size()))
+    {
+        result.add_material(id, geometry->get_material(stored_to_input[id]));
+    }
+    for (const auto& vol_key : geometry->volid_to_volume_map())
+    {
+        result.add_volume(vol_key.first, vol_key.second);
+    }
+    for (const auto& link : geometry->volid_to_matid_map())
+    {
+        result.link_volume_material(link.first,
+                                    to_stored.at(link.second).get());
+    }
+    *geometry = std::move(result);
+
+    // Keep the physics vector of the first of each set of merged materials
+    for (ImportProcess& process : *processes)
+    {
+        for (ImportPhysicsTable& table : process.tables)
+        {
+            if (table.physics_vectors.empty())
+            {
+                continue;
+            }
+            REQUIRE(table.physics_vectors.size() == to_stored.size());
+            std::vector<ImportPhysicsVector> vectors;
+            vectors.reserve(stored_to_input.size());
+            for (mat_id input_id : stored_to_input)
+            {
+                vectors.push_back(
+                    std::move(table.physics_vectors[input_id]));
+            }
+            table.physics_vectors = std::move(vectors);
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -51,6 +51,11 @@ namespace celeritas
  * The GdmlGeometryMap::mat_id value returned from a given vol_id represents
  * the position of said material in the ImportPhysicsTable vectors:
  * \c ImportPhysicsTable.physics_vectors.at(mat_id_value).
+ *
+ * Since MaterialParams merges physically identical materials, the material
+ * IDs of the imported geometry and physics tables are remapped to the
+ * MaterialParams IDs (see \c remap_material_ids), so that a mat_id is also a
+ * valid MaterialDefId.
  */
 class RootImporter
 {
@@ -90,5 +95,14 @@ class RootImporter
     std::unique_ptr<TFile> root_input_;
 };
 
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+
+// Map imported material IDs to the (merged) IDs stored in MaterialParams
+void remap_material_ids(const MaterialParams&       materials,
+                        GdmlGeometryMap*            geometry,
+                        std::vector<ImportProcess>* processes);
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -0,0 +1,88 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SeltzerBergerReader.cc
+//---------------------------------------------------------------------------//
+#include "SeltzerBergerReader.hh"
+
+#include <fstream>
+#include <sstream>
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the reader using the G4LEDATA environment variable to get the path
+ * to the data.
+ */
+SeltzerBergerReader::SeltzerBergerReader()
+{
+    const char* env_var = std::getenv("G4LEDATA");
+    INSIST(env_var, "Environment variable G4LEDATA is not defined.");
+    std::ostringstream os;
+    os << env_var << "/brem_SB";
+    path_ = os.str();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the reader with the path to the directory containing the data.
+ */
+SeltzerBergerReader::SeltzerBergerReader(const char* path) : path_(path)
+{
+    REQUIRE(!path_.empty());
+    if (path_.back() == '/')
+    {
+        path_.pop_back();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read the data for the given element.
+ *
+ * The file starts with the vector type and the numbers of \f$ x \f$ and
+ * energy grid points, followed by the two grids and the table, with
+ * \f$ x \f$ varying fastest.
+ */
+SeltzerBergerReader::result_type
+SeltzerBergerReader::operator()(int atomic_number) const
+{
+    REQUIRE(atomic_number > 0 && atomic_number < 101);
+
+    std::string   filename = path_ + "/br" + std::to_string(atomic_number);
+    std::ifstream infile(filename);
+    INSIST(infile, "Couldn't open '" << filename << "'");
+
+    result_type result;
+    int         vector_type = 0;
+    size_type   num_x       = 0;
+    size_type   num_energy  = 0;
+    infile >> vector_type >> num_x >> num_energy;
+    INSIST(infile && num_x >= 2 && num_energy >= 2,
+           "Invalid table size in '" << filename << "'");
+
+    result.x.resize(num_x);
+    for (real_type& x : result.x)
+    {
+        infile >> x;
+    }
+    result.log_energy.resize(num_energy);
+    for (real_type& log_energy : result.log_energy)
+    {
+        infile >> log_energy;
+    }
+    result.value.resize(num_x * num_energy);
+    for (real_type& value : result.value)
+    {
+        infile >> value;
+    }
+    INSIST(infile, "Failed to read '" << filename << "'");
+
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,47 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SeltzerBergerReader.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+#include "physics/em/BremRelParams.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Load the Seltzer-Berger bremsstrahlung data distributed with Geant4.
+ *
+ * Each file \c br<Z> holds the scaled cross section of one element as a
+ * two-dimensional table in the energy fraction \f$ x = k/T \f$ and the
+ * logarithm of the kinetic energy [ln MeV].
+ */
+class SeltzerBergerReader
+{
+  public:
+    //!@{
+    //! Type aliases
+    using result_type = BremRelParams::ElementInput;
+    //!@}
+
+  public:
+    // Construct the reader and locate the data using the environment variable
+    SeltzerBergerReader();
+
+    // Construct the reader from the path to the data directory
+    explicit SeltzerBergerReader(const char* path);
+
+    // Read the data for the given element
+    result_type operator()(int atomic_number) const;
+
+  private:
+    // Directory containing the Seltzer-Berger data
+    std::string path_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,440 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CutParams.cc
+//---------------------------------------------------------------------------//
+#include "CutParams.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include "base/Algorithms.hh"
+#include "base/Constants.hh"
+#include "base/Range.hh"
+#include "comm/Device.hh"
+#include "physics/material/MaterialView.hh"
+#include "RegionParams.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//// HELPER FUNCTIONS ////
+//---------------------------------------------------------------------------//
+using MevEnergy = units::MevEnergy;
+//! Energy [MeV] and atomic number to stopping power per atom or cross section
+using ElementCoeff = std::function<real_type(int, real_type)>;
+
+//! Electron rest mass energy [MeV]
+constexpr real_type electron_mass_c2()
+{
+    return constants::electron_mass * constants::c_light * constants::c_light
+           / units::Mev::value();
+}
+
+//! 2 pi m_e c^2 r_e^2 [MeV cm^2]
+constexpr real_type twopi_mc2_rcl2()
+{
+    return 2 * constants::pi * electron_mass_c2() * constants::re_electron
+           * constants::re_electron;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Approximate electron or positron stopping power per atom [MeV cm^2].
+ *
+ * This is the ionization loss of the Berger-Seltzer formula with an
+ * empirical bremsstrahlung term. Below 10 keV the loss is extrapolated as
+ * inversely proportional to the velocity.
+ */
+real_type calc_lepton_dedx(int z, real_type energy, bool positron)
+{
+    const real_type mass    = electron_mass_c2();
+    const real_type t_low   = 10e-3 / mass;
+    const real_type ionpot  = 1.6e-5 * std::pow(real_type(z), 0.9) / mass;
+    const real_type tau     = std::max(energy / mass, t_low);
+    const real_type t1      = tau + 1;
+    const real_type t2      = tau + 2;
+    const real_type tsq     = tau * tau;
+    const real_type beta_sq = tau * t2 / (t1 * t1);
+
+    real_type f;
+    if (!positron)
+    {
+        f = 1 - beta_sq + std::log(tsq / 2)
+            + (0.5 + 0.25 * tsq + (1 + 2 * tau) * std::log(0.5)) / (t1 * t1);
+    }
+    else
+    {
+        f = 2 * std::log(tau)
+            - (6 * tau + 1.5 * tsq - tau * (1 - tsq / 3) / t2
+               - tsq * (0.5 - tsq / 12) / (t2 * t2))
+                  / (t1 * t1);
+    }
+    real_type dedx = (std::log(2 * tau + 4) - 2 * std::log(ionpot) + f)
+                     / beta_sq;
+
+    if (energy / mass < t_low)
+    {
+        // Inversely proportional to velocity at low energy
+        return twopi_mc2_rcl2() * z * dedx * std::sqrt(t_low * mass / energy);
+    }
+
+    // Bremsstrahlung loss
+    real_type cbrem = (0.02 - 5.7e-5 * z)
+                      * (1 + 0.072 * std::log(energy / 1e3));
+    cbrem = 0.1 * z * (z + 1) * cbrem * tau / beta_sq;
+    return twopi_mc2_rcl2() * (z * dedx + cbrem);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Approximate photon absorption cross section [cm^2].
+ *
+ * This empirical formula sums the photoelectric, Compton, and pair production
+ * cross sections.
+ */
+real_type calc_gamma_xs(int atomic_number, real_type energy)
+{
+    constexpr real_type t1kev   = 1e-3;
+    constexpr real_type t200kev = 0.2;
+    constexpr real_type t100mev = 100;
+    constexpr real_type barn    = 1e-24;
+
+    const real_type z      = atomic_number;
+    const real_type zsq    = z * z;
+    const real_type zlog   = std::log(z);
+    const real_type zlogsq = zlog * zlog;
+
+    const real_type s200kev = (0.2651 - 0.1501 * zlog + 0.02283 * zlogsq)
+                              * zsq;
+    const real_type tmin    = 0.552 + 218.5 / z + 557.17 / zsq;
+    const real_type tlow    = 0.2 * std::exp(-7.355 / std::sqrt(z));
+    const real_type smin    = (0.01239 + 0.005585 * zlog - 0.000923 * zlogsq)
+                           * std::exp(1.41125 * zlog);
+    const real_type cmin = std::log(s200kev / smin)
+                           / ipow<2>(std::log(tmin / t200kev));
+    const real_type slow
+        = s200kev * std::exp(0.042 * z * ipow<2>(std::log(t200kev / tlow)));
+    const real_type logtlow = std::log(tlow / t1kev);
+    const real_type clow    = std::log(300 * zsq / slow) / logtlow;
+    const real_type chigh   = (7.55e-5 - 0.0542e-5 * z) * zsq * z
+                            / std::log(t100mev / tmin);
+
+    real_type xs;
+    if (energy < tlow)
+    {
+        xs = slow
+             * std::exp(clow
+                        * (energy < t1kev ? logtlow : std::log(tlow / energy)));
+    }
+    else if (energy < t200kev)
+    {
+        xs = s200kev
+             * std::exp(0.042 * z * ipow<2>(std::log(t200kev / energy)));
+    }
+    else if (energy < tmin)
+    {
+        xs = smin * std::exp(cmin * ipow<2>(std::log(tmin / energy)));
+    }
+    else
+    {
+        xs = smin + chigh * ipow<2>(std::log(energy / tmin));
+    }
+    return xs * barn;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sum an elemental coefficient over a material.
+ */
+real_type
+calc_macro(const MaterialView& mat, const ElementCoeff& coeff, real_type energy)
+{
+    real_type result = 0;
+    for (auto i : range(mat.num_elements()))
+    {
+        ElementComponentId comp_id{i};
+        result += mat.get_element_density(comp_id)
+                  * coeff(mat.element_view(comp_id).atomic_number(), energy);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Energy grid of the range-to-energy conversion, uniform in log energy.
+ */
+struct CutGrid
+{
+    static constexpr size_type num_bins = 300;
+
+    real_type emin = CutParams::min_energy().value();
+    real_type log_delta
+        = std::log(CutParams::max_energy().value() / emin) / num_bins;
+
+    //! Energy at a grid point [MeV]
+    real_type energy(size_type i) const
+    {
+        return emin * std::exp(i * log_delta);
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulate the "range" at each grid point.
+ *
+ * For charged particles this is the range integrated from the lowest grid
+ * point with the trapezoidal rule in log energy; as in Geant4, the value at
+ * the lowest point is a full bin width of the integrand. For photons it is
+ * five absorption lengths.
+ */
+std::vector<real_type> calc_ranges(const CutGrid&      grid,
+                                   const MaterialView& mat,
+                                   const ElementCoeff& coeff,
+                                   bool                integrate)
+{
+    std::vector<real_type> result(CutGrid::num_bins + 1);
+    real_type              sum = 0;
+    for (auto i : range(result.size()))
+    {
+        const real_type energy = grid.energy(i);
+        const real_type macro  = calc_macro(mat, coeff, energy);
+        if (!integrate)
+        {
+            result[i] = 5 / macro;
+            continue;
+        }
+
+        const real_type q = energy / macro;
+        sum += (i == 0 ? q / 2 : q);
+        result[i] = (i == 0 ? sum + q / 2 : sum - q / 2) * grid.log_delta;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a range cut to an energy.
+ *
+ * This follows Geant4 10's range-to-energy converter: the grid interval
+ * containing the cut is found among the increasing ranges, then the energy is
+ * bisected in log space until the linearly interpolated range is within 1% of
+ * the cut.
+ */
+real_type convert_range_cut(const CutGrid&                grid,
+                            const std::vector<real_type>& ranges,
+                            real_type                     cut)
+{
+    constexpr real_type rel_tol  = 0.01;
+    constexpr int       max_iter = 1000;
+
+    auto calc_range = [&grid, &ranges](real_type energy) {
+        const size_type i = std::min<size_type>(
+            std::log(energy / grid.emin) / grid.log_delta,
+            CutGrid::num_bins - 1);
+        const real_type energy_lo = grid.energy(i);
+        return ranges[i]
+               + (ranges[i + 1] - ranges[i]) * (energy - energy_lo)
+                     / (grid.energy(i + 1) - energy_lo);
+    };
+
+    real_type range_lo = ranges.front();
+    if (cut <= range_lo)
+        return grid.emin;
+
+    // Find the interval, skipping points where the range doesn't increase
+    real_type energy_lo = grid.emin;
+    real_type energy_hi = CutParams::max_energy().value();
+    for (auto i : range(CutGrid::num_bins))
+    {
+        if (ranges[i] <= range_lo)
+            continue;
+        if (ranges[i] < cut)
+        {
+            energy_lo = grid.energy(i);
+            range_lo  = ranges[i];
+        }
+        else if (ranges[i] > cut)
+        {
+            energy_hi = grid.energy(i);
+            break;
+        }
+    }
+
+    real_type energy = std::sqrt(energy_lo * energy_hi);
+    for (int iter = 0; iter < max_iter; ++iter)
+    {
+        const real_type range_mid = calc_range(energy);
+        if (std::fabs(1 - range_mid / cut) < rel_tol)
+            break;
+        if (cut <= range_mid)
+            energy_hi = energy;
+        else
+            energy_lo = energy;
+        energy = std::sqrt(energy_lo * energy_hi);
+    }
+    return energy;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct by converting range cuts for every material.
+ */
+CutParams::CutParams(const ParticleParams& particles,
+                     const MaterialParams& materials,
+                     const Input&          inp)
+{
+    this->build(particles, materials, {inp});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct by converting the range cuts of every region and material.
+ */
+CutParams::CutParams(const ParticleParams& particles,
+                     const MaterialParams& materials,
+                     const RegionParams&   regions)
+{
+    VecInput region_cuts;
+    for (auto i : range(regions.num_regions()))
+    {
+        region_cuts.push_back(regions.cuts(RegionId(i)));
+    }
+    this->build(particles, materials, region_cuts);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert the range cuts of each region.
+ *
+ * As in Geant4, electron and positron thresholds below 30 keV are reduced for
+ * small cuts in thin materials. Materials without elements have the lowest
+ * threshold.
+ */
+void CutParams::build(const ParticleParams& particles,
+                      const MaterialParams& materials,
+                      const VecInput&       region_cuts)
+{
+    REQUIRE(!region_cuts.empty());
+    num_particles_ = particles.size();
+    num_materials_ = materials.num_materials();
+
+    struct CutInput
+    {
+        ParticleDefId particle;
+        ElementCoeff  coeff;
+        bool          integrate;
+        real_type Input::*range;
+    };
+    const CutInput cut_inputs[] = {
+        {particles.find(pdg::gamma()), calc_gamma_xs, false, &Input::gamma},
+        {particles.find(pdg::electron()),
+         [](int z, real_type e) { return calc_lepton_dedx(z, e, false); },
+         true,
+         &Input::electron},
+        {particles.find(pdg::positron()),
+         [](int z, real_type e) { return calc_lepton_dedx(z, e, true); },
+         true,
+         &Input::positron},
+    };
+
+    const MaterialParamsPointers mat_ptrs = materials.host_pointers();
+    host_energy_.assign(
+        region_cuts.size() * num_materials_ * num_particles_, 0);
+    host_range_.assign(host_energy_.size(), 0);
+
+    const CutGrid grid;
+    size_type     offset = 0;
+    for (const Input& inp : region_cuts)
+    {
+        REQUIRE(inp.gamma > 0 && inp.electron > 0 && inp.positron > 0);
+        for (auto mat_idx : range(num_materials_))
+        {
+            const MaterialView mat(mat_ptrs, MaterialDefId(mat_idx));
+            for (const CutInput& ci : cut_inputs)
+            {
+                if (!ci.particle)
+                    continue;
+
+                const real_type range_cut = inp.*ci.range;
+                real_type       energy    = CutParams::min_energy().value();
+                if (mat.num_elements() > 0)
+                {
+                    energy = convert_range_cut(
+                        grid,
+                        calc_ranges(grid, mat, ci.coeff, ci.integrate),
+                        range_cut);
+
+                    // Low-energy correction for thin materials
+                    constexpr real_type tune    = 0.025 * units::millimeter;
+                    constexpr real_type low_cut = 30e-3;
+                    if (ci.integrate && energy < low_cut)
+                    {
+                        energy /= 1
+                                  + (1 - energy / low_cut) * tune
+                                        / (range_cut * mat.density());
+                    }
+                    energy = std::min(std::max(energy, min_energy().value()),
+                                      max_energy().value());
+                }
+
+                host_energy_[offset + ci.particle.get()] = energy;
+                host_range_[offset + ci.particle.get()]  = range_cut;
+            }
+            offset += num_particles_;
+        }
+    }
+
+    if (celeritas::is_device_enabled())
+    {
+        device_energy_ = DeviceVector<real_type>(host_energy_.size());
+        device_energy_.copy_to_device(make_span(host_energy_));
+        device_range_ = DeviceVector<real_type>(host_range_.size());
+        device_range_.copy_to_device(make_span(host_range_));
+    }
+
+    ENSURE(offset == host_energy_.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access cuts on the host.
+ */
+CutParamsPointers CutParams::host_pointers() const
+{
+    CutParamsPointers result;
+    result.num_particles = num_particles_;
+    result.num_materials = num_materials_;
+    result.energy        = make_span(host_energy_);
+    result.range         = make_span(host_range_);
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access cuts on the device.
+ */
+CutParamsPointers CutParams::device_pointers() const
+{
+    REQUIRE(!device_energy_.empty());
+    CutParamsPointers result;
+    result.num_particles = num_particles_;
+    result.num_materials = num_materials_;
+    result.energy        = device_energy_.device_pointers();
+    result.range         = device_range_.device_pointers();
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
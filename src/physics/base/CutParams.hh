@@ -0,0 +1,97 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CutParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+#include "base/DeviceVector.hh"
+#include "base/Types.hh"
+#include "base/Units.hh"
+#include "physics/material/MaterialParams.hh"
+#include "CutParamsPointers.hh"
+#include "ParticleParams.hh"
+#include "Units.hh"
+
+namespace celeritas
+{
+class RegionParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Production cuts for secondary photons, electrons, and positrons.
+ *
+ * A range cut is converted to a production threshold energy in each material
+ * with the approximate elemental stopping powers (electrons and positrons)
+ * and absorption cross sections (photons) of Geant4 10's range-to-energy
+ * converters, using the same energy grid, range integration, and bisection.
+ * The energy of a charged particle is the one whose approximate
+ * continuous-slowing-down range equals the cut; the energy of a photon is the
+ * one whose absorption length is a fifth of the cut. Thresholds are bounded by
+ * the converter's energy grid.
+ *
+ * Cuts can be given for a single region or for every region of a \c
+ * RegionParams, in which case they are stored as [region][material][particle].
+ * Particle types that are absent from the \c ParticleParams are ignored.
+ */
+class CutParams
+{
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
+    //! Input data to construct this class
+    struct Input
+    {
+        real_type gamma    = 0.7 * units::millimeter; //!< Photon cut [cm]
+        real_type electron = 0.7 * units::millimeter; //!< Electron cut [cm]
+        real_type positron = 0.7 * units::millimeter; //!< Positron cut [cm]
+    };
+
+  public:
+    // Construct by converting range cuts for every material
+    CutParams(const ParticleParams& particles,
+              const MaterialParams& materials,
+              const Input&          inp);
+
+    // Construct by converting the range cuts of every region and material
+    CutParams(const ParticleParams& particles,
+              const MaterialParams& materials,
+              const RegionParams&   regions);
+
+    //! Lowest production threshold
+    static MevEnergy min_energy() { return MevEnergy{0.99e-3}; }
+
+    //! Highest production threshold
+    static MevEnergy max_energy() { return MevEnergy{1e4}; }
+
+    // Access cuts on the host
+    CutParamsPointers host_pointers() const;
+
+    // Access cuts on the device
+    CutParamsPointers device_pointers() const;
+
+  private:
+    using VecInput = std::vector<Input>;
+
+    size_type              num_particles_;
+    size_type              num_materials_;
+    std::vector<real_type> host_energy_;
+    std::vector<real_type> host_range_;
+
+    DeviceVector<real_type> device_energy_;
+    DeviceVector<real_type> device_range_;
+
+    // Convert the range cuts of each region
+    void build(const ParticleParams& particles,
+               const MaterialParams& materials,
+               const VecInput&       region_cuts);
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
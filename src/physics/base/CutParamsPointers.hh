@@ -0,0 +1,48 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CutParamsPointers.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Production thresholds for secondaries, all materials.
+ *
+ * The energy and range cuts are indexed as [region][material][particle].
+ * Particles without production cuts have zero thresholds.
+ *
+ * \sa CutParams (owns the pointed-to data)
+ * \sa CutView (accesses the cuts of a single material)
+ */
+struct CutParamsPointers
+{
+    size_type             num_particles = 0;
+    size_type             num_materials = 0;
+    Span<const real_type> energy; //!< Production threshold [MeV]
+    Span<const real_type> range;  //!< Range cut [cm]
+
+    //! Check whether the interface is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return num_particles > 0 && num_materials > 0 && !energy.empty()
+               && range.size() == energy.size();
+    }
+
+    //! Number of regions
+    CELER_FUNCTION size_type num_regions() const
+    {
+        return energy.size() / (num_materials * num_particles);
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,66 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CutView.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/material/Types.hh"
+#include "CutParamsPointers.hh"
+#include "Types.hh"
+#include "Units.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Access the production cuts of a material in a region.
+ *
+ * Interactors should not create secondaries below the production threshold
+ * of their particle type; the energy is instead deposited locally or (for
+ * continuous processes) included in the restricted stopping power.
+ *
+ * \code
+    CutView cuts(cut_pointers, region.region_id(), material.def_id());
+    if (secondary_energy > cuts.energy(shared.electron_id)) { ... }
+   \endcode
+ */
+class CutView
+{
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
+  public:
+    // Construct from cut data, region, and material
+    inline CELER_FUNCTION CutView(const CutParamsPointers& params,
+                                  RegionId                 region,
+                                  MaterialDefId            material);
+
+    // Construct from cut data and material in the default region
+    inline CELER_FUNCTION CutView(const CutParamsPointers& params,
+                                  MaterialDefId            material);
+
+    // Production threshold energy
+    inline CELER_FUNCTION MevEnergy energy(ParticleDefId particle) const;
+
+    // Range cut [cm]
+    inline CELER_FUNCTION real_type range(ParticleDefId particle) const;
+
+  private:
+    const CutParamsPointers& params_;
+    const size_type          offset_;
+
+    inline CELER_FUNCTION size_type index(ParticleDefId particle) const;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "CutView.i.hh"
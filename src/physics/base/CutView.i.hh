@@ -0,0 +1,72 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CutView.i.hh
+//---------------------------------------------------------------------------//
+
+#include "base/Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from cut data, region, and material.
+ */
+CELER_FUNCTION
+CutView::CutView(const CutParamsPointers& params,
+                 RegionId                 region,
+                 MaterialDefId            material)
+    : params_(params)
+    , offset_((region.get() * params.num_materials + material.get())
+              * params.num_particles)
+{
+    REQUIRE(params_);
+    REQUIRE(region < params_.num_regions());
+    REQUIRE(material < params_.num_materials);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from cut data and material in the default region.
+ */
+CELER_FUNCTION
+CutView::CutView(const CutParamsPointers& params, MaterialDefId material)
+    : CutView(params, RegionId{0}, material)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Production threshold energy.
+ */
+CELER_FUNCTION auto CutView::energy(ParticleDefId particle) const
+    -> MevEnergy
+{
+    return MevEnergy{params_.energy[this->index(particle)]};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Range cut [cm].
+ */
+CELER_FUNCTION real_type CutView::range(ParticleDefId particle) const
+{
+    return params_.range[this->index(particle)];
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE METHODS
+//---------------------------------------------------------------------------//
+/*!
+ * Index of a particle's cut for this material.
+ */
+CELER_FUNCTION size_type CutView::index(ParticleDefId particle) const
+{
+    REQUIRE(particle < params_.num_particles);
+    return offset_ + particle.get();
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
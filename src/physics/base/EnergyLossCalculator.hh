@@ -0,0 +1,59 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EnergyLossCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "base/UniformGrid.hh"
+#include "physics/material/MaterialTrackView.hh"
+#include "EnergyLossParamsPointers.hh"
+#include "Types.hh"
+#include "Units.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Find and interpolate the restricted stopping power.
+ *
+ * The tabulated stopping power is scaled by the density of the track's
+ * material.
+ *
+ * \code
+    EnergyLossCalculator calc_dedx(loss_tables, particle.def_id(), material);
+    real_type dedx = calc_dedx(particle.energy());
+   \endcode
+ */
+class EnergyLossCalculator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
+  public:
+    // Construct from tables, particle type, and material
+    inline CELER_FUNCTION
+    EnergyLossCalculator(const EnergyLossParamsPointers& data,
+                         ParticleDefId                   particle,
+                         const MaterialTrackView&        material);
+
+    // Stopping power [MeV/cm] at the given energy
+    inline CELER_FUNCTION real_type operator()(MevEnergy energy) const;
+
+  private:
+    UniformGrid      loge_grid_;
+    const real_type* dedx_;
+    real_type        density_scale_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "EnergyLossCalculator.i.hh"
@@ -0,0 +1,40 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EnergyLossCalculator.i.hh
+//---------------------------------------------------------------------------//
+
+#include "base/Assert.hh"
+#include "detail/EnergyLossUtils.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from tables, particle type, and material.
+ */
+CELER_FUNCTION
+EnergyLossCalculator::EnergyLossCalculator(const EnergyLossParamsPointers& data,
+                                           ParticleDefId particle,
+                                           const MaterialTrackView& material)
+    : loge_grid_(data.log_energy)
+    , dedx_(data.dedx.data() + data.row_offset(particle, material.def_id()))
+    , density_scale_(material.density_scale())
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Stopping power [MeV/cm] at the given energy.
+ */
+CELER_FUNCTION real_type
+EnergyLossCalculator::operator()(MevEnergy energy) const
+{
+    return detail::interp_energy_loss(loge_grid_, dedx_, energy.value())
+           * density_scale_;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,241 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EnergyLossParams.cc
+//---------------------------------------------------------------------------//
+#include "EnergyLossParams.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "base/Range.hh"
+#include "comm/Device.hh"
+#include "detail/EnergyLossUtils.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//// HELPER FUNCTIONS ////
+//---------------------------------------------------------------------------//
+/*!
+ * Integrate the inverse stopping power to get the range at each grid point.
+ *
+ * This follows Geant4's G4LossTableBuilder: the stopping power below the
+ * first grid point is assumed proportional to the velocity, and each grid
+ * interval is integrated with the midpoint rule over equal energy
+ * subintervals, with the stopping power linearly interpolated in energy.
+ *
+ * A material with no stopping power at all (e.g. vacuum) has no continuous
+ * loss, so its range is infinite. Otherwise the stopping power must be
+ * positive everywhere.
+ */
+void integrate_range(const UniformGrid&      loge_grid,
+                     Span<const real_type>   dedx,
+                     std::vector<real_type>* result)
+{
+    constexpr size_type num_substeps = 100;
+
+    if (std::all_of(
+            dedx.begin(), dedx.end(), [](real_type v) { return v == 0; }))
+    {
+        result->insert(result->end(),
+                       dedx.size(),
+                       std::numeric_limits<real_type>::infinity());
+        return;
+    }
+    REQUIRE(std::all_of(
+        dedx.begin(), dedx.end(), [](real_type v) { return v > 0; }));
+
+    real_type energy_lo = std::exp(loge_grid.front());
+    real_type accum     = 2 * energy_lo / dedx[0];
+    result->push_back(accum);
+
+    for (auto i : range(size_type(1), loge_grid.size()))
+    {
+        const real_type energy_hi = std::exp(loge_grid[i]);
+        const real_type delta     = (energy_hi - energy_lo) / num_substeps;
+        const real_type slope     = (dedx[i] - dedx[i - 1])
+                                / (energy_hi - energy_lo);
+        for (auto j : range(num_substeps))
+        {
+            // Stopping power at the midpoint of the subinterval
+            const real_type loss = dedx[i - 1] + slope * (j + 0.5) * delta;
+            accum += delta / loss;
+        }
+        result->push_back(accum);
+        energy_lo = energy_hi;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the maximum cross section over the energies reachable in a step.
+ *
+ * The cross section is piecewise linear in energy, so the maximum over the
+ * interval \f$ [f E_i, E_{i+1}] \f$ is the larger of the value at the lower
+ * end and the values at the grid points inside it.
+ */
+void calc_max_xs(const UniformGrid&      loge_grid,
+                 Span<const real_type>   xs,
+                 real_type               fraction,
+                 std::vector<real_type>* result)
+{
+    const size_type num_points = loge_grid.size();
+    for (auto i : range(num_points))
+    {
+        const real_type energy_lo = fraction * std::exp(loge_grid[i]);
+        const size_type end       = std::min(i + 2, num_points);
+
+        real_type xs_max = detail::interp_xs(loge_grid, xs.data(), energy_lo);
+        for (size_type j = end; j > 0 && std::exp(loge_grid[j - 1]) > energy_lo;
+             --j)
+        {
+            xs_max = std::max(xs_max, xs[j - 1]);
+        }
+        result->push_back(xs_max);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct by integrating the stopping power for every material.
+ */
+EnergyLossParams::EnergyLossParams(const MaterialParams& materials,
+                                   const Input&          inp)
+{
+    REQUIRE(inp.log_energy);
+    REQUIRE(!inp.particles.empty());
+    REQUIRE(inp.max_step_over_range > 0 && inp.max_step_over_range <= 1);
+    REQUIRE(inp.min_step > 0);
+    REQUIRE(inp.linear_loss_limit > 0 && inp.linear_loss_limit < 1);
+    REQUIRE(inp.min_energy_fraction > 0 && inp.min_energy_fraction < 1);
+
+    const UniformGrid loge_grid(inp.log_energy);
+    const size_type   num_materials = materials.num_materials();
+    const size_type   row_size      = loge_grid.size();
+
+    host_dedx_.reserve(inp.particles.size() * num_materials * row_size);
+    host_range_.reserve(host_dedx_.capacity());
+    host_xs_.reserve(host_dedx_.capacity());
+    host_xs_max_.reserve(host_dedx_.capacity());
+
+    for (auto table_idx : range(inp.particles.size()))
+    {
+        const ParticleInput& pinp = inp.particles[table_idx];
+        REQUIRE(pinp.particle);
+        REQUIRE(pinp.dedx.size() == num_materials * row_size);
+        REQUIRE(std::all_of(pinp.dedx.begin(),
+                            pinp.dedx.end(),
+                            [](real_type v) { return v >= 0; }));
+
+        // Map the particle to its table
+        if (!(pinp.particle < host_particle_tables_.size()))
+        {
+            host_particle_tables_.resize(pinp.particle.get() + 1);
+        }
+        REQUIRE(!host_particle_tables_[pinp.particle.get()]);
+        host_particle_tables_[pinp.particle.get()]
+            = EnergyLossTableId(table_idx);
+
+        host_dedx_.insert(host_dedx_.end(), pinp.dedx.begin(), pinp.dedx.end());
+        for (auto mat_idx : range(num_materials))
+        {
+            integrate_range(
+                loge_grid,
+                make_span(pinp.dedx).subspan(mat_idx * row_size, row_size),
+                &host_range_);
+        }
+
+        // Particles without discrete processes never interact
+        REQUIRE(pinp.xs.empty() || pinp.xs.size() == pinp.dedx.size());
+        REQUIRE(std::all_of(pinp.xs.begin(),
+                            pinp.xs.end(),
+                            [](real_type v) { return v >= 0; }));
+        if (pinp.xs.empty())
+        {
+            host_xs_.resize(host_dedx_.size(), 0);
+            host_xs_max_.resize(host_dedx_.size(), 0);
+            continue;
+        }
+        host_xs_.insert(host_xs_.end(), pinp.xs.begin(), pinp.xs.end());
+        for (auto mat_idx : range(num_materials))
+        {
+            calc_max_xs(
+                loge_grid,
+                make_span(pinp.xs).subspan(mat_idx * row_size, row_size),
+                inp.min_energy_fraction,
+                &host_xs_max_);
+        }
+    }
+
+    scalars_.log_energy          = inp.log_energy;
+    scalars_.num_materials       = num_materials;
+    scalars_.max_step_over_range = inp.max_step_over_range;
+    scalars_.min_step            = inp.min_step;
+    scalars_.linear_loss_limit   = inp.linear_loss_limit;
+    scalars_.min_energy_fraction = inp.min_energy_fraction;
+
+    if (celeritas::is_device_enabled())
+    {
+        device_particle_tables_ = DeviceVector<EnergyLossTableId>(
+            host_particle_tables_.size());
+        device_particle_tables_.copy_to_device(
+            make_span(host_particle_tables_));
+        device_dedx_ = DeviceVector<real_type>(host_dedx_.size());
+        device_dedx_.copy_to_device(make_span(host_dedx_));
+        device_range_ = DeviceVector<real_type>(host_range_.size());
+        device_range_.copy_to_device(make_span(host_range_));
+        device_xs_ = DeviceVector<real_type>(host_xs_.size());
+        device_xs_.copy_to_device(make_span(host_xs_));
+        device_xs_max_ = DeviceVector<real_type>(host_xs_max_.size());
+        device_xs_max_.copy_to_device(make_span(host_xs_max_));
+    }
+
+    ENSURE(host_range_.size() == host_dedx_.size());
+    ENSURE(host_xs_max_.size() == host_xs_.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access tables on the host.
+ */
+EnergyLossParamsPointers EnergyLossParams::host_pointers() const
+{
+    EnergyLossParamsPointers result = scalars_;
+    result.particle_tables          = make_span(host_particle_tables_);
+    result.dedx                     = make_span(host_dedx_);
+    result.range                    = make_span(host_range_);
+    result.xs                       = make_span(host_xs_);
+    result.xs_max                   = make_span(host_xs_max_);
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access tables on the device.
+ */
+EnergyLossParamsPointers EnergyLossParams::device_pointers() const
+{
+    REQUIRE(!device_dedx_.empty());
+    EnergyLossParamsPointers result = scalars_;
+    result.particle_tables          = device_particle_tables_.device_pointers();
+    result.dedx                     = device_dedx_.device_pointers();
+    result.range                    = device_range_.device_pointers();
+    result.xs                       = device_xs_.device_pointers();
+    result.xs_max                   = device_xs_max_.device_pointers();
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,93 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EnergyLossParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+#include "base/DeviceVector.hh"
+#include "base/Types.hh"
+#include "base/UniformGrid.hh"
+#include "base/Units.hh"
+#include "physics/material/MaterialParams.hh"
+#include "EnergyLossParamsPointers.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Stopping power, range, and inverse range tables for charged particles.
+ *
+ * The input is the total restricted stopping power of each charged particle
+ * in each material, summed over the energy loss processes (the \c
+ * energy_loss grids of \c Process::StepLimitBuilders), on a common grid
+ * uniform in log energy. The range is integrated once here so that transport
+ * kernels can limit the step and compute the energy after a step with table
+ * lookups rather than integrating the stopping power. The stopping power of
+ * a material must be either positive at every grid point or zero everywhere:
+ * in the latter case (e.g. vacuum) there is no continuous loss and the range
+ * is infinite.
+ *
+ * The total cross section of the particle's discrete (post-step) processes can
+ * be given on the same grid. Since the cross section changes as the particle
+ * loses energy along a step, the "integral approach" samples the distance to
+ * interaction with an upper bound of the cross section over the step and
+ * accepts the interaction at the post-step energy with the ratio of the
+ * actual cross section to the bound. The bounds are tabulated here.
+ *
+ * The step limitation defaults are the Geant4 values for electrons, and the
+ * minimum post-step energy fraction is Geant4's \c lambdaFactor.
+ */
+class EnergyLossParams
+{
+  public:
+    //! Stopping power of a single particle type
+    struct ParticleInput
+    {
+        ParticleDefId          particle;
+        std::vector<real_type> dedx; //!< [material][energy] [MeV/cm]
+        std::vector<real_type> xs;   //!< [material][energy] [1/cm], optional
+    };
+
+    //! Input data to construct this class
+    struct Input
+    {
+        UniformGrid::Params        log_energy; //!< Energy grid [ln MeV]
+        std::vector<ParticleInput> particles;
+        real_type max_step_over_range = 0.2;
+        real_type min_step            = 1 * units::millimeter;
+        real_type linear_loss_limit   = 0.01;
+        real_type min_energy_fraction = 0.8;
+    };
+
+  public:
+    // Construct by integrating the stopping power for every material
+    EnergyLossParams(const MaterialParams& materials, const Input& inp);
+
+    // Access tables on the host
+    EnergyLossParamsPointers host_pointers() const;
+
+    // Access tables on the device
+    EnergyLossParamsPointers device_pointers() const;
+
+  private:
+    EnergyLossParamsPointers       scalars_;
+    std::vector<EnergyLossTableId> host_particle_tables_;
+    std::vector<real_type>         host_dedx_;
+    std::vector<real_type>         host_range_;
+    std::vector<real_type>         host_xs_;
+    std::vector<real_type>         host_xs_max_;
+
+    DeviceVector<EnergyLossTableId> device_particle_tables_;
+    DeviceVector<real_type>         device_dedx_;
+    DeviceVector<real_type>         device_range_;
+    DeviceVector<real_type>         device_xs_;
+    DeviceVector<real_type>         device_xs_max_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
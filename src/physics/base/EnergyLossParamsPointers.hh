@@ -0,0 +1,74 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EnergyLossParamsPointers.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Assert.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "base/UniformGrid.hh"
+#include "physics/material/Types.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulated continuous energy loss for charged particles, all materials.
+ *
+ * The restricted stopping power and the range are stored at every point of a
+ * uniform grid in \f$ \ln(E / \mathrm{MeV}) \f$, indexed as
+ * [table][material][energy]. Since the range is strictly increasing with
+ * energy, the range row doubles as the (nonuniform) grid of the inverse range
+ * table, whose values are the grid energies.
+ *
+ * The total discrete cross section is stored on the same grid, along with its
+ * maximum ("lambda max") over each grid interval \f$ [E_i, E_{i+1}) \f$
+ * extended down to \f$ f E_i \f$, where \f$ f \f$ is the minimum fraction
+ * of the pre-step energy that remains after a step. The maximum at the last
+ * grid point extends upward without bound.
+ *
+ * \sa EnergyLossParams (owns the pointed-to data)
+ */
+struct EnergyLossParamsPointers
+{
+    UniformGrid::Params           log_energy;      //!< Energy grid [ln MeV]
+    Span<const EnergyLossTableId> particle_tables; //!< Table [particle]
+    size_type                     num_materials = 0;
+    Span<const real_type>         dedx;   //!< Stopping power [MeV/cm]
+    Span<const real_type>         range;  //!< Range [cm]
+    Span<const real_type>         xs;     //!< Discrete cross section [1/cm]
+    Span<const real_type>         xs_max; //!< Bound over a step [1/cm]
+
+    real_type max_step_over_range = 0; //!< Step limit as a range fraction
+    real_type min_step            = 0; //!< Final range step limit [cm]
+    real_type linear_loss_limit   = 0; //!< Max loss fraction for dE/dx*step
+    real_type min_energy_fraction = 0; //!< Lowest post-step energy fraction
+
+    //! Check whether the interface is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return log_energy && num_materials > 0 && !dedx.empty()
+               && range.size() == dedx.size() && xs.size() == dedx.size()
+               && xs_max.size() == dedx.size();
+    }
+
+    //! Start of the row of a particle and material in the value arrays
+    CELER_FUNCTION size_type row_offset(ParticleDefId particle,
+                                        MaterialDefId material) const
+    {
+        REQUIRE(particle < particle_tables.size());
+        REQUIRE(material < num_materials);
+        EnergyLossTableId table = particle_tables[particle.get()];
+        REQUIRE(table);
+        return (table.get() * num_materials + material.get())
+               * log_energy.size;
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
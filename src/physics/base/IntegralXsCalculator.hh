@@ -0,0 +1,76 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file IntegralXsCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "base/UniformGrid.hh"
+#include "physics/material/MaterialTrackView.hh"
+#include "EnergyLossParamsPointers.hh"
+#include "Types.hh"
+#include "Units.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sample discrete interactions of a charged particle with the integral method.
+ *
+ * The distance to interaction is sampled from the upper bound of the cross
+ * section over the step, and at the end of the step the interaction is
+ * accepted with the ratio of the cross section at the post-step energy to the
+ * bound. This is unbiased as long as the post-step energy is at least the
+ * minimum energy fraction of the pre-step energy; the range step limiter
+ * normally guarantees this, and if the bound is exceeded the interaction is
+ * always accepted. Both the cross section and its bound are scaled by the
+ * density of the track's material.
+ *
+ * \code
+    IntegralXsCalculator calc_xs(loss_tables, particle.def_id(), material);
+    real_type xs_max = calc_xs.max_xs(particle.energy());
+    // ... sample distance with xs_max, take step, lose energy ...
+    if (calc_xs.accept(particle.energy(), xs_max, rng)) { ... }
+   \endcode
+ */
+class IntegralXsCalculator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
+  public:
+    // Construct from tables, particle type, and material
+    inline CELER_FUNCTION
+    IntegralXsCalculator(const EnergyLossParamsPointers& data,
+                         ParticleDefId                   particle,
+                         const MaterialTrackView&        material);
+
+    // Discrete cross section [1/cm] at the given energy
+    inline CELER_FUNCTION real_type operator()(MevEnergy energy) const;
+
+    // Bound [1/cm] on the cross section over a step from the given energy
+    inline CELER_FUNCTION real_type max_xs(MevEnergy energy) const;
+
+    // Whether to interact at the post-step energy
+    template<class Engine>
+    inline CELER_FUNCTION bool
+    accept(MevEnergy post_energy, real_type max_xs, Engine& rng) const;
+
+  private:
+    UniformGrid      loge_grid_;
+    const real_type* xs_;
+    const real_type* xs_max_;
+    real_type        density_scale_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "IntegralXsCalculator.i.hh"
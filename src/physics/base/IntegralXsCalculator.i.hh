@@ -0,0 +1,79 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file IntegralXsCalculator.i.hh
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include "base/Assert.hh"
+#include "random/distributions/GenerateCanonical.hh"
+#include "detail/EnergyLossUtils.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from tables, particle type, and material.
+ */
+CELER_FUNCTION
+IntegralXsCalculator::IntegralXsCalculator(const EnergyLossParamsPointers& data,
+                                           ParticleDefId particle,
+                                           const MaterialTrackView& material)
+    : loge_grid_(data.log_energy), density_scale_(material.density_scale())
+{
+    const size_type offset = data.row_offset(particle, material.def_id());
+    xs_                    = data.xs.data() + offset;
+    xs_max_                = data.xs_max.data() + offset;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Discrete cross section [1/cm] at the given energy.
+ */
+CELER_FUNCTION real_type
+IntegralXsCalculator::operator()(MevEnergy energy) const
+{
+    return detail::interp_xs(loge_grid_, xs_, energy.value()) * density_scale_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Bound [1/cm] on the cross section over a step from the given energy.
+ *
+ * This is the tabulated maximum of the grid interval containing the energy,
+ * or of the nearest end point outside the grid.
+ */
+CELER_FUNCTION real_type IntegralXsCalculator::max_xs(MevEnergy energy) const
+{
+    REQUIRE(energy.value() > 0);
+    const real_type loge = std::log(energy.value());
+    if (loge < loge_grid_.front())
+    {
+        return xs_max_[0] * density_scale_;
+    }
+    else if (loge >= loge_grid_.back())
+    {
+        return xs_max_[loge_grid_.size() - 1] * density_scale_;
+    }
+    return xs_max_[loge_grid_.find(loge)] * density_scale_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether to interact at the post-step energy.
+ *
+ * The bound must be the one calculated at the pre-step energy.
+ */
+template<class Engine>
+CELER_FUNCTION bool IntegralXsCalculator::accept(MevEnergy post_energy,
+                                                 real_type max_xs,
+                                                 Engine&   rng) const
+{
+    REQUIRE(max_xs > 0);
+    return generate_canonical(rng) * max_xs < (*this)(post_energy);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
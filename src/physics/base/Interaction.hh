@@ -11,7 +11,7 @@
 #include "base/Span.hh"
 #include "base/Types.hh"
 #include "sim/Action.hh"
-#include "Secondary.hh"
+#include "PackedSecondary.hh"
 
 namespace celeritas
 {
@@ -21,10 +21,10 @@ namespace celeritas
  */
 struct Interaction
 {
-    Action           action;      //!< Failure, scatter, absorption, ...
-    units::MevEnergy energy;      //!< Post-interaction energy
-    Real3            direction;   //!< Post-interaction direction
-    Span<Secondary>  secondaries; //!< Emitted secondaries
+    Action                action;      //!< Failure, scatter, absorption, ...
+    units::MevEnergy      energy;      //!< Post-interaction energy
+    Real3                 direction;   //!< Post-interaction direction
+    Span<SecondaryRecord> secondaries; //!< Emitted secondaries
     units::MevEnergy energy_deposition; //!< Energy loss locally to material
 
     // Return an interaction representing a recoverable error
@@ -0,0 +1,56 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file InteractionDriver.cuda.hh
+//! Fused interaction kernel; include only from CUDA translation units
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/KernelParamCalculator.cuda.hh"
+#include "random/cuda/RngEngine.hh"
+#include "InteractionDriver.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Interact every track with its selected model in a single kernel.
+ */
+template<class Dispatcher>
+__global__ void fused_interact_kernel(const Dispatcher            dispatch,
+                                      const ModelInteractPointers ptrs)
+{
+    auto thread = KernelParamCalculator::thread_id();
+    if (thread.get() >= ptrs.num_threads())
+        return;
+
+    RngEngine rng(ptrs.states.rng, ptrs.track_slot(thread));
+    interact_track(dispatch, ptrs, thread, rng);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Launch the fused interaction kernel over all device-resident tracks.
+ *
+ * No kernel is launched for an empty model partition.
+ */
+template<class Dispatcher>
+void device_interact(const Dispatcher&            dispatch,
+                     const ModelInteractPointers& ptrs)
+{
+    REQUIRE(ptrs);
+    if (ptrs.num_threads() == 0)
+        return;
+
+    KernelParamCalculator calc_kernel_params;
+    auto                  params = calc_kernel_params(ptrs.num_threads());
+    fused_interact_kernel<<<params.grid_size, params.block_size>>>(dispatch,
+                                                                   ptrs);
+
+    CELER_CUDA_CHECK_ERROR();
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,126 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file InteractionDriver.hh
+//! Apply several models' interactions in a single pass over the tracks
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Assert.hh"
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/material/MaterialTrackView.hh"
+#include "ModelInterface.hh"
+#include "ParticleTrackView.hh"
+#include "PhysicsTrackView.hh"
+#include "SecondaryAllocatorView.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Per-track state shared by every model launcher.
+ *
+ * The particle view, direction, and secondary allocator are constructed once
+ * per track by \c interact_track and passed to whichever launcher handles the
+ * track's selected model. Material access is deferred: only launchers that
+ * need it (e.g. to sample an element) call \c material() , so models such as
+ * Klein-Nishina never touch the material state.
+ */
+struct ModelInteractTrack
+{
+    const ParticleTrackView&      particle;
+    const Real3&                  direction;
+    SecondaryAllocatorView&       allocate;
+    const MaterialParamsPointers& material_params;
+    const MaterialStatePointers&  material_states;
+    ThreadId                      tid;
+
+    //! Construct a view to the track's material
+    CELER_FUNCTION MaterialTrackView material() const
+    {
+        return MaterialTrackView(material_params, material_states, tid);
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Interact a single track with its selected model
+template<class Dispatcher, class Engine>
+inline CELER_FUNCTION void interact_track(const Dispatcher&            dispatch,
+                                          const ModelInteractPointers& ptrs,
+                                          ThreadId                     thread,
+                                          Engine&                      rng);
+
+//---------------------------------------------------------------------------//
+// Interact all host-resident tracks with their selected models
+template<class Dispatcher, class Engine>
+inline void host_interact(const Dispatcher&            dispatch,
+                          const ModelInteractPointers& ptrs,
+                          Engine&                      rng);
+
+//---------------------------------------------------------------------------//
+// INLINE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Interact a single track with its selected model.
+ *
+ * The particle and physics state of the track is read once and the
+ * interaction is dispatched to the launcher matching the selected model.
+ * Tracks without a selected model, or whose model is not in the dispatcher's
+ * list, are left untouched.
+ */
+template<class Dispatcher, class Engine>
+CELER_FUNCTION void interact_track(const Dispatcher&            dispatch,
+                                   const ModelInteractPointers& ptrs,
+                                   ThreadId                     thread,
+                                   Engine&                      rng)
+{
+    REQUIRE(ptrs);
+    const ThreadId tid = ptrs.track_slot(thread);
+
+    // The model is already selected, so the physics view doesn't need the
+    // material
+    ParticleTrackView particle(ptrs.params.particle, ptrs.states.particle, tid);
+    PhysicsTrackView  physics(ptrs.params.physics,
+                             ptrs.states.physics,
+                             particle.def_id(),
+                             MaterialDefId{},
+                             tid);
+
+    const ModelId model_id = physics.model_id();
+    if (!model_id)
+        return;
+
+    SecondaryAllocatorView allocate(ptrs.secondaries);
+    ModelInteractTrack     track{particle,
+                              ptrs.states.direction[tid.get()],
+                              allocate,
+                              ptrs.params.material,
+                              ptrs.states.material,
+                              tid};
+    if (dispatch(model_id, track, rng, &ptrs.result[tid.get()]))
+    {
+        ENSURE(ptrs.result[tid.get()]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Interact all host-resident tracks with their selected models.
+ */
+template<class Dispatcher, class Engine>
+void host_interact(const Dispatcher&            dispatch,
+                   const ModelInteractPointers& ptrs,
+                   Engine&                      rng)
+{
+    REQUIRE(ptrs);
+    for (ThreadId::value_type i = 0; i != ptrs.num_threads(); ++i)
+    {
+        interact_track(dispatch, ptrs, ThreadId{i}, rng);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,65 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file InverseRangeCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "base/UniformGrid.hh"
+#include "physics/material/MaterialTrackView.hh"
+#include "EnergyLossParamsPointers.hh"
+#include "Types.hh"
+#include "Units.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Find the energy of a charged particle with the given range.
+ *
+ * This inverts the range table with a binary search over its (strictly
+ * increasing) values and linear interpolation in energy. Below the first grid
+ * point the range is proportional to \f$ \sqrt{E} \f$, consistent with \c
+ * RangeCalculator; above the last grid point the maximum energy is returned.
+ * The range is converted to the nominal density of the track's material
+ * before the lookup. The material must have a nonzero stopping power: the
+ * range table of a material without one (infinite range) is never inverted.
+ *
+ * \code
+    InverseRangeCalculator calc_energy(
+        loss_tables, particle.def_id(), material);
+    MevEnergy post_step_energy = calc_energy(range - step);
+   \endcode
+ */
+class InverseRangeCalculator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
+  public:
+    // Construct from tables, particle type, and material
+    inline CELER_FUNCTION
+    InverseRangeCalculator(const EnergyLossParamsPointers& data,
+                           ParticleDefId                   particle,
+                           const MaterialTrackView&        material);
+
+    // Energy of a particle with the given range [cm]
+    inline CELER_FUNCTION MevEnergy operator()(real_type range) const;
+
+  private:
+    UniformGrid      loge_grid_;
+    const real_type* range_;
+    real_type        density_scale_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "InverseRangeCalculator.i.hh"
@@ -0,0 +1,62 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file InverseRangeCalculator.i.hh
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include "base/Algorithms.hh"
+#include "base/Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from tables, particle type, and material.
+ */
+CELER_FUNCTION
+InverseRangeCalculator::InverseRangeCalculator(
+    const EnergyLossParamsPointers& data,
+    ParticleDefId                   particle,
+    const MaterialTrackView&        material)
+    : loge_grid_(data.log_energy)
+    , range_(data.range.data() + data.row_offset(particle, material.def_id()))
+    , density_scale_(material.density_scale())
+{
+    REQUIRE(range_[0] > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Energy of a particle with the given range [cm].
+ */
+CELER_FUNCTION auto InverseRangeCalculator::operator()(real_type range) const
+    -> MevEnergy
+{
+    REQUIRE(range >= 0);
+    range *= density_scale_;
+    const size_type size = loge_grid_.size();
+    if (range <= range_[0])
+    {
+        const real_type frac = range / range_[0];
+        return MevEnergy{std::exp(loge_grid_.front()) * frac * frac};
+    }
+    else if (range >= range_[size - 1])
+    {
+        return MevEnergy{std::exp(loge_grid_.back())};
+    }
+
+    const size_type bin
+        = celeritas::upper_bound(range_, range_ + size, range) - range_ - 1;
+    CHECK(bin + 1 < size);
+    const real_type energy_lo = std::exp(loge_grid_[bin]);
+    const real_type energy_hi = std::exp(loge_grid_[bin + 1]);
+    return MevEnergy{energy_lo
+                     + (range - range_[bin]) * (energy_hi - energy_lo)
+                           / (range_[bin + 1] - range_[bin])};
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
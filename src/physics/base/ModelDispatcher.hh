@@ -0,0 +1,132 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ModelDispatcher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "Interaction.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Dispatch an interaction to one of a compile-time list of model launchers.
+ *
+ * A launcher bundles a model's device data with the construction and
+ * invocation of its interactor. Each launcher type must provide:
+ * \code
+   CELER_FUNCTION ModelId model_id() const;
+
+   template<class Track, class Engine>
+   CELER_FUNCTION Interaction operator()(Track& track, Engine& rng) const;
+ * \endcode
+ *
+ * The dispatcher compares a track's model ID against each launcher in list
+ * order. The comparisons are unrolled at compile time into a chain of branches
+ * without virtual calls or function pointers, so the same dispatcher works on
+ * host and inside CUDA kernels.
+ *
+ * \code
+   ModelDispatcher<detail::KleinNishinaLauncher, detail::EPlusGGLauncher>
+       dispatch({kn_pointers}, {epgg_pointers});
+   bool applied = dispatch(physics.model_id(), track, rng, &result);
+ * \endcode
+ */
+template<class... Launchers>
+class ModelDispatcher;
+
+//---------------------------------------------------------------------------//
+/*!
+ * End of the launcher list: no model matched.
+ */
+template<>
+class ModelDispatcher<>
+{
+  public:
+    //! Number of models in the list
+    static CELER_CONSTEXPR_FUNCTION size_type size() { return 0; }
+
+    //! No launcher applies to any model
+    template<class Track, class Engine>
+    CELER_FUNCTION bool
+    operator()(ModelId, Track&, Engine&, Interaction*) const
+    {
+        return false;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Nonempty launcher list.
+ */
+template<class Launcher, class... Rest>
+class ModelDispatcher<Launcher, Rest...>
+{
+  public:
+    // Construct from one launcher for each model
+    inline CELER_FUNCTION ModelDispatcher(Launcher first, Rest... rest);
+
+    //! Number of models in the list
+    static CELER_CONSTEXPR_FUNCTION size_type size()
+    {
+        return 1 + sizeof...(Rest);
+    }
+
+    // Interact using the launcher for the given model
+    template<class Track, class Engine>
+    inline CELER_FUNCTION bool operator()(ModelId      id,
+                                          Track&       track,
+                                          Engine&      rng,
+                                          Interaction* result) const;
+
+  private:
+    Launcher                 first_;
+    ModelDispatcher<Rest...> rest_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from one launcher for each model.
+ */
+template<class Launcher, class... Rest>
+CELER_FUNCTION
+ModelDispatcher<Launcher, Rest...>::ModelDispatcher(Launcher first,
+                                                    Rest... rest)
+    : first_(first), rest_(rest...)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Interact using the launcher for the given model.
+ *
+ * The result is written and \c true returned only if one of the launchers
+ * handles the model; otherwise the result is left unchanged.
+ */
+template<class Launcher, class... Rest>
+template<class Track, class Engine>
+CELER_FUNCTION bool
+ModelDispatcher<Launcher, Rest...>::operator()(ModelId      id,
+                                               Track&       track,
+                                               Engine&      rng,
+                                               Interaction* result) const
+{
+    REQUIRE(result);
+    if (id == first_.model_id())
+    {
+        *result = first_(track, rng);
+        return true;
+    }
+    return rest_(id, track, rng, result);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -69,6 +69,10 @@ struct ModelInteractState
 //---------------------------------------------------------------------------//
 /*!
  * Input and output device data to a generic Model::interact call.
+ *
+ * If \c partitioned is set (see \c ModelPartitionStore), the interaction
+ * kernel is launched over only the slots listed in \c tracks rather than all
+ * of them; an empty list then launches no threads.
  */
 struct ModelInteractPointers
 {
@@ -76,12 +80,29 @@ struct ModelInteractPointers
     ModelInteractState         states;
     SecondaryAllocatorPointers secondaries;
     Span<Interaction>          result;
+    Span<const index_type>     tracks;
+    bool                       partitioned = false;
 
     //! True if valid
     CELER_FUNCTION operator bool() const
     {
         return params && states && secondaries && !result.empty();
     }
+
+    //! Number of kernel threads: one per listed track, or one per state
+    CELER_FUNCTION size_type num_threads() const
+    {
+        return partitioned ? tracks.size() : states.size();
+    }
+
+    //! Track slot operated on by the given kernel thread
+    CELER_FUNCTION ThreadId track_slot(ThreadId thread) const
+    {
+        REQUIRE(thread < this->num_threads());
+        return partitioned ? ThreadId{static_cast<ThreadId::value_type>(
+                                 tracks[thread.get()])}
+                           : thread;
+    }
 };
 
 //---------------------------------------------------------------------------//
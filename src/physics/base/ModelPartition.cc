@@ -0,0 +1,60 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ModelPartition.cc
+//---------------------------------------------------------------------------//
+#include "ModelPartition.hh"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include "base/Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Partition host-resident track slots by model with a counting sort.
+ *
+ * The sort is stable, so the slots within each model range are in increasing
+ * order. Tracks without a selected model are placed after the last range.
+ */
+void partition_by_model(const PhysicsStatePointers&   states,
+                        const ModelPartitionPointers& partition)
+{
+    REQUIRE(states);
+    REQUIRE(partition);
+    REQUIRE(partition.track_order.size() == states.size());
+
+    const size_type  num_models = partition.num_models();
+    Span<index_type> offsets    = partition.offsets;
+
+    // Count the tracks for each model, shifted by one
+    std::fill(offsets.begin(), offsets.end(), index_type(0));
+    for (const PhysicsTrackState& state : states.state)
+    {
+        if (state.model_id)
+        {
+            CHECK(state.model_id.get() < num_models);
+            ++offsets[state.model_id.get() + 1];
+        }
+    }
+
+    // Convert counts to the start of each range
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    // Scatter the track slots into their ranges
+    std::vector<index_type> next(offsets.begin(), offsets.end());
+    for (size_type slot = 0; slot != states.size(); ++slot)
+    {
+        ModelId     id  = states.state[slot].model_id;
+        index_type& dst = next[id ? id.get() : num_models];
+        partition.track_order[dst++] = slot;
+    }
+    ENSURE(next.back() == states.size());
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
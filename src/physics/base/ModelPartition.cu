@@ -0,0 +1,91 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ModelPartition.cu
+//---------------------------------------------------------------------------//
+#include "ModelPartition.hh"
+
+#include <thrust/binary_search.h>
+#include <thrust/device_ptr.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sort.h>
+#include "base/DeviceVector.hh"
+#include "base/KernelParamCalculator.cuda.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// KERNELS
+//---------------------------------------------------------------------------//
+/*!
+ * Write the sort key (model ID) and the slot index of each track.
+ *
+ * Tracks without a selected model are given a key past the last model so that
+ * they sort to the end.
+ */
+__global__ void model_keys_kernel(const PhysicsStatePointers states,
+                                  size_type                  num_models,
+                                  Span<index_type>           keys,
+                                  Span<index_type>           track_order)
+{
+    auto tid = KernelParamCalculator::thread_id();
+    if (tid.get() < states.size())
+    {
+        ModelId id             = states.state[tid.get()].model_id;
+        keys[tid.get()]        = id ? id.get() : num_models;
+        track_order[tid.get()] = tid.get();
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+// KERNEL INTERFACE
+//---------------------------------------------------------------------------//
+/*!
+ * Partition device-resident track slots by model.
+ *
+ * The slots are stably sorted on their model ID, which thrust performs as a
+ * parallel radix (counting) sort for integer keys. The start of each model's
+ * range is then found by a vectorized binary search on the sorted keys.
+ */
+void device_partition_by_model(const PhysicsStatePointers&   states,
+                               const ModelPartitionPointers& partition)
+{
+    REQUIRE(states);
+    REQUIRE(partition);
+    REQUIRE(partition.track_order.size() == states.size());
+
+    const size_type          num_models = partition.num_models();
+    DeviceVector<index_type> keys(states.size());
+
+    KernelParamCalculator calc_launch_params;
+    auto                  lparams = calc_launch_params(states.size());
+    model_keys_kernel<<<lparams.grid_size, lparams.block_size>>>(
+        states, num_models, keys.device_pointers(), partition.track_order);
+    CELER_CUDA_CHECK_ERROR();
+
+    auto key_begin = thrust::device_pointer_cast(keys.device_pointers().data());
+    auto key_end   = key_begin + keys.size();
+    thrust::stable_sort_by_key(
+        key_begin,
+        key_end,
+        thrust::device_pointer_cast(partition.track_order.data()));
+
+    thrust::lower_bound(
+        key_begin,
+        key_end,
+        thrust::counting_iterator<index_type>(0),
+        thrust::counting_iterator<index_type>(num_models + 1),
+        thrust::device_pointer_cast(partition.offsets.data()));
+
+    CELER_CUDA_CALL(cudaDeviceSynchronize());
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,27 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ModelPartition.hh
+//! Group track slots by the model selected for their next interaction
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "ModelPartitionPointers.hh"
+#include "PhysicsInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// Partition host-resident track slots by model with a counting sort
+void partition_by_model(const PhysicsStatePointers&   states,
+                        const ModelPartitionPointers& partition);
+
+//---------------------------------------------------------------------------//
+// Partition device-resident track slots by model with a stable radix sort
+void device_partition_by_model(const PhysicsStatePointers&   states,
+                               const ModelPartitionPointers& partition);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
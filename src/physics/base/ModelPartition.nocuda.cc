@@ -0,0 +1,22 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ModelPartition.nocuda.cc
+//---------------------------------------------------------------------------//
+#include "ModelPartition.hh"
+
+#include "base/Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+void device_partition_by_model(const PhysicsStatePointers&,
+                               const ModelPartitionPointers&)
+{
+    CHECK_UNREACHABLE;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,47 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ModelPartitionPointers.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Assert.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Track slots grouped by the model selected for their next interaction.
+ *
+ * \c track_order holds every track slot index, stably sorted by model ID.
+ * The slots that selected model \em m are
+ * \code track_order[offsets[m]], ..., track_order[offsets[m + 1] - 1]
+ * \endcode
+ * and tracks without a selected model follow the last range.
+ */
+struct ModelPartitionPointers
+{
+    Span<index_type> track_order; //!< Track slots sorted by model [track]
+    Span<index_type> offsets;     //!< Start of each model range [model + 1]
+
+    //! Whether the data are assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !track_order.empty() && offsets.size() >= 2;
+    }
+
+    //! Number of models being partitioned
+    CELER_FUNCTION size_type num_models() const
+    {
+        REQUIRE(*this);
+        return offsets.size() - 1;
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,97 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ModelPartitionStore.cc
+//---------------------------------------------------------------------------//
+#include "ModelPartitionStore.hh"
+
+#include "base/Assert.hh"
+#include "base/IndexCast.hh"
+#include "ModelPartition.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from number of track states and number of models.
+ *
+ * No tracks are assigned to any model until the first call to \c partition.
+ */
+ModelPartitionStore::ModelPartitionStore(size_type num_tracks,
+                                         size_type num_models)
+    : track_order_(checked_index_cast(num_tracks))
+    , offsets_(num_models + 1)
+    , host_offsets_(num_models + 1, 0)
+{
+    REQUIRE(num_tracks > 0);
+    REQUIRE(num_models > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Group the track slots by the model selected for each.
+ *
+ * The model ranges are copied back to the host so that kernel launches can be
+ * sized without further synchronization.
+ */
+void ModelPartitionStore::partition(const PhysicsStatePointers& states)
+{
+    REQUIRE(states.size() == this->num_tracks());
+
+    device_partition_by_model(states, this->device_pointers());
+    offsets_.copy_to_host(make_span(host_offsets_));
+
+    ENSURE(host_offsets_.front() == 0);
+    ENSURE(host_offsets_.back() <= this->num_tracks());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of tracks that selected the given model at the last partition.
+ */
+size_type ModelPartitionStore::num_tracks(ModelId id) const
+{
+    REQUIRE(id < this->num_models());
+    return host_offsets_[id.get() + 1] - host_offsets_[id.get()];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * On-device track slots that selected the given model at the last partition.
+ */
+Span<const index_type> ModelPartitionStore::device_tracks(ModelId id) const
+{
+    REQUIRE(id < this->num_models());
+    return track_order_.device_pointers().subspan(host_offsets_[id.get()],
+                                                  this->num_tracks(id));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the track slots, sorted by model at the last partition, to host.
+ */
+std::vector<index_type> ModelPartitionStore::host_track_order() const
+{
+    std::vector<index_type> result(track_order_.size());
+    track_order_.copy_to_host(make_span(result));
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * View to on-device data.
+ */
+ModelPartitionPointers ModelPartitionStore::device_pointers()
+{
+    ModelPartitionPointers result;
+    result.track_order = track_order_.device_pointers();
+    result.offsets     = offsets_.device_pointers();
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
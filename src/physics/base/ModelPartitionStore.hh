@@ -0,0 +1,71 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ModelPartitionStore.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+#include "base/DeviceVector.hh"
+#include "base/Types.hh"
+#include "ModelPartitionPointers.hh"
+#include "PhysicsInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Manage on-device grouping of track slots by selected model.
+ *
+ * After each call to \c partition, the slots for each model are contiguous on
+ * device and the model ranges are mirrored on host so that each model's
+ * interaction kernel can be launched over only its own tracks:
+ * \code
+   partition.partition(states.physics);
+   pointers.partitioned = true;
+   for (const auto& model : models)
+   {
+       pointers.tracks = partition.device_tracks(model->model_id());
+       model->interact(pointers);
+   }
+ * \endcode
+ */
+class ModelPartitionStore
+{
+  public:
+    // Construct from number of track states and number of models
+    ModelPartitionStore(size_type num_tracks, size_type num_models);
+
+    // Group the track slots by the model selected for each
+    void partition(const PhysicsStatePointers& states);
+
+    //// ACCESSORS ////
+
+    //! Number of track slots
+    size_type num_tracks() const { return track_order_.size(); }
+
+    //! Number of models
+    size_type num_models() const { return host_offsets_.size() - 1; }
+
+    // Number of tracks that selected the given model
+    size_type num_tracks(ModelId id) const;
+
+    // On-device track slots that selected the given model
+    Span<const index_type> device_tracks(ModelId id) const;
+
+    // Copy the sorted track slots to host (for diagnostics)
+    std::vector<index_type> host_track_order() const;
+
+    // View on-device data
+    ModelPartitionPointers device_pointers();
+
+  private:
+    DeviceVector<index_type> track_order_;
+    DeviceVector<index_type> offsets_;
+    std::vector<index_type>  host_offsets_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,99 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file PackedSecondary.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include "celeritas_config.h"
+#include "base/ArrayUtils.hh"
+#include "base/Types.hh"
+#include "Secondary.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Compact storage for a secondary particle.
+ *
+ * The energy is stored in single precision and the direction is encoded with
+ * \c pack_direction, reducing the record from 40 to 12 bytes. Conversions to
+ * and from \c Secondary are explicit since the round trip is lossy.
+ *
+ * When \c CELERITAS_COMPACT_INITIALIZERS is enabled, this is the record type
+ * stored by the secondary allocator: interactors build each \c Secondary
+ * locally and encode it on write, and \c process_secondaries decodes it.
+ */
+struct PackedSecondary
+{
+    ParticleDefId::value_type def_id;    //!< New particle type
+    float                     energy;    //!< New kinetic energy [MeV]
+    std::uint32_t             direction; //!< Octahedral-encoded direction
+
+    // Default to invalid state
+    CELER_FUNCTION PackedSecondary()
+        : def_id(ParticleDefId{}.unchecked_get()), energy(0), direction(0)
+    {
+    }
+
+    // Encode a secondary
+    explicit inline CELER_FUNCTION PackedSecondary(const Secondary& secondary);
+
+    // Decode to a secondary
+    explicit inline CELER_FUNCTION operator Secondary() const;
+
+    // Whether the secondary survived cutoffs
+    explicit inline CELER_FUNCTION operator bool() const;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Encode a secondary.
+ */
+CELER_FUNCTION PackedSecondary::PackedSecondary(const Secondary& secondary)
+    : def_id(secondary.def_id.unchecked_get())
+    , energy(static_cast<float>(secondary.energy.value()))
+    , direction(secondary ? pack_direction(secondary.direction) : 0)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Decode to a secondary.
+ */
+CELER_FUNCTION PackedSecondary::operator Secondary() const
+{
+    Secondary result;
+    if (*this)
+    {
+        result.def_id    = ParticleDefId{def_id};
+        result.energy    = units::MevEnergy{energy};
+        result.direction = unpack_direction(direction);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether the Secondary succeeded.
+ */
+CELER_FUNCTION PackedSecondary::operator bool() const
+{
+    return static_cast<bool>(ParticleDefId{def_id});
+}
+
+//---------------------------------------------------------------------------//
+//! Storage type for the secondary allocator
+#if CELERITAS_COMPACT_INITIALIZERS
+using SecondaryRecord = PackedSecondary;
+#else
+using SecondaryRecord = Secondary;
+#endif
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
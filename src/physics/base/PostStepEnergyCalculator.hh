@@ -0,0 +1,71 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file PostStepEnergyCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/material/MaterialTrackView.hh"
+#include "EnergyLossCalculator.hh"
+#include "EnergyLossParamsPointers.hh"
+#include "InverseRangeCalculator.hh"
+#include "Types.hh"
+#include "Units.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the energy of a charged particle after a step.
+ *
+ * If the energy lost at the pre-step stopping power is a small fraction of
+ * the energy (\c linear_loss_limit), the loss is linear in the step length.
+ * Otherwise the post-step energy is looked up from the inverse range table at
+ * the residual range, which is exact to the accuracy of the tables
+ * regardless of the step length. A step of at least the range stops the
+ * particle. In a material without stopping power the range is infinite and
+ * the energy is unchanged.
+ *
+ * The pre-step range must be the one from \c RangeCalculator, which is
+ * already needed to limit the step.
+ *
+ * \code
+    PostStepEnergyCalculator calc_energy(loss_tables, particle.def_id(),
+                                         material);
+    particle.energy(calc_energy(particle.energy(), range, step));
+   \endcode
+ */
+class PostStepEnergyCalculator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
+  public:
+    // Construct from tables, particle type, and material
+    inline CELER_FUNCTION
+    PostStepEnergyCalculator(const EnergyLossParamsPointers& data,
+                             ParticleDefId                   particle,
+                             const MaterialTrackView&        material);
+
+    // Energy after a step [cm] from the pre-step energy and range [cm]
+    inline CELER_FUNCTION MevEnergy operator()(MevEnergy energy,
+                                               real_type range,
+                                               real_type step) const;
+
+  private:
+    EnergyLossCalculator   calc_dedx_;
+    InverseRangeCalculator calc_energy_;
+    real_type              linear_loss_limit_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "PostStepEnergyCalculator.i.hh"
@@ -0,0 +1,54 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file PostStepEnergyCalculator.i.hh
+//---------------------------------------------------------------------------//
+
+#include "base/Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from tables, particle type, and material.
+ */
+CELER_FUNCTION PostStepEnergyCalculator::PostStepEnergyCalculator(
+    const EnergyLossParamsPointers& data,
+    ParticleDefId                   particle,
+    const MaterialTrackView&        material)
+    : calc_dedx_(data, particle, material)
+    , calc_energy_(data, particle, material)
+    , linear_loss_limit_(data.linear_loss_limit)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Energy after a step [cm] from the pre-step energy and range [cm].
+ */
+CELER_FUNCTION auto PostStepEnergyCalculator::operator()(MevEnergy energy,
+                                                         real_type range,
+                                                         real_type step) const
+    -> MevEnergy
+{
+    REQUIRE(energy.value() > 0);
+    REQUIRE(step >= 0);
+    if (step >= range)
+    {
+        // Particle stops
+        return zero_quantity();
+    }
+
+    real_type eloss = step * calc_dedx_(energy);
+    if (eloss > linear_loss_limit_ * energy.value())
+    {
+        // Large loss: the stopping power varies over the step
+        return calc_energy_(range - step);
+    }
+    return MevEnergy{energy.value() - eloss};
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,60 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RangeCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "base/UniformGrid.hh"
+#include "physics/material/MaterialTrackView.hh"
+#include "EnergyLossParamsPointers.hh"
+#include "Types.hh"
+#include "Units.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Find and interpolate the range of a charged particle.
+ *
+ * The range is the continuous-slowing-down path length to stop the particle,
+ * integrated from the restricted stopping power by \c EnergyLossParams. It is
+ * inversely proportional to the density of the track's material, and it is
+ * infinite in a material without stopping power, such as vacuum.
+ *
+ * \code
+    RangeCalculator calc_range(loss_tables, particle.def_id(), material);
+    real_type range = calc_range(particle.energy());
+   \endcode
+ */
+class RangeCalculator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
+  public:
+    // Construct from tables, particle type, and material
+    inline CELER_FUNCTION RangeCalculator(const EnergyLossParamsPointers& data,
+                                          ParticleDefId particle,
+                                          const MaterialTrackView& material);
+
+    // Range [cm] at the given energy
+    inline CELER_FUNCTION real_type operator()(MevEnergy energy) const;
+
+  private:
+    UniformGrid      loge_grid_;
+    const real_type* range_;
+    real_type        inv_density_scale_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "RangeCalculator.i.hh"
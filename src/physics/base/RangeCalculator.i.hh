@@ -0,0 +1,45 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RangeCalculator.i.hh
+//---------------------------------------------------------------------------//
+
+#include "base/Assert.hh"
+#include "base/NumericLimits.hh"
+#include "detail/EnergyLossUtils.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from tables, particle type, and material.
+ */
+CELER_FUNCTION
+RangeCalculator::RangeCalculator(const EnergyLossParamsPointers& data,
+                                 ParticleDefId                   particle,
+                                 const MaterialTrackView&        material)
+    : loge_grid_(data.log_energy)
+    , range_(data.range.data() + data.row_offset(particle, material.def_id()))
+    , inv_density_scale_(1 / material.density_scale())
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Range [cm] at the given energy.
+ */
+CELER_FUNCTION real_type RangeCalculator::operator()(MevEnergy energy) const
+{
+    if (CELER_UNLIKELY(range_[0] == numeric_limits<real_type>::infinity()))
+    {
+        // No continuous loss in this material
+        return range_[0];
+    }
+    return detail::interp_energy_loss(loge_grid_, range_, energy.value())
+           * inv_density_scale_;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
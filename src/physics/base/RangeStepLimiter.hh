@@ -0,0 +1,50 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RangeStepLimiter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "EnergyLossParamsPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Limit the step of a charged particle to a fraction of its range.
+ *
+ * Continuous energy loss is only accurate for steps over which the stopping
+ * power changes little. Given the range \f$ R \f$, the maximum range fraction
+ * \f$ \alpha \f$, and the final range \f$ \rho \f$, the step limit is
+ * \f[
+   s = \begin{cases}
+   \alpha R + \rho (1 - \alpha) (2 - \rho / R) & R > \rho \\
+   R & R \le \rho
+   \end{cases}
+ * \f]
+ * which decreases smoothly to the range as the particle slows down (as in
+ * Geant4's G4VEnergyLossProcess).
+ */
+class RangeStepLimiter
+{
+  public:
+    // Construct from energy loss tables
+    explicit inline CELER_FUNCTION
+    RangeStepLimiter(const EnergyLossParamsPointers& data);
+
+    // Maximum step [cm] for a particle with the given range
+    inline CELER_FUNCTION real_type operator()(real_type range) const;
+
+  private:
+    real_type alpha_;
+    real_type rho_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "RangeStepLimiter.i.hh"
@@ -0,0 +1,40 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RangeStepLimiter.i.hh
+//---------------------------------------------------------------------------//
+
+#include "base/Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from energy loss tables.
+ */
+CELER_FUNCTION
+RangeStepLimiter::RangeStepLimiter(const EnergyLossParamsPointers& data)
+    : alpha_(data.max_step_over_range), rho_(data.min_step)
+{
+    REQUIRE(alpha_ > 0 && alpha_ <= 1);
+    REQUIRE(rho_ > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Maximum step [cm] for a particle with the given range.
+ */
+CELER_FUNCTION real_type RangeStepLimiter::operator()(real_type range) const
+{
+    REQUIRE(range >= 0);
+    if (range <= rho_)
+    {
+        return range;
+    }
+    return alpha_ * range + rho_ * (1 - alpha_) * (2 - rho_ / range);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,137 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RegionParams.cc
+//---------------------------------------------------------------------------//
+#include "RegionParams.hh"
+
+#include <algorithm>
+#include "base/Range.hh"
+#include "comm/Device.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from volume sets.
+ */
+RegionParams::RegionParams(const Input& inp) : num_models_(inp.num_models)
+{
+    REQUIRE(inp.num_volumes > 0);
+    REQUIRE(inp.num_models > 0);
+
+    labels_.push_back("default");
+    cuts_.push_back(inp.default_cuts);
+    host_volume_regions_.assign(inp.num_volumes, default_region());
+    host_model_enabled_.assign(inp.num_models, 1);
+
+    for (const RegionInput& region : inp.regions)
+    {
+        REQUIRE(!region.label.empty());
+        REQUIRE(!region.volumes.empty());
+        REQUIRE(this->find(region.label) == RegionId{});
+        const RegionId id(labels_.size());
+
+        for (VolumeId vol : region.volumes)
+        {
+            REQUIRE(vol < host_volume_regions_.size());
+            INSIST(host_volume_regions_[vol.get()] == default_region(),
+                   "Volume " << vol.get() << " is assigned to both region '"
+                             << labels_[host_volume_regions_[vol.get()].get()]
+                             << "' and region '" << region.label << "'");
+            host_volume_regions_[vol.get()] = id;
+        }
+
+        auto enabled = host_model_enabled_.insert(
+            host_model_enabled_.end(), inp.num_models, 1);
+        for (ModelId model : region.disabled_models)
+        {
+            REQUIRE(model < inp.num_models);
+            enabled[model.get()] = 0;
+        }
+
+        labels_.push_back(region.label);
+        cuts_.push_back(region.cuts);
+    }
+
+    if (celeritas::is_device_enabled())
+    {
+        device_volume_regions_
+            = DeviceVector<RegionId>(host_volume_regions_.size());
+        device_volume_regions_.copy_to_device(make_span(host_volume_regions_));
+        device_model_enabled_
+            = DeviceVector<char>(host_model_enabled_.size());
+        device_model_enabled_.copy_to_device(make_span(host_model_enabled_));
+    }
+
+    ENSURE(labels_.size() == inp.regions.size() + 1);
+    ENSURE(host_model_enabled_.size() == labels_.size() * num_models_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the label of a region.
+ */
+const std::string& RegionParams::id_to_label(RegionId id) const
+{
+    REQUIRE(id < labels_.size());
+    return labels_[id.get()];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the region with a label, returning an invalid ID if not found.
+ */
+RegionId RegionParams::find(const std::string& label) const
+{
+    auto iter = std::find(labels_.begin(), labels_.end(), label);
+    if (iter == labels_.end())
+        return {};
+    return RegionId(iter - labels_.begin());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the range cuts of a region.
+ */
+const CutParams::Input& RegionParams::cuts(RegionId id) const
+{
+    REQUIRE(id < cuts_.size());
+    return cuts_[id.get()];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access region data on the host.
+ */
+RegionParamsPointers RegionParams::host_pointers() const
+{
+    RegionParamsPointers result;
+    result.volume_regions = make_span(host_volume_regions_);
+    result.num_models     = num_models_;
+    result.model_enabled  = make_span(host_model_enabled_);
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access region data on the device.
+ */
+RegionParamsPointers RegionParams::device_pointers() const
+{
+    REQUIRE(!device_volume_regions_.empty());
+    RegionParamsPointers result;
+    result.volume_regions = device_volume_regions_.device_pointers();
+    result.num_models     = num_models_;
+    result.model_enabled  = device_model_enabled_.device_pointers();
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
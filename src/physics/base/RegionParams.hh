@@ -0,0 +1,96 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RegionParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+#include <vector>
+#include "base/DeviceVector.hh"
+#include "base/Types.hh"
+#include "geometry/Types.hh"
+#include "CutParams.hh"
+#include "RegionParamsPointers.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sets of geometry volumes with their own production cuts and physics.
+ *
+ * This is analogous to a Geant4 \c G4Region: a detector can use fine cuts in
+ * a tracker and coarse cuts (or fewer models) in a calorimeter absorber. The
+ * default region, with ID zero, contains all volumes that are not assigned
+ * to a user region.
+ *
+ * Volume IDs are those of the \c GeoParams (e.g. from \c label_to_id), and the
+ * number of models is that of the physics setup. The per-region cuts are
+ * converted to energies by \c CutParams.
+ */
+class RegionParams
+{
+  public:
+    //! Input for a single user region
+    struct RegionInput
+    {
+        std::string           label;
+        std::vector<VolumeId> volumes;
+        CutParams::Input      cuts;
+        std::vector<ModelId>  disabled_models;
+    };
+
+    //! Input data to construct this class
+    struct Input
+    {
+        size_type                num_volumes = 0;
+        size_type                num_models  = 0;
+        CutParams::Input         default_cuts;
+        std::vector<RegionInput> regions;
+    };
+
+  public:
+    // Construct from volume sets
+    explicit RegionParams(const Input& inp);
+
+    //// HOST ACCESSORS ////
+
+    //! Number of regions, including the default region
+    size_type num_regions() const { return labels_.size(); }
+
+    //! Default region for unassigned volumes
+    static RegionId default_region() { return RegionId{0}; }
+
+    // Get the label of a region
+    const std::string& id_to_label(RegionId id) const;
+
+    // Find the region with a label
+    RegionId find(const std::string& label) const;
+
+    // Get the range cuts of a region
+    const CutParams::Input& cuts(RegionId id) const;
+
+    // Access region data on the host
+    RegionParamsPointers host_pointers() const;
+
+    //// DEVICE ACCESSORS ////
+
+    // Access region data on the device
+    RegionParamsPointers device_pointers() const;
+
+  private:
+    std::vector<std::string>      labels_;
+    std::vector<CutParams::Input> cuts_;
+    size_type                     num_models_;
+    std::vector<RegionId>         host_volume_regions_;
+    std::vector<char>             host_model_enabled_;
+
+    DeviceVector<RegionId> device_volume_regions_;
+    DeviceVector<char>     device_model_enabled_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
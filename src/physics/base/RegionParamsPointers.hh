@@ -0,0 +1,48 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RegionParamsPointers.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Mapping of geometry volumes to regions, and per-region physics options.
+ *
+ * Every volume belongs to exactly one region; volumes not assigned by the
+ * user belong to the default region (the first one). Model enablement is
+ * stored as [region][model], with nonzero values for enabled models.
+ *
+ * \sa RegionParams (owns the pointed-to data)
+ * \sa RegionView (accesses the region of a single volume)
+ */
+struct RegionParamsPointers
+{
+    Span<const RegionId> volume_regions; //!< Region [volume]
+    size_type            num_models = 0;
+    Span<const char>     model_enabled; //!< Enabled flag [region][model]
+
+    //! Check whether the interface is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !volume_regions.empty() && !model_enabled.empty();
+    }
+
+    //! Number of regions
+    CELER_FUNCTION size_type num_regions() const
+    {
+        return model_enabled.size() / num_models;
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,51 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RegionView.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "geometry/Types.hh"
+#include "RegionParamsPointers.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Access the region and physics options of a geometry volume.
+ *
+ * The region lookup is a single array access from the current volume.
+ *
+ * \code
+    RegionView region(region_pointers, geo.volume_id());
+    CutView cuts(cut_pointers, region.region_id(), mat.def_id());
+    if (region.is_enabled(model_id)) { ... }
+   \endcode
+ */
+class RegionView
+{
+  public:
+    // Construct from region data and the current volume
+    inline CELER_FUNCTION RegionView(const RegionParamsPointers& params,
+                                     VolumeId                    volume);
+
+    //! Region of the volume
+    CELER_FUNCTION RegionId region_id() const { return region_; }
+
+    // Whether a model is active in this region
+    inline CELER_FUNCTION bool is_enabled(ModelId model) const;
+
+  private:
+    const RegionParamsPointers& params_;
+    RegionId                    region_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "RegionView.i.hh"
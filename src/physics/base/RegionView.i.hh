@@ -0,0 +1,39 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RegionView.i.hh
+//---------------------------------------------------------------------------//
+
+#include "base/Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from region data and the current volume.
+ */
+CELER_FUNCTION
+RegionView::RegionView(const RegionParamsPointers& params, VolumeId volume)
+    : params_(params)
+{
+    REQUIRE(params_);
+    REQUIRE(volume < params_.volume_regions.size());
+    region_ = params_.volume_regions[volume.get()];
+    ENSURE(region_ < params_.num_regions());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether a model is active in this region.
+ */
+CELER_FUNCTION bool RegionView::is_enabled(ModelId model) const
+{
+    REQUIRE(model < params_.num_models);
+    return params_.model_enabled[region_.get() * params_.num_models
+                                 + model.get()];
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
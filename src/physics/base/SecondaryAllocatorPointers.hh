@@ -7,7 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
-#include "Secondary.hh"
+#include "PackedSecondary.hh"
 #include "base/StackAllocatorPointers.hh"
 
 namespace celeritas
@@ -15,7 +15,7 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 //!@{
 //! Type aliases for secondary allocation
-using SecondaryAllocatorPointers = StackAllocatorPointers<Secondary>;
+using SecondaryAllocatorPointers = StackAllocatorPointers<SecondaryRecord>;
 //!@}
 
 //---------------------------------------------------------------------------//
@@ -5,7 +5,7 @@
 //---------------------------------------------------------------------------//
 //! \file SecondaryAllocatorStore.cc
 //---------------------------------------------------------------------------//
-#include "Secondary.hh"
+#include "PackedSecondary.hh"
 #include "base/StackAllocatorStore.t.hh"
 
 namespace celeritas
@@ -13,7 +13,7 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 
 // Explicitly instantiate stack allocator
-template class StackAllocatorStore<Secondary>;
+template class StackAllocatorStore<SecondaryRecord>;
 
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -7,7 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
-#include "Secondary.hh"
+#include "PackedSecondary.hh"
 #include "base/StackAllocatorView.hh"
 
 namespace celeritas
@@ -15,7 +15,7 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 //!@{
 //! Type aliases for secondary allocation
-using SecondaryAllocatorView = StackAllocatorView<Secondary>;
+using SecondaryAllocatorView = StackAllocatorView<SecondaryRecord>;
 //!@}
 
 //---------------------------------------------------------------------------//
@@ -25,5 +25,11 @@ using ProcessId = OpaqueId<class Process>;
 //! Opaque index of a process applicable to a single particle type
 using ParticleProcessId = OpaqueId<struct ProcessGroup>;
 
+//! Opaque index of the energy loss tables for a charged particle type
+using EnergyLossTableId = OpaqueId<struct EnergyLossTable>;
+
+//! Opaque index of a set of volumes sharing cuts and physics options
+using RegionId = OpaqueId<struct Region>;
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
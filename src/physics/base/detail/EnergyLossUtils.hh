@@ -0,0 +1,82 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EnergyLossUtils.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "base/UniformGrid.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate a stopping power or range row at the given energy.
+ *
+ * Values are linearly interpolated in energy. Below the grid, both the
+ * stopping power and the range are proportional to the velocity, i.e. to
+ * \f$ \sqrt{E} \f$; above the grid the last value is used.
+ */
+inline CELER_FUNCTION real_type interp_energy_loss(const UniformGrid& loge_grid,
+                                                   const real_type*   values,
+                                                   real_type          energy)
+{
+    REQUIRE(energy > 0);
+    const real_type loge = std::log(energy);
+    if (loge <= loge_grid.front())
+    {
+        return values[0] * std::sqrt(energy / std::exp(loge_grid.front()));
+    }
+    else if (loge >= loge_grid.back())
+    {
+        return values[loge_grid.size() - 1];
+    }
+
+    const size_type bin       = loge_grid.find(loge);
+    const real_type energy_lo = std::exp(loge_grid[bin]);
+    const real_type energy_hi = std::exp(loge_grid[bin + 1]);
+    return values[bin]
+           + (values[bin + 1] - values[bin]) * (energy - energy_lo)
+                 / (energy_hi - energy_lo);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate a discrete cross section row at the given energy.
+ *
+ * Values are linearly interpolated in energy; outside the grid the value at
+ * the nearest end is used.
+ */
+inline CELER_FUNCTION real_type interp_xs(const UniformGrid& loge_grid,
+                                          const real_type*   values,
+                                          real_type          energy)
+{
+    REQUIRE(energy > 0);
+    const real_type loge = std::log(energy);
+    if (loge <= loge_grid.front())
+    {
+        return values[0];
+    }
+    else if (loge >= loge_grid.back())
+    {
+        return values[loge_grid.size() - 1];
+    }
+
+    const size_type bin       = loge_grid.find(loge);
+    const real_type energy_lo = std::exp(loge_grid[bin]);
+    const real_type energy_hi = std::exp(loge_grid[bin + 1]);
+    return values[bin]
+           + (values[bin + 1] - values[bin]) * (energy - energy_lo)
+                 / (energy_hi - energy_lo);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -35,8 +35,8 @@ template<class Engine>
 CELER_FUNCTION Interaction BetheBlochInteractor::operator()(Engine& rng)
 {
     // Allocate space for XXX (electron, multiple particles, ...)
-    Secondary* secondaries = this->allocate_(0); // XXX
-    if (secondaries == nullptr)
+    SecondaryRecord* records = this->allocate_(0); // XXX
+    if (records == nullptr)
     {
         // Failed to allocate space for a secondary
         return Interaction::from_failure();
@@ -50,12 +50,14 @@ CELER_FUNCTION Interaction BetheBlochInteractor::operator()(Engine& rng)
     result.action      = Action::scattered;                     // XXX
     result.energy      = units::MevEnergy{inc_energy_.value()}; // XXX
     result.direction   = inc_direction_;
-    result.secondaries = {secondaries, 1}; // XXX
+    result.secondaries = {records, 1}; // XXX
 
     // Save outgoing secondary data
-    secondaries[0].def_id    = shared_.electron_id; // XXX
-    secondaries[0].energy    = units::MevEnergy{0}; // XXX
-    secondaries[0].direction = {0, 0, 0};           // XXX
+    Secondary secondary;
+    secondary.def_id    = shared_.electron_id;        // XXX
+    secondary.energy    = units::MevEnergy{0};        // XXX
+    secondary.direction = {0, 0, 0};                  // XXX
+    records[0]          = SecondaryRecord(secondary); // XXX
 
     return result;
 }
@@ -54,8 +54,8 @@ template<class Engine>
 CELER_FUNCTION Interaction BetheHeitlerInteractor::operator()(Engine& rng)
 {
     // Allocate space for the pair-produced electrons
-    Secondary* secondaries = this->allocate_(2);
-    if (secondaries == nullptr)
+    SecondaryRecord* records = this->allocate_(2);
+    if (records == nullptr)
     {
         // Failed to allocate space for a secondary
         return Interaction::from_failure();
@@ -133,9 +133,10 @@ CELER_FUNCTION Interaction BetheHeitlerInteractor::operator()(Engine& rng)
 
     // Construct interaction for change to primary (incident) particle (gamma)
     Interaction result = Interaction::from_absorption();
-    result.secondaries = {secondaries, 2};
+    result.secondaries = {records, 2};
 
     // Outgoing secondaries are electron and positron
+    Secondary secondaries[2];
     secondaries[0].def_id = shared_.electron_id;
     secondaries[1].def_id = shared_.positron_id;
     secondaries[0].energy
@@ -163,6 +164,8 @@ CELER_FUNCTION Interaction BetheHeitlerInteractor::operator()(Engine& rng)
     secondaries[1].direction
         = rotate({-sint * cosp, -sint * sinp, cost}, inc_direction_);
 
+    records[0] = SecondaryRecord(secondaries[0]);
+    records[1] = SecondaryRecord(secondaries[1]);
     return result;
 }
 
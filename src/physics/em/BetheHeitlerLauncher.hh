@@ -0,0 +1,69 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BetheHeitlerLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "physics/base/Interaction.hh"
+#include "physics/material/ElementSelector.hh"
+#include "physics/material/ElementView.hh"
+#include "physics/material/MaterialParamsPointers.hh"
+#include "physics/material/MaterialView.hh"
+#include "BetheHeitlerInteractor.hh"
+#include "BetheHeitlerInteractorPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the Bethe-Heitler pair production interactor from a ModelDispatcher.
+ *
+ * There is no Bethe-Heitler cross section calculator yet, so the target
+ * element is sampled with a weight of \f$ Z(Z+1) \f$: the leading dependence
+ * of the pair production cross section on the nuclear and atomic electron
+ * fields.
+ */
+struct BetheHeitlerLauncher
+{
+    ModelId                        model;
+    BetheHeitlerInteractorPointers shared;
+
+    //! ID of the model
+    CELER_FUNCTION ModelId model_id() const { return model; }
+
+    //! Sample an interaction for the given track
+    template<class Track, class Engine>
+    CELER_FUNCTION Interaction operator()(Track& track, Engine& rng) const
+    {
+        auto         material = track.material();
+        MaterialView mat      = material.material_view();
+
+        ElementSelector select_el(mat,
+                                  ChargeWeight{track.material_params},
+                                  material.element_scratch());
+        ElementView el = mat.element_view(select_el(rng));
+
+        BetheHeitlerInteractor interact(
+            shared, track.particle, track.direction, track.allocate, el);
+        return interact(rng);
+    }
+
+    //! Relative weight of an element for pair production
+    struct ChargeWeight
+    {
+        const MaterialParamsPointers& params;
+
+        CELER_FUNCTION real_type operator()(ElementDefId el_id) const
+        {
+            const real_type z = ElementView(params, el_id).atomic_number();
+            return z * (z + 1);
+        }
+    };
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
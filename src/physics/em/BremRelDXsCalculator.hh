@@ -0,0 +1,80 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BremRelDXsCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Constants.hh"
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/base/Units.hh"
+#include "physics/material/ElementView.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Scaled differential cross section for relativistic bremsstrahlung.
+ *
+ * This calculates \f$ k\, d\sigma/dk \f$ [cm^2] for an electron of total
+ * energy \f$ E \f$ emitting a photon of energy \f$ k \f$ in the field of an
+ * atom, using Tsai's screened Bethe–Heitler formula (Rev. Mod. Phys. 46, 815,
+ * eq. 3.9):
+ * \f[
+   k \frac{d\sigma}{dk} = 4 \alpha r_e^2 \left\{ \left(\frac{4}{3}
+   - \frac{4}{3} y + y^2\right) \left[ Z^2 \left(\frac{\phi_1}{4}
+   - \frac{\ln Z}{3} - f_c\right) + Z \left(\frac{\psi_1}{4}
+   - \frac{2 \ln Z}{3}\right) \right] + \frac{1 - y}{8} \left[ Z^2 (\phi_1 -
+   \phi_2) + Z (\psi_1 - \psi_2) \right] \right\}
+ * \f]
+ * where \f$ y = k / E \f$ and the screening functions are Tsai's fits to the
+ * Thomas–Fermi model (eq. 3.38–3.41). In the complete screening limit this
+ * reduces to the radiation logarithms used by \c
+ * ElementView::mass_radiation_coeff for \f$ Z > 4 \f$ .
+ *
+ * \note This is the differential cross section of Geant4's
+ * G4eBremsstrahlungRelModel without the LPM and dielectric suppression.
+ */
+class BremRelDXsCalculator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
+  public:
+    // Construct with element and incident kinetic energy
+    inline CELER_FUNCTION BremRelDXsCalculator(const ElementView& element,
+                                               MevEnergy          energy);
+
+    // Calculate k dsigma/dk [cm^2] at the given photon energy
+    inline CELER_FUNCTION real_type operator()(MevEnergy gamma_energy) const;
+
+  private:
+    // Incident total energy [MeV]
+    real_type total_energy_;
+    // Atomic number
+    real_type z_;
+    // Z^{1/3}
+    real_type cbrt_z_;
+    // ln Z / 3 + f_c: subtracted from phi_1 / 4
+    real_type phi_shift_;
+    // 2 ln Z / 3: subtracted from psi_1 / 4
+    real_type psi_shift_;
+
+    //! Electron rest energy [MeV]
+    static CELER_CONSTEXPR_FUNCTION real_type electron_mass_c2()
+    {
+        return constants::electron_mass * constants::c_light
+               * constants::c_light / units::Mev::value();
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "BremRelDXsCalculator.i.hh"
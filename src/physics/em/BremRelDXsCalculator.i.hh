@@ -0,0 +1,79 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BremRelDXsCalculator.i.hh
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include "base/Algorithms.hh"
+#include "base/Assert.hh"
+#include "base/Constants.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with element and incident kinetic energy.
+ */
+CELER_FUNCTION
+BremRelDXsCalculator::BremRelDXsCalculator(const ElementView& element,
+                                           MevEnergy          energy)
+    : z_(element.atomic_number())
+    , cbrt_z_(element.cbrt_z())
+    , phi_shift_(element.log_z() / 3 + element.coulomb_correction())
+    , psi_shift_(2 * element.log_z() / 3)
+{
+    REQUIRE(energy.value() > 0);
+    total_energy_ = energy.value() + electron_mass_c2();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate k dsigma/dk [cm^2] at the given photon energy.
+ *
+ * Where the screening functions make the unsuppressed formula negative (only
+ * for \f$ k \f$ close to the kinetic energy at low incident energies), the
+ * cross section is zero.
+ */
+CELER_FUNCTION real_type
+BremRelDXsCalculator::operator()(MevEnergy gamma_energy) const
+{
+    constexpr real_type prefactor = 4 * constants::alpha_fine_structure
+                                    * constants::re_electron
+                                    * constants::re_electron;
+    const real_type     electron_mass_c2 = this->electron_mass_c2();
+
+    const real_type k = gamma_energy.value();
+    REQUIRE(k > 0 && k < total_energy_);
+
+    // Screening variables
+    const real_type y     = k / total_energy_;
+    const real_type gamma = 100 * electron_mass_c2 * k
+                            / (total_energy_ * (total_energy_ - k) * cbrt_z_);
+    const real_type eps = gamma / cbrt_z_;
+
+    // Screening functions
+    const real_type phi1
+        = 20.863 - 2 * std::log(1 + ipow<2>(0.55846 * gamma))
+          - 4 * (1 - 0.6 * std::exp(-0.9 * gamma)
+                 - 0.4 * std::exp(-1.5 * gamma));
+    const real_type phi1m2 = (2 / real_type(3))
+                             / (1 + 6.5 * gamma + 6 * gamma * gamma);
+    const real_type psi1
+        = 28.340 - 2 * std::log(1 + ipow<2>(3.621 * eps))
+          - 4 * (1 - 0.7 * std::exp(-8 * eps) - 0.3 * std::exp(-29.2 * eps));
+    const real_type psi1m2 = (2 / real_type(3))
+                             / (1 + 40 * eps + 400 * eps * eps);
+
+    const real_type result
+        = (4 / real_type(3) * (1 - y) + y * y)
+              * (z_ * z_ * (phi1 / 4 - phi_shift_)
+                 + z_ * (psi1 / 4 - psi_shift_))
+          + (1 - y) / 8 * (z_ * z_ * phi1m2 + z_ * psi1m2);
+    return prefactor * max(result, real_type(0));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
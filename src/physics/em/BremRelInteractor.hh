@@ -14,26 +14,59 @@
 #include "physics/base/SecondaryAllocatorView.hh"
 #include "physics/base/Secondary.hh"
 #include "physics/base/Units.hh"
+#include "physics/material/Types.hh"
 #include "BremRelInteractorPointers.hh"
+#include "BremRelParamsPointers.hh"
 
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Brief class description.
+ * Relativistic bremsstrahlung of an electron in the field of an atom.
  *
- * This is a model for XXXX process. Additional description
+ * The incident electron emits a single photon above the production cut
+ * \f$ k_c \f$ of the material. The photon energy is sampled from the
+ * spectrum tables of \c BremRelParams : one of the two bracketing energy grid
+ * points is chosen with probability given by the fractional position in
+ * \f$ \ln T \f$, and the tabulated spectrum of that row is sampled between
+ * the cut and the kinetic energy with precomputed alias tables. Sampling the
+ * energy therefore takes constant time, independent of the cut, the
+ * screening, and the number of energy fraction grid points, with no
+ * rejection loop.
  *
- * \note This performs the same sampling routine as in Geant4's
- * XXXX class, as documented in section XXX of the Geant4 Physics
- * Reference (release 10.6).
+ * The photon polar angle is sampled from the approximate Tsai distribution
+ * and the exiting electron direction is taken from momentum balance, with
+ * the nucleus absorbing the recoil.
+ *
+ * \note This fills the role of Geant4's G4eBremsstrahlungRelModel, as
+ * documented in section 10.2.2 of the Geant4 Physics Reference (release
+ * 10.6), but without LPM suppression, and samples the photon energy from
+ * tables instead of by rejection on the screening functions. Below 1 GeV,
+ * where the tables are built from the Seltzer-Berger data, it replaces
+ * G4SeltzerBergerModel. The incident energy must be covered by the table
+ * energy grid. The photon direction uses the algorithm of G4ModifiedTsai.
+ *
+ * The LPM effect suppresses the emission of photons below
+ * \f$ k \approx T^2 / E_\mathrm{LPM} \f$, where
+ * \f$ E_\mathrm{LPM} \approx 7.7\,\mathrm{TeV/cm} \times X_0 \f$ is about
+ * 4 TeV in lead and 2.5 TeV in uranium. The model is therefore limited to
+ * 1 TeV, below the LPM energy of every material.
  */
 class BremRelInteractor
 {
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
   public:
     // Construct with shared and state data
     inline CELER_FUNCTION
     BremRelInteractor(const BremRelInteractorPointers& shared,
+                      const BremRelParamsPointers&     data,
+                      ElementDefId                     el_id,
+                      MevEnergy                        gamma_cut,
                       const ParticleTrackView&         particle,
                       const Real3&                     inc_direction,
                       SecondaryAllocatorView&          allocate);
@@ -45,26 +78,44 @@ class BremRelInteractor
     //// COMMON PROPERTIES ////
 
     //! Minimum incident energy for this model to be valid
-    static CELER_CONSTEXPR_FUNCTION units::MevEnergy min_incident_energy()
+    static CELER_CONSTEXPR_FUNCTION MevEnergy min_incident_energy()
     {
-        return units::MevEnergy{0}; // XXX
+        return MevEnergy{1e-3};
     }
 
-    //! Maximum incident energy for this model to be valid
-    static CELER_CONSTEXPR_FUNCTION units::MevEnergy max_incident_energy()
+    //! Maximum incident energy for this model to be valid (no LPM)
+    static CELER_CONSTEXPR_FUNCTION MevEnergy max_incident_energy()
     {
-        return units::MevEnergy{0}; // XXX
+        return MevEnergy{1e6};
     }
 
   private:
     // Shared constant physics properties
     const BremRelInteractorPointers& shared_;
-    // Incident gamma energy
-    const units::MevEnergy inc_energy_;
+    // Tabulated photon spectra
+    const BremRelParamsPointers& data_;
+    // Element emitting the photon
+    const ElementDefId el_id_;
+    // Incident electron kinetic energy
+    const MevEnergy inc_energy_;
+    // Incident electron momentum [MeV/c]
+    const real_type inc_momentum_;
+    // Incident electron kinetic energy divided by its mass
+    const real_type inc_energy_per_mass_;
+    // Logarithm of the production cut as a fraction of the incident energy
+    const real_type log_x_cut_;
     // Incident direction
     const Real3& inc_direction_;
-    // Allocate space for one or more secondary particles
+    // Allocate space for the emitted photon
     SecondaryAllocatorView& allocate_;
+
+    // HELPER FUNCTIONS
+
+    template<class Engine>
+    inline CELER_FUNCTION size_type sample_energy_idx(Engine& rng) const;
+
+    template<class Engine>
+    inline CELER_FUNCTION real_type sample_gamma_costheta(Engine& rng) const;
 };
 
 //---------------------------------------------------------------------------//
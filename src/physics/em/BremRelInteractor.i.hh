@@ -6,59 +6,163 @@
 //! \file BremRelInteractor.i.hh
 //---------------------------------------------------------------------------//
 
+#include <cmath>
+#include "base/Algorithms.hh"
+#include "base/ArrayUtils.hh"
+#include "base/Assert.hh"
+#include "base/Constants.hh"
+#include "base/UniformGrid.hh"
+#include "random/distributions/BernoulliDistribution.hh"
+#include "random/distributions/GenerateCanonical.hh"
+#include "random/distributions/UniformRealDistribution.hh"
+#include "detail/BremRelTableView.hh"
+
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
  * Construct with shared and state data.
+ *
+ * The production cut must be below the incident kinetic energy, i.e. the
+ * restricted cross section must be nonzero.
  */
 CELER_FUNCTION
 BremRelInteractor::BremRelInteractor(const BremRelInteractorPointers& shared,
-                                     const ParticleTrackView&         particle,
-                                     const Real3&            inc_direction,
-                                     SecondaryAllocatorView& allocate)
+                                     const BremRelParamsPointers&     data,
+                                     ElementDefId                     el_id,
+                                     MevEnergy                gamma_cut,
+                                     const ParticleTrackView& particle,
+                                     const Real3&             inc_direction,
+                                     SecondaryAllocatorView&  allocate)
     : shared_(shared)
-    , inc_energy_(particle.energy().value())
+    , data_(data)
+    , el_id_(el_id)
+    , inc_energy_(particle.energy())
+    , inc_momentum_(particle.momentum().value())
+    , inc_energy_per_mass_(particle.energy().value()
+                           / particle.mass().value())
+    , log_x_cut_(std::log(gamma_cut.value() / particle.energy().value()))
     , inc_direction_(inc_direction)
     , allocate_(allocate)
 {
+    REQUIRE(data_);
+    REQUIRE(el_id_ < data_.num_elements());
     REQUIRE(inc_energy_ >= this->min_incident_energy()
             && inc_energy_ <= this->max_incident_energy());
-    REQUIRE(particle.def_id() == shared_.gamma_id); // XXX
+    REQUIRE(particle.def_id() == shared_.electron_id);
+    REQUIRE(gamma_cut.value() > 0 && log_x_cut_ < 0);
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Sample using the XXX model.
+ * Sample the emitted photon energy from the tabulated spectrum.
  */
 template<class Engine>
 CELER_FUNCTION Interaction BremRelInteractor::operator()(Engine& rng)
 {
-    // Allocate space for XXX (electron, multiple particles, ...)
-    Secondary* secondaries = this->allocate_(0); // XXX
-    if (secondaries == nullptr)
+    // Allocate space for the bremsstrahlung photon
+    SecondaryRecord* gamma_record = this->allocate_(1);
+    if (gamma_record == nullptr)
     {
         // Failed to allocate space for a secondary
         return Interaction::from_failure();
     }
 
-    // XXX sample
-    (void)sizeof(rng);
+    // Sample the energy fraction between the cut and the kinetic energy
+    detail::BremRelTableView table(
+        data_, data_.row(el_id_, this->sample_energy_idx(rng)));
+    const real_type gamma_energy
+        = inc_energy_.value() * std::exp(table.sample(log_x_cut_, rng));
+
+    // Sample the photon direction
+    UniformRealDistribution<real_type> sample_phi(0, 2 * constants::pi);
+    const Real3                        gamma_dir = rotate(
+        from_spherical(this->sample_gamma_costheta(rng), sample_phi(rng)),
+        inc_direction_);
+
+    // Electron direction from momentum balance: p_e' = p_e - k
+    Real3 electron_dir;
+    for (int i = 0; i < 3; ++i)
+    {
+        electron_dir[i] = inc_momentum_ * inc_direction_[i]
+                          - gamma_energy * gamma_dir[i];
+    }
+    const real_type inv_norm = 1 / norm(electron_dir);
+    for (int i = 0; i < 3; ++i)
+    {
+        electron_dir[i] *= inv_norm;
+    }
 
     // Construct interaction for change to primary (incident) particle
     Interaction result;
-    result.action      = Action::scattered;                     // XXX
-    result.energy      = units::MevEnergy{inc_energy_.value()}; // XXX
-    result.direction   = inc_direction_;
-    result.secondaries = {secondaries, 1}; // XXX
+    result.action      = Action::scattered;
+    result.energy      = MevEnergy{inc_energy_.value() - gamma_energy};
+    result.direction   = electron_dir;
+    result.secondaries = {gamma_record, 1};
 
     // Save outgoing secondary data
-    secondaries[0].def_id    = shared_.electron_id; // XXX
-    secondaries[0].energy    = units::MevEnergy{0}; // XXX
-    secondaries[0].direction = {0, 0, 0};           // XXX
+    Secondary gamma;
+    gamma.def_id    = shared_.gamma_id;
+    gamma.energy    = MevEnergy{gamma_energy};
+    gamma.direction = gamma_dir;
+    *gamma_record   = SecondaryRecord(gamma);
 
     return result;
 }
 
+//---------------------------------------------------------------------------//
+// PRIVATE HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Choose one of the energy grid points bracketing the incident energy.
+ *
+ * The upper point is chosen with probability equal to the fractional position
+ * in \f$ \ln T \f$. Outside the grid the nearest point is used.
+ */
+template<class Engine>
+CELER_FUNCTION size_type BremRelInteractor::sample_energy_idx(Engine& rng) const
+{
+    const UniformGrid loge_grid(data_.log_energy);
+    const real_type   loge = std::log(inc_energy_.value());
+    if (loge <= loge_grid.front())
+    {
+        return 0;
+    }
+    if (loge >= loge_grid.back())
+    {
+        return loge_grid.size() - 1;
+    }
+    const size_type idx  = loge_grid.find(loge);
+    const real_type frac = (loge - loge_grid[idx]) / data_.log_energy.delta;
+    return BernoulliDistribution(frac)(rng) ? idx + 1 : idx;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the photon polar angle from the modified Tsai distribution.
+ *
+ * The scaled angle \f$ u = E \theta / m \f$ is sampled from a mixture of two
+ * \f$ u e^{-a u} \f$ distributions. Values beyond the kinematic limit are
+ * resampled, which happens with negligible probability at these energies.
+ */
+template<class Engine>
+CELER_FUNCTION real_type
+BremRelInteractor::sample_gamma_costheta(Engine& rng) const
+{
+    constexpr real_type a1    = 1.6;
+    constexpr real_type a2    = a1 / 3;
+    const real_type     u_max = 2 * (1 + inc_energy_per_mass_);
+
+    real_type u;
+    do
+    {
+        const real_type uu = -std::log(generate_canonical(rng)
+                                       * generate_canonical(rng));
+        u = (generate_canonical(rng) < real_type(0.25) ? a1 : a2) * uu;
+    } while (u > u_max);
+
+    return 1 - 2 * ipow<2>(u / u_max);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
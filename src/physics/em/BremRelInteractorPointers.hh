@@ -14,7 +14,7 @@ namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Device data for creating an interactor.
+ * Device data for creating a BremRelInteractor.
  */
 struct BremRelInteractorPointers
 {
@@ -22,12 +22,11 @@ struct BremRelInteractorPointers
     ParticleDefId electron_id;
     //! ID of a gamma
     ParticleDefId gamma_id;
-    // XXX additional data
 
     //! Check whether the data is assigned
     explicit inline CELER_FUNCTION operator bool() const
     {
-        return electron_id && gamma_id; // XXX
+        return electron_id && gamma_id;
     }
 };
 
@@ -0,0 +1,62 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BremRelMicroXsCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "physics/base/Units.hh"
+#include "physics/material/Types.hh"
+#include "BremRelInteractorPointers.hh"
+#include "BremRelParamsPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate bremsstrahlung cross sections above a photon production cut.
+ *
+ * The restricted cross section at each bracketing energy grid point is read
+ * from the spectrum tables at the cut fraction \f$ k_c / T \f$ of the actual
+ * incident energy, and the two are interpolated linearly in \f$ \ln T \f$ .
+ * Outside the energy grid the nearest row is used.
+ */
+class BremRelMicroXsCalculator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
+  public:
+    // Construct with shared and state data
+    inline CELER_FUNCTION
+    BremRelMicroXsCalculator(const BremRelInteractorPointers& shared,
+                             const BremRelParamsPointers&     data,
+                             MevEnergy                        gamma_cut,
+                             const ParticleTrackView&         particle);
+
+    // Compute cross section [cm^2]
+    inline CELER_FUNCTION real_type operator()(ElementDefId el_id) const;
+
+  private:
+    // Tabulated bremsstrahlung data
+    const BremRelParamsPointers& data_;
+    // Logarithm of the cut energy fraction
+    real_type log_x_cut_;
+    // Lower energy grid point
+    size_type energy_idx_;
+    // Fractional position in ln(T) between the grid points
+    real_type frac_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "BremRelMicroXsCalculator.i.hh"
@@ -0,0 +1,75 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BremRelMicroXsCalculator.i.hh
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include "base/Assert.hh"
+#include "base/UniformGrid.hh"
+#include "detail/BremRelTableView.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with shared and state data.
+ */
+CELER_FUNCTION BremRelMicroXsCalculator::BremRelMicroXsCalculator(
+    const BremRelInteractorPointers& shared,
+    const BremRelParamsPointers&     data,
+    MevEnergy                        gamma_cut,
+    const ParticleTrackView&         particle)
+    : data_(data)
+{
+    REQUIRE(data_);
+    REQUIRE(particle.def_id() == shared.electron_id);
+    REQUIRE(gamma_cut.value() > 0);
+
+    const real_type energy = particle.energy().value();
+    log_x_cut_             = std::log(gamma_cut.value() / energy);
+
+    const UniformGrid loge_grid(data_.log_energy);
+    const real_type   loge = std::log(energy);
+    if (loge <= loge_grid.front())
+    {
+        energy_idx_ = 0;
+        frac_       = 0;
+    }
+    else if (loge >= loge_grid.back())
+    {
+        energy_idx_ = loge_grid.size() - 2;
+        frac_       = 1;
+    }
+    else
+    {
+        energy_idx_ = loge_grid.find(loge);
+        frac_ = (loge - loge_grid[energy_idx_]) / data_.log_energy.delta;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compute cross section [cm^2].
+ *
+ * The cross section is zero if the cut is at or above the incident energy.
+ */
+CELER_FUNCTION
+real_type BremRelMicroXsCalculator::operator()(ElementDefId el_id) const
+{
+    if (log_x_cut_ >= 0)
+    {
+        return 0;
+    }
+
+    const size_type          row = data_.row(el_id, energy_idx_);
+    detail::BremRelTableView lower(data_, row);
+    detail::BremRelTableView upper(data_, row + 1);
+    return (1 - frac_) * (lower.total() - lower.integral(log_x_cut_))
+           + frac_ * (upper.total() - upper.integral(log_x_cut_));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
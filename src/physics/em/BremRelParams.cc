@@ -0,0 +1,263 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BremRelParams.cc
+//---------------------------------------------------------------------------//
+#include "BremRelParams.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <utility>
+#include "base/Algorithms.hh"
+#include "base/Constants.hh"
+#include "base/Range.hh"
+#include "comm/Device.hh"
+#include "physics/material/ElementView.hh"
+#include "random/distributions/AliasTable.hh"
+#include "BremRelDXsCalculator.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//// HELPER FUNCTIONS ////
+//---------------------------------------------------------------------------//
+/*!
+ * Find the lower grid point and fractional position of a value.
+ *
+ * Values outside the grid are clamped to its edges.
+ */
+std::pair<size_type, real_type>
+find_grid_point(const std::vector<real_type>& grid, real_type value)
+{
+    value     = std::min(std::max(value, grid.front()), grid.back());
+    auto iter = std::upper_bound(grid.begin() + 1, grid.end() - 1, value);
+    const size_type i = iter - grid.begin() - 1;
+    return {i, (value - grid[i]) / (grid[i + 1] - grid[i])};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate k dsigma/dk [cm^2] from a Seltzer-Berger table.
+ *
+ * The scaled cross section is interpolated bilinearly in \f$ x \f$ and
+ * \f$ \ln T \f$.
+ */
+real_type calc_seltzer_berger_dxs(const BremRelParams::ElementInput& sb,
+                                  const ElementView&                 element,
+                                  real_type                          energy,
+                                  real_type                          x)
+{
+    const auto      ix = find_grid_point(sb.x, x);
+    const auto      iy = find_grid_point(sb.log_energy, std::log(energy));
+    const size_type nx = sb.x.size();
+    auto            interp_x = [&](size_type j) {
+        const real_type* row = sb.value.data() + j * nx + ix.first;
+        return (1 - ix.second) * row[0] + ix.second * row[1];
+    };
+    const real_type chi = (1 - iy.second) * interp_x(iy.first)
+                          + iy.second * interp_x(iy.first + 1);
+
+    // Scale by Z^2 / beta^2
+    constexpr real_type mb = 1e-3 * units::Barn::value();
+    const real_type     mass = constants::electron_mass * constants::c_light
+                           * constants::c_light / units::Mev::value();
+    const real_type beta_sq = energy * (energy + 2 * mass)
+                              / ipow<2>(energy + mass);
+    const real_type z = element.atomic_number();
+    return chi * mb * z * z / beta_sq;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from the elements in the problem.
+ *
+ * Each bin of the running integral is integrated with a composite Simpson's
+ * rule in \f$ \ln x \f$. Grid points below \c seltzer_berger_limit use
+ * the Seltzer-Berger tables.
+ */
+BremRelParams::BremRelParams(const MaterialParams& materials,
+                             const Input&          inp)
+    : log_energy_(inp.log_energy)
+{
+    REQUIRE(inp.log_energy);
+    REQUIRE(inp.num_x > 1);
+    REQUIRE(inp.min_x > 0 && inp.min_x < 1);
+    REQUIRE(materials.num_elements() > 0);
+    const real_type log_sb_limit = std::log(seltzer_berger_limit().value());
+    REQUIRE(inp.log_energy.front >= log_sb_limit
+            || inp.seltzer_berger.size() == materials.num_elements());
+    for (const ElementInput& sb : inp.seltzer_berger)
+    {
+        REQUIRE(sb.x.size() >= 2 && sb.log_energy.size() >= 2);
+        REQUIRE(sb.value.size() == sb.x.size() * sb.log_energy.size());
+    }
+
+    log_x_.size  = inp.num_x;
+    log_x_.front = std::log(inp.min_x);
+    log_x_.delta = -log_x_.front / (inp.num_x - 1);
+
+    const MaterialParamsPointers mat_ptrs     = materials.host_pointers();
+    const size_type              num_elements = materials.num_elements();
+    const UniformGrid            loge_grid(log_energy_);
+    const UniformGrid            logx_grid(log_x_);
+
+    host_dxs_min_.resize(num_elements * loge_grid.size());
+    host_cdf_.resize(host_dxs_min_.size() * logx_grid.size());
+    host_alias_prob_.resize(host_dxs_min_.size() * logx_grid.size()
+                            * (logx_grid.size() - 1) / 2);
+    host_alias_idx_.resize(host_alias_prob_.size());
+    for (auto el : range<ElementDefId::value_type>(num_elements))
+    {
+        ElementView element(mat_ptrs, ElementDefId{el});
+        for (auto e : range(loge_grid.size()))
+        {
+            const real_type energy = std::exp(loge_grid[e]);
+            std::function<real_type(real_type)> calc_integrand;
+            if (loge_grid[e] < log_sb_limit)
+            {
+                const ElementInput& sb = inp.seltzer_berger[el];
+                calc_integrand = [&sb, &element, energy](real_type log_x) {
+                    return calc_seltzer_berger_dxs(
+                        sb, element, energy, std::exp(log_x));
+                };
+            }
+            else
+            {
+                BremRelDXsCalculator calc_dxs(element,
+                                              units::MevEnergy{energy});
+                calc_integrand = [calc_dxs, energy](real_type log_x) {
+                    return calc_dxs(
+                        units::MevEnergy{energy * std::exp(log_x)});
+                };
+            }
+
+            const size_type row = el * loge_grid.size() + e;
+            real_type*      cdf = host_cdf_.data() + row * logx_grid.size();
+            host_dxs_min_[row]  = calc_integrand(logx_grid.front());
+            cdf[0]              = 0;
+            for (auto j : range<size_type>(1, logx_grid.size()))
+            {
+                constexpr size_type num_intervals = 8;
+
+                // Avoid roundoff past x = 1 at the end of the grid
+                const real_type lo = logx_grid[j - 1];
+                const real_type hi = j + 1 < logx_grid.size() ? logx_grid[j]
+                                                              : 0;
+                const real_type h  = (hi - lo) / num_intervals;
+
+                real_type sum = calc_integrand(lo) + calc_integrand(hi);
+                for (auto i : range<size_type>(1, num_intervals))
+                {
+                    sum += (i % 2 == 1 ? 4 : 2) * calc_integrand(lo + i * h);
+                }
+                cdf[j] = cdf[j - 1] + sum * h / 3;
+            }
+            this->build_alias(row);
+        }
+    }
+
+    if (celeritas::is_device_enabled())
+    {
+        device_dxs_min_ = DeviceVector<real_type>(host_dxs_min_.size());
+        device_dxs_min_.copy_to_device(make_span(host_dxs_min_));
+        device_cdf_ = DeviceVector<real_type>(host_cdf_.size());
+        device_cdf_.copy_to_device(make_span(host_cdf_));
+        device_alias_prob_ = DeviceVector<real_type>(host_alias_prob_.size());
+        device_alias_prob_.copy_to_device(make_span(host_alias_prob_));
+        device_alias_idx_ = DeviceVector<size_type>(host_alias_idx_.size());
+        device_alias_idx_.copy_to_device(make_span(host_alias_idx_));
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build the alias tables of one row.
+ *
+ * The table starting at bin \f$ s \f$ samples the bins above it in
+ * proportion to their integrals. Tables whose bins all have zero integral
+ * (possible only near \f$ x = 1 \f$ at low energy, where the screened cross
+ * section vanishes) are never sampled and are left uniform.
+ */
+void BremRelParams::build_alias(size_type row)
+{
+    const size_type  num_x = log_x_.size;
+    const real_type* cdf   = host_cdf_.data() + row * num_x;
+    const size_type  begin = row * num_x * (num_x - 1) / 2;
+
+    std::vector<real_type> weights;
+    size_type              offset = begin;
+    for (auto s : range(num_x - 1))
+    {
+        const size_type size = num_x - 1 - s;
+        weights.resize(size);
+        for (auto j : range(size))
+        {
+            weights[j] = cdf[s + j + 1] - cdf[s + j];
+        }
+
+        Span<real_type> prob{host_alias_prob_.data() + offset, size};
+        Span<size_type> alias{host_alias_idx_.data() + offset, size};
+        if (cdf[num_x - 1] > cdf[s])
+        {
+            build_alias_table(make_span(weights), prob, alias);
+        }
+        else
+        {
+            for (auto j : range(size))
+            {
+                prob[j]  = 1;
+                alias[j] = j;
+            }
+        }
+        offset += size;
+    }
+    ENSURE(offset == begin + num_x * (num_x - 1) / 2);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access tables on the host.
+ */
+BremRelParamsPointers BremRelParams::host_pointers() const
+{
+    BremRelParamsPointers result;
+    result.log_energy = log_energy_;
+    result.log_x      = log_x_;
+    result.dxs_min    = make_span(host_dxs_min_);
+    result.cdf        = make_span(host_cdf_);
+    result.alias_prob = make_span(host_alias_prob_);
+    result.alias_idx  = make_span(host_alias_idx_);
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access tables on the device.
+ */
+BremRelParamsPointers BremRelParams::device_pointers() const
+{
+    REQUIRE(!device_cdf_.empty());
+    BremRelParamsPointers result;
+    result.log_energy = log_energy_;
+    result.log_x      = log_x_;
+    result.dxs_min    = device_dxs_min_.device_pointers();
+    result.cdf        = device_cdf_.device_pointers();
+    result.alias_prob = device_alias_prob_.device_pointers();
+    result.alias_idx  = device_alias_idx_.device_pointers();
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
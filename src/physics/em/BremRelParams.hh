@@ -0,0 +1,98 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BremRelParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+#include "base/DeviceVector.hh"
+#include "base/Types.hh"
+#include "base/UniformGrid.hh"
+#include "physics/base/Units.hh"
+#include "physics/material/MaterialParams.hh"
+#include "BremRelParamsPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Photon spectrum tables for relativistic bremsstrahlung.
+ *
+ * For every element and incident energy grid point, the scaled differential
+ * cross section is integrated over
+ * \f$ \ln(k/T) \f$ at setup, and alias tables for sampling the photon
+ * energy are built from the integrals of each bin. Since the tables are
+ * independent of the photon production cut, a single set serves every
+ * material and region.
+ *
+ * At and above \c seltzer_berger_limit the differential cross section is
+ * calculated with \c BremRelDXsCalculator . The screened Born approximation
+ * is inaccurate at lower energies, where it is instead interpolated from the
+ * Seltzer-Berger tables (S. M. Seltzer and M. J. Berger, At. Data Nucl. Data
+ * Tables 35, 345 (1986)) of the scaled cross section
+ * \f$ \chi = (\beta^2 / Z^2)\, k\, d\sigma/dk \f$, which must then be
+ * given for every element.
+ */
+class BremRelParams
+{
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
+    //! Seltzer-Berger scaled cross sections of one element
+    struct ElementInput
+    {
+        std::vector<real_type> x;          //!< Energy fraction k / T
+        std::vector<real_type> log_energy; //!< Kinetic energy [ln MeV]
+        std::vector<real_type> value; //!< Scaled xs [mb], x varies fastest
+    };
+
+    //! Input data to construct this class
+    struct Input
+    {
+        UniformGrid::Params log_energy;    //!< Energy grid [ln MeV]
+        size_type           num_x = 64;    //!< Energy fraction grid points
+        real_type           min_x = 1e-4; //!< Lowest tabulated k / T
+
+        //! Seltzer-Berger data for each element, if the grid starts below
+        //! the relativistic model's limit
+        std::vector<ElementInput> seltzer_berger;
+    };
+
+    //! Lowest energy of the relativistic differential cross section
+    static MevEnergy seltzer_berger_limit() { return MevEnergy{1e3}; }
+
+  public:
+    // Construct from the elements in the problem
+    BremRelParams(const MaterialParams& materials, const Input& inp);
+
+    // Access tables on the host
+    BremRelParamsPointers host_pointers() const;
+
+    // Access tables on the device
+    BremRelParamsPointers device_pointers() const;
+
+  private:
+    UniformGrid::Params    log_energy_;
+    UniformGrid::Params    log_x_;
+    std::vector<real_type> host_dxs_min_;
+    std::vector<real_type> host_cdf_;
+    std::vector<real_type> host_alias_prob_;
+    std::vector<size_type> host_alias_idx_;
+
+    DeviceVector<real_type> device_dxs_min_;
+    DeviceVector<real_type> device_cdf_;
+    DeviceVector<real_type> device_alias_prob_;
+    DeviceVector<size_type> device_alias_idx_;
+
+    // Build the alias tables of one row
+    void build_alias(size_type row);
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
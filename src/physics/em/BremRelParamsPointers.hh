@@ -0,0 +1,95 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BremRelParamsPointers.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Assert.hh"
+#include "base/Macros.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "base/UniformGrid.hh"
+#include "physics/material/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulated bremsstrahlung photon spectra, all elements.
+ *
+ * Tables are stored at every point of a uniform grid in the logarithm of the
+ * incident kinetic energy \f$ T \f$. For each element and grid point ("row")
+ * the running integral
+ * \f[
+   C(x) = \int_{x_\mathrm{min}}^{x} k \frac{d\sigma}{dk}\, d\ln x'
+ * \f]
+ * of the scaled differential cross section over the photon energy fraction
+ * \f$ x = k / T \f$ is stored [cm^2] on a grid uniform in \f$ \ln x \f$ that
+ * ends at \f$ x = 1 \f$. Since \f$ k\,d\sigma/dk \f$ is nearly constant at
+ * small \f$ x \f$, the integral below the grid is extrapolated linearly using
+ * the tabulated value at \f$ x_\mathrm{min} \f$. The cross section for
+ * emitting a photon above a production cut \f$ k_c \f$ is then
+ * \f$ C(1) - C(k_c / T) \f$.
+ *
+ * The photon spectrum above any cut is sampled from the same piecewise
+ * constant integrand. For each row and each starting bin \f$ s \f$ there is
+ * an alias table over the bins \f$ s, \ldots, N - 2 \f$ of the
+ * \f$ \ln x \f$ grid, so that the bins above the cut are sampled in
+ * constant time. The \f$ N(N-1)/2 \f$ entries of a row's tables are stored
+ * contiguously in order of increasing \f$ s \f$.
+ *
+ * \sa BremRelParams (owns the pointed-to data)
+ * \sa BremRelInteractor (samples the photon energy)
+ */
+struct BremRelParamsPointers
+{
+    UniformGrid::Params   log_energy; //!< Kinetic energy grid [ln MeV]
+    UniformGrid::Params   log_x;      //!< Energy fraction grid [ln(k/T)]
+    Span<const real_type> dxs_min;    //!< k dsigma/dk at x_min [cm^2]
+    Span<const real_type> cdf;        //!< Running integral C [cm^2]
+    Span<const real_type> alias_prob; //!< Alias acceptance probabilities
+    Span<const size_type> alias_idx;  //!< Alias bin offsets
+
+    //! Check whether the interface is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return log_energy && log_x && !dxs_min.empty()
+               && dxs_min.size() % log_energy.size == 0
+               && cdf.size() == dxs_min.size() * log_x.size
+               && alias_prob.size() == dxs_min.size() * this->alias_size()
+               && alias_idx.size() == alias_prob.size();
+    }
+
+    //! Number of elements
+    CELER_FUNCTION size_type num_elements() const
+    {
+        return dxs_min.size() / log_energy.size;
+    }
+
+    //! Index of the table row of an element at an energy grid point
+    CELER_FUNCTION size_type row(ElementDefId el, size_type energy_idx) const
+    {
+        REQUIRE(el < this->num_elements());
+        REQUIRE(energy_idx < log_energy.size);
+        return el.get() * log_energy.size + energy_idx;
+    }
+
+    //! Number of alias table entries in a row
+    CELER_FUNCTION size_type alias_size() const
+    {
+        return log_x.size * (log_x.size - 1) / 2;
+    }
+
+    //! Offset in a row of the alias table that starts at the given bin
+    CELER_FUNCTION size_type alias_offset(size_type bin) const
+    {
+        REQUIRE(bin + 1 < log_x.size);
+        return bin * (2 * log_x.size - 1 - bin) / 2;
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
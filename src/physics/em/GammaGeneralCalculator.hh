@@ -0,0 +1,71 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file GammaGeneralCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/base/Types.hh"
+#include "physics/base/Units.hh"
+#include "physics/material/MaterialTrackView.hh"
+#include "GammaGeneralParamsPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Look up the total photon cross section and sample the interacting model.
+ *
+ * The grid location of the photon energy is found once at construction, and
+ * both the total cross section and the channel fractions are linearly
+ * interpolated in \f$ \ln E \f$ at that location, so a lookup costs a single
+ * logarithm. Energies outside the grid use the values at the nearest end. The total cross section is scaled by the density
+ * of the track's material; the channel fractions are independent of it.
+ *
+ * \code
+    GammaGeneralCalculator calc(gg_pointers, material, particle.energy());
+    real_type macro_xs = calc.macro_xs();
+    ...
+    physics.model_id(calc(rng));
+   \endcode
+ */
+class GammaGeneralCalculator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
+  public:
+    // Construct from tables, material, and photon energy
+    inline CELER_FUNCTION
+    GammaGeneralCalculator(const GammaGeneralParamsPointers& data,
+                           const MaterialTrackView&          material,
+                           MevEnergy                         energy);
+
+    // Total macroscopic cross section [1/cm]
+    inline CELER_FUNCTION real_type macro_xs() const;
+
+    // Model of the channel at the given cumulative fraction in [0, 1)
+    inline CELER_FUNCTION ModelId select(real_type xi) const;
+
+    // Sample the model of the interacting channel
+    template<class Engine>
+    inline CELER_FUNCTION ModelId operator()(Engine& rng) const;
+
+  private:
+    const GammaGeneralParamsPointers& data_;
+    size_type                         point_; // Lower grid point
+    real_type                         frac_;  // Interpolation fraction
+    real_type                         density_scale_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "GammaGeneralCalculator.i.hh"
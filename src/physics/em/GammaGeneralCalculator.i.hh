@@ -0,0 +1,94 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file GammaGeneralCalculator.i.hh
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include "base/Assert.hh"
+#include "base/UniformGrid.hh"
+#include "random/distributions/GenerateCanonical.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from tables, material, and photon energy.
+ */
+CELER_FUNCTION
+GammaGeneralCalculator::GammaGeneralCalculator(
+    const GammaGeneralParamsPointers& data,
+    const MaterialTrackView&          material,
+    MevEnergy                         energy)
+    : data_(data), density_scale_(material.density_scale())
+{
+    REQUIRE(data_);
+    REQUIRE(energy.value() > 0);
+
+    const UniformGrid loge_grid(data_.log_energy);
+    const real_type   loge = std::log(energy.value());
+    size_type         bin;
+    if (loge <= loge_grid.front())
+    {
+        bin   = 0;
+        frac_ = 0;
+    }
+    else if (loge >= loge_grid.back())
+    {
+        bin   = loge_grid.size() - 2;
+        frac_ = 1;
+    }
+    else
+    {
+        bin   = loge_grid.find(loge);
+        frac_ = (loge - loge_grid[bin]) / data_.log_energy.delta;
+    }
+    point_ = data_.row_offset(material.def_id()) + bin;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Total macroscopic cross section [1/cm].
+ */
+CELER_FUNCTION real_type GammaGeneralCalculator::macro_xs() const
+{
+    const real_type* xs = data_.total_xs.data() + point_;
+    return ((1 - frac_) * xs[0] + frac_ * xs[1]) * density_scale_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Model of the channel at the given cumulative fraction.
+ *
+ * The channels are searched linearly, since there are only a handful.
+ */
+CELER_FUNCTION ModelId GammaGeneralCalculator::select(real_type xi) const
+{
+    REQUIRE(xi >= 0 && xi < 1);
+    const size_type  num_channels = data_.num_channels();
+    const real_type* cdf_lo = data_.cdf.data() + point_ * num_channels;
+    const real_type* cdf_hi = cdf_lo + num_channels;
+
+    size_type channel = 0;
+    while (channel + 1 < num_channels
+           && !(xi < (1 - frac_) * cdf_lo[channel] + frac_ * cdf_hi[channel]))
+    {
+        ++channel;
+    }
+    return data_.models[channel];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the model of the interacting channel.
+ */
+template<class Engine>
+CELER_FUNCTION ModelId GammaGeneralCalculator::operator()(Engine& rng) const
+{
+    return this->select(generate_canonical(rng));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,108 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file GammaGeneralParams.cc
+//---------------------------------------------------------------------------//
+#include "GammaGeneralParams.hh"
+
+#include "base/Range.hh"
+#include "comm/Device.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct by summing the sub-process cross sections.
+ *
+ * Where the total cross section is zero (e.g. in vacuum) the first channel is
+ * given the full fraction, although it will never be sampled.
+ */
+GammaGeneralParams::GammaGeneralParams(const MaterialParams& materials,
+                                       const Input&          inp)
+    : log_energy_(inp.log_energy), num_materials_(materials.num_materials())
+{
+    REQUIRE(inp.log_energy);
+    REQUIRE(!inp.channels.empty());
+
+    const size_type num_channels = inp.channels.size();
+    const size_type num_points   = num_materials_ * log_energy_.size;
+    for (const ChannelInput& channel : inp.channels)
+    {
+        REQUIRE(channel.model);
+        REQUIRE(channel.xs.size() == num_points);
+        host_models_.push_back(channel.model);
+    }
+
+    host_total_xs_.resize(num_points);
+    host_cdf_.resize(num_points * num_channels);
+    for (auto i : range(num_points))
+    {
+        real_type total = 0;
+        for (const ChannelInput& channel : inp.channels)
+        {
+            REQUIRE(channel.xs[i] >= 0);
+            total += channel.xs[i];
+        }
+        host_total_xs_[i] = total;
+
+        real_type* cdf   = host_cdf_.data() + i * num_channels;
+        real_type  accum = 0;
+        for (auto c : range(num_channels))
+        {
+            accum += inp.channels[c].xs[i];
+            cdf[c] = total > 0 ? accum / total : 1;
+        }
+        // Eliminate roundoff so the last channel is always selectable
+        cdf[num_channels - 1] = 1;
+    }
+
+    if (celeritas::is_device_enabled())
+    {
+        device_models_ = DeviceVector<ModelId>(host_models_.size());
+        device_models_.copy_to_device(make_span(host_models_));
+        device_total_xs_ = DeviceVector<real_type>(host_total_xs_.size());
+        device_total_xs_.copy_to_device(make_span(host_total_xs_));
+        device_cdf_ = DeviceVector<real_type>(host_cdf_.size());
+        device_cdf_.copy_to_device(make_span(host_cdf_));
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access tables on the host.
+ */
+GammaGeneralParamsPointers GammaGeneralParams::host_pointers() const
+{
+    GammaGeneralParamsPointers result;
+    result.log_energy    = log_energy_;
+    result.num_materials = num_materials_;
+    result.models        = make_span(host_models_);
+    result.total_xs      = make_span(host_total_xs_);
+    result.cdf           = make_span(host_cdf_);
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access tables on the device.
+ */
+GammaGeneralParamsPointers GammaGeneralParams::device_pointers() const
+{
+    REQUIRE(!device_total_xs_.empty());
+    GammaGeneralParamsPointers result;
+    result.log_energy    = log_energy_;
+    result.num_materials = num_materials_;
+    result.models        = device_models_.device_pointers();
+    result.total_xs      = device_total_xs_.device_pointers();
+    result.cdf           = device_cdf_.device_pointers();
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
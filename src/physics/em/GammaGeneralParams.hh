@@ -0,0 +1,77 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file GammaGeneralParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+#include "base/DeviceVector.hh"
+#include "base/Types.hh"
+#include "base/UniformGrid.hh"
+#include "physics/base/Types.hh"
+#include "physics/material/MaterialParams.hh"
+#include "GammaGeneralParamsPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Single cross section table for all photon processes.
+ *
+ * This is analogous to Geant4's \c G4GammaGeneralProcess. Rather than
+ * evaluating the cross sections of photoelectric absorption, Compton
+ * scattering, pair production, and Rayleigh scattering separately at every
+ * step, the macroscopic cross sections are summed at setup into one total
+ * table per material. Sampling the distance to interaction then takes a
+ * single lookup, and the interaction is chosen from the tabulated fraction of
+ * each sub-process at the same grid location. The selected model's
+ * interactor is then applied through a \c ModelDispatcher.
+ *
+ * The input cross sections of each channel are on a common energy grid
+ * uniform in log energy, e.g. evaluated from each process's \c macro_xs
+ * grid.
+ */
+class GammaGeneralParams
+{
+  public:
+    //! Macroscopic cross sections of a single sub-process
+    struct ChannelInput
+    {
+        ModelId                model; //!< Model that samples the interaction
+        std::vector<real_type> xs;    //!< [material][energy] [1/cm]
+    };
+
+    //! Input data to construct this class
+    struct Input
+    {
+        UniformGrid::Params       log_energy; //!< Energy grid [ln MeV]
+        std::vector<ChannelInput> channels;
+    };
+
+  public:
+    // Construct by summing the sub-process cross sections
+    GammaGeneralParams(const MaterialParams& materials, const Input& inp);
+
+    // Access tables on the host
+    GammaGeneralParamsPointers host_pointers() const;
+
+    // Access tables on the device
+    GammaGeneralParamsPointers device_pointers() const;
+
+  private:
+    UniformGrid::Params    log_energy_;
+    size_type              num_materials_;
+    std::vector<ModelId>   host_models_;
+    std::vector<real_type> host_total_xs_;
+    std::vector<real_type> host_cdf_;
+
+    DeviceVector<ModelId>   device_models_;
+    DeviceVector<real_type> device_total_xs_;
+    DeviceVector<real_type> device_cdf_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
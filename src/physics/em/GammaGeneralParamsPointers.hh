@@ -0,0 +1,60 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file GammaGeneralParamsPointers.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Assert.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "base/UniformGrid.hh"
+#include "physics/base/Types.hh"
+#include "physics/material/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Combined photon cross sections, all materials.
+ *
+ * The total macroscopic cross section is stored at every point of a uniform
+ * grid in \f$ \ln(E / \mathrm{MeV}) \f$, indexed as [material][energy]. The
+ * cumulative fraction of the total due to each sub-process ("channel") is
+ * stored as [material][energy][channel]; the last channel's fraction is
+ * always one. Each channel is sampled by a single model.
+ *
+ * \sa GammaGeneralParams (owns the pointed-to data)
+ * \sa GammaGeneralCalculator (looks up and samples the data)
+ */
+struct GammaGeneralParamsPointers
+{
+    UniformGrid::Params   log_energy; //!< Energy grid [ln MeV]
+    size_type             num_materials = 0;
+    Span<const ModelId>   models;   //!< Model [channel]
+    Span<const real_type> total_xs; //!< Cross section [1/cm]
+    Span<const real_type> cdf;      //!< Cumulative channel fraction
+
+    //! Check whether the interface is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return log_energy && num_materials > 0 && !models.empty()
+               && total_xs.size() == num_materials * log_energy.size
+               && cdf.size() == total_xs.size() * models.size();
+    }
+
+    //! Number of sub-processes
+    CELER_FUNCTION size_type num_channels() const { return models.size(); }
+
+    //! Start of the row of a material in the total cross section array
+    CELER_FUNCTION size_type row_offset(MaterialDefId material) const
+    {
+        REQUIRE(material < num_materials);
+        return material.get() * log_energy.size;
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -7,8 +7,10 @@
 //---------------------------------------------------------------------------//
 #include "LivermoreParams.hh"
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
+#include <utility>
 #include "base/Range.hh"
 #include "base/SoftEqual.hh"
 #include "base/SpanRemapper.hh"
@@ -16,6 +18,88 @@
 
 namespace celeritas
 {
+//---------------------------------------------------------------------------//
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Bisect the intervals between edges until the shared grid meets tolerance.
+ *
+ * Returns the grid energies, starting at the lowest edge.
+ */
+std::vector<real_type>
+bisect_shell_grids(const std::vector<ValueGrid>& shell_grids,
+                   const std::vector<real_type>& edges,
+                   const std::vector<real_type>& tab_energy,
+                   real_type                     tol)
+{
+    // Relative error of interpolating the open subshells across an interval
+    auto calc_error = [&](real_type lo, real_type hi) {
+        std::vector<real_type> test_energy{(3 * lo + hi) / 4,
+                                           (lo + hi) / 2,
+                                           (lo + 3 * hi) / 4};
+        test_energy.insert(
+            test_energy.end(),
+            std::upper_bound(tab_energy.begin(), tab_energy.end(), lo),
+            std::lower_bound(tab_energy.begin(), tab_energy.end(), hi));
+
+        real_type result = 0;
+        for (real_type energy : test_energy)
+        {
+            const real_type frac  = (energy - lo) / (hi - lo);
+            real_type       total = 0;
+            real_type       error = 0;
+            for (const ValueGrid& grid : shell_grids)
+            {
+                if (energy <= grid.energy.front())
+                    continue;
+
+                XsCalculator    calc_xs(grid);
+                const real_type xs_lo = calc_xs(lo);
+                const real_type xs    = calc_xs(energy);
+                total += xs;
+                error += std::fabs(xs_lo + frac * (calc_xs(hi) - xs_lo) - xs);
+            }
+            if (total > 0)
+            {
+                result = std::max(result, error / total);
+            }
+        }
+        return result;
+    };
+
+    // Bisect the intervals between edges, lowest first, until converged
+    constexpr real_type min_ratio = 1.0001;
+    std::vector<real_type> result{edges.front()};
+    std::vector<std::pair<real_type, real_type>> intervals;
+    for (auto i = edges.size() - 1; i > 0; --i)
+    {
+        intervals.push_back({edges[i - 1], edges[i]});
+    }
+    while (!intervals.empty())
+    {
+        real_type lo = intervals.back().first;
+        real_type hi = intervals.back().second;
+        intervals.pop_back();
+        if (hi > min_ratio * lo && calc_error(lo, hi) > tol)
+        {
+            const real_type mid = std::sqrt(lo * hi);
+            intervals.push_back({mid, hi});
+            intervals.push_back({lo, mid});
+        }
+        else
+        {
+            result.push_back(hi);
+        }
+    }
+
+    ENSURE(result.back() == edges.back());
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct from a vector of element identifiers.
@@ -24,20 +108,32 @@ LivermoreParams::LivermoreParams(const Input& inp)
 {
     REQUIRE(!inp.elements.empty());
 
+    REQUIRE(inp.shell_xs_tol >= 0);
+
+    // Sample the tabulated subshell cross sections on one grid per element
+    std::vector<ShellGrid> shell_grids;
+    shell_grids.reserve(inp.elements.size());
+    for (const auto& el : inp.elements)
+    {
+        shell_grids.push_back(resample_shell_grids(el, inp.shell_xs_tol));
+    }
+
     // Reserve host space (MUST reserve subshells and cross section data to
     // avoid invalidating spans).
     size_type subshell_size = 0;
     size_type data_size     = 0;
-    for (const auto& el : inp.elements)
+    for (auto i : range(inp.elements.size()))
     {
+        const auto& el = inp.elements[i];
         subshell_size += el.shells.size();
         data_size += el.xs_low.x.size() + el.xs_low.y.size()
-                     + el.xs_high.x.size() + el.xs_high.y.size();
+                     + el.xs_high.x.size() + el.xs_high.y.size()
+                     + shell_grids[i].energy.size()
+                     + shell_grids[i].cum_xs.size();
 
         for (const auto& shell : el.shells)
         {
-            data_size += shell.param_low.size() + shell.param_high.size()
-                         + shell.xs.size() + shell.energy.size();
+            data_size += shell.param_low.size() + shell.param_high.size();
         }
     }
     host_elements_.reserve(inp.elements.size());
@@ -45,48 +141,18 @@ LivermoreParams::LivermoreParams(const Input& inp)
     host_data_.reserve(data_size);
 
     // Build elements
-    for (const auto& el : inp.elements)
+    for (auto i : range(inp.elements.size()))
     {
-        this->append_livermore_element(el);
+        this->append_livermore_element(inp.elements[i], shell_grids[i]);
     }
 
     if (celeritas::is_device_enabled())
     {
-        // Allocate device vectors
-        device_elements_
-            = DeviceVector<LivermoreElement>{host_elements_.size()};
-        device_shells_ = DeviceVector<LivermoreSubshell>{host_shells_.size()};
-        device_data_   = DeviceVector<real_type>{host_data_.size()};
-
-        // Remap shell->data spans
-        auto remap_data = make_span_remapper(make_span(host_data_),
-                                             device_data_.device_pointers());
-        std::vector<LivermoreSubshell> temp_device_shells = host_shells_;
-        for (LivermoreSubshell& shell : temp_device_shells)
-        {
-            shell.xs.energy  = remap_data(shell.xs.energy);
-            shell.xs.xs      = remap_data(shell.xs.xs);
-            shell.param_low  = remap_data(shell.param_low);
-            shell.param_high = remap_data(shell.param_high);
-        }
-
-        // Remap element->shell spans and element->data spans
-        auto remap_shells = make_span_remapper(
-            make_span(host_shells_), device_shells_.device_pointers());
-        std::vector<LivermoreElement> temp_device_elements = host_elements_;
-        for (LivermoreElement& el : temp_device_elements)
-        {
-            el.xs_low.energy  = remap_data(el.xs_low.energy);
-            el.xs_low.xs      = remap_data(el.xs_low.xs);
-            el.xs_high.energy = remap_data(el.xs_high.energy);
-            el.xs_high.xs     = remap_data(el.xs_high.xs);
-            el.shells         = remap_shells(el.shells);
-        }
-
-        // Copy vectors to device
-        device_elements_.copy_to_device(make_span(temp_device_elements));
-        device_shells_.copy_to_device(make_span(temp_device_shells));
-        device_data_.copy_to_device(make_span(host_data_));
+        // Upload all data in a single copy
+        ParamsImage image = this->make_image();
+        device_image_     = image.copy_to_device();
+        device_ptrs_      = image.root<LivermoreParamsPointers>(
+            device_image_.device_pointers().data());
     }
 
     ENSURE(host_elements_.size() == inp.elements.size());
@@ -113,20 +179,189 @@ LivermoreParamsPointers LivermoreParams::host_pointers() const
  */
 LivermoreParamsPointers LivermoreParams::device_pointers() const
 {
-    LivermoreParamsPointers result;
-    result.elements = device_elements_.device_pointers();
+    ENSURE(device_ptrs_);
+    return device_ptrs_;
+}
 
-    ENSURE(result);
+//---------------------------------------------------------------------------//
+/*!
+ * Pack Livermore data into a relocatable image.
+ *
+ * The root of the image is a \c LivermoreParamsPointers . Every span in the
+ * elements and subshells is registered as a relocation.
+ */
+ParamsImage LivermoreParams::make_image() const
+{
+    ParamsImage result(
+        ParamsImage::padded_size<LivermoreParamsPointers>(1)
+        + ParamsImage::padded_size<LivermoreElement>(host_elements_.size())
+        + ParamsImage::padded_size<LivermoreSubshell>(host_shells_.size())
+        + ParamsImage::padded_size<real_type>(host_data_.size()));
+
+    LivermoreParamsPointers& root
+        = result.allocate<LivermoreParamsPointers>(1).front();
+    auto elements = result.insert(make_span(host_elements_));
+    auto shells   = result.insert(make_span(host_shells_));
+    auto data     = result.insert(make_span(host_data_));
+
+    // Remap shell->data spans
+    auto remap_data = make_span_remapper(make_span(host_data_), data);
+    for (LivermoreSubshell& shell : shells)
+    {
+        shell.param_low  = remap_data(shell.param_low);
+        shell.param_high = remap_data(shell.param_high);
+        result.add_relocation(shell.param_low);
+        result.add_relocation(shell.param_high);
+    }
+
+    // Remap element->shell spans and element->data spans
+    auto remap_shells = make_span_remapper(make_span(host_shells_), shells);
+    for (LivermoreElement& el : elements)
+    {
+        el.xs_low.energy  = remap_data(el.xs_low.energy);
+        el.xs_low.xs      = remap_data(el.xs_low.xs);
+        el.xs_high.energy = remap_data(el.xs_high.energy);
+        el.xs_high.xs     = remap_data(el.xs_high.xs);
+        el.shells         = remap_shells(el.shells);
+        el.shell_energy   = remap_data(el.shell_energy);
+        el.shell_cum_xs   = remap_data(el.shell_cum_xs);
+        result.add_relocation(el.xs_low.energy);
+        result.add_relocation(el.xs_low.xs);
+        result.add_relocation(el.xs_high.energy);
+        result.add_relocation(el.xs_high.xs);
+        result.add_relocation(el.shells);
+        result.add_relocation(el.shell_energy);
+        result.add_relocation(el.shell_cum_xs);
+    }
+
+    root.elements = elements;
+    result.add_relocation(root.elements);
+
+    ENSURE(result.size() == result.capacity());
     return result;
 }
 
 //---------------------------------------------------------------------------//
 // IMPLEMENTATION
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulate cumulative subshell cross sections on a shared energy grid.
+ *
+ * Each row holds the running sum over subshells of the cross sections of the
+ * open subshells, so that sampling a subshell needs no accumulation at run
+ * time. A subshell is open above the first energy of its table (its binding
+ * energy); above the end of its table its cross section is clamped to the
+ * last value, as in \c XsCalculator . Every edge below the threshold gets two
+ * rows, one without and one with the subshell that opens there, so that
+ * interpolation is exact on both sides of the edge.
+ *
+ * With a zero tolerance the grid is the union of the subshell grid points
+ * below the low energy threshold plus the threshold itself. Linear
+ * interpolation on it then reproduces the linear interpolation on each
+ * subshell's own grid exactly.
+ *
+ * A nonzero tolerance resamples the cross sections instead. The grid starts
+ * from the subshell binding energies below the threshold (the first tabulated
+ * energy of each subshell) and the threshold itself, so that every absorption
+ * edge is a grid point. Each interval is bisected in log energy until linear
+ * interpolation on the shared grid matches the subshell cross sections to
+ * within the relative tolerance: the summed error over the open subshells
+ * must not exceed the tolerance times their total cross section at any
+ * tabulated energy or quarter point in the interval. The tabulated cross
+ * sections fall steeply just above each edge and are smooth elsewhere, so
+ * this needs fewer points than the union grid and, at a 1% tolerance, less
+ * memory than the separate tables.
+ */
+auto LivermoreParams::resample_shell_grids(const ElementInput& inp,
+                                           real_type tol) -> ShellGrid
+{
+    REQUIRE(!inp.shells.empty());
+    REQUIRE(tol >= 0);
+
+    const real_type        thresh = inp.thresh_low.value();
+    std::vector<ValueGrid> shell_grids;
+    std::vector<real_type> edges;
+    std::vector<real_type> tab_energy;
+    for (const auto& shell : inp.shells)
+    {
+        REQUIRE(!shell.energy.empty()
+                && shell.energy.size() == shell.xs.size());
+        ValueGrid grid;
+        grid.energy = make_span(shell.energy);
+        grid.xs     = make_span(shell.xs);
+        grid.interp = Interp::linear;
+        shell_grids.push_back(grid);
+
+        if (shell.energy.front() < thresh)
+        {
+            edges.push_back(shell.energy.front());
+        }
+        for (real_type energy : shell.energy)
+        {
+            if (energy < thresh)
+                tab_energy.push_back(energy);
+        }
+    }
+    edges.push_back(thresh);
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    std::sort(tab_energy.begin(), tab_energy.end());
+
+    std::vector<real_type> energy;
+    if (tol == 0)
+    {
+        // Take the sorted union of the edges and tabulated energies
+        energy.resize(edges.size() + tab_energy.size());
+        std::merge(edges.begin(),
+                   edges.end(),
+                   tab_energy.begin(),
+                   tab_energy.end(),
+                   energy.begin());
+        energy.erase(std::unique(energy.begin(), energy.end()), energy.end());
+    }
+    else
+    {
+        energy = bisect_shell_grids(shell_grids, edges, tab_energy, tol);
+    }
+
+    // Accumulate the open subshell cross sections at every grid point
+    const size_type num_shells = inp.shells.size();
+    ShellGrid       result;
+    auto            append_row = [&](real_type e, bool include_edge) {
+        result.energy.push_back(e);
+        real_type cum_xs = 0;
+        for (const ValueGrid& grid : shell_grids)
+        {
+            const real_type edge = grid.energy.front();
+            if (edge < e || (include_edge && edge == e))
+            {
+                cum_xs += XsCalculator(grid)(e);
+            }
+            result.cum_xs.push_back(cum_xs);
+        }
+    };
+    for (real_type e : energy)
+    {
+        if (e < thresh && std::binary_search(edges.begin(), edges.end(), e))
+        {
+            // Cross sections just below an absorption edge
+            append_row(e, false);
+        }
+        append_row(e, true);
+    }
+
+    ENSURE(result.energy.size() > 1);
+    ENSURE(result.cum_xs.size() == result.energy.size() * num_shells);
+    ENSURE(result.energy.back() == thresh);
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Convert an element input to a LivermoreElement and store.
  */
-void LivermoreParams::append_livermore_element(const ElementInput& inp)
+void LivermoreParams::append_livermore_element(const ElementInput& inp,
+                                               const ShellGrid&    grid)
 {
     LivermoreElement result;
 
@@ -138,6 +373,8 @@ void LivermoreParams::append_livermore_element(const ElementInput& inp)
     result.xs_high.xs     = this->extend_data(inp.xs_high.y);
     result.xs_low.interp  = Interp::linear; // TODO: spline
     result.shells         = this->extend_shells(inp);
+    result.shell_energy   = this->extend_data(grid.energy);
+    result.shell_cum_xs   = this->extend_data(grid.cum_xs);
     result.thresh_low     = inp.thresh_low;
     result.thresh_high    = inp.thresh_high;
 
@@ -159,13 +396,10 @@ Span<LivermoreSubshell> LivermoreParams::extend_shells(const ElementInput& inp)
     Span<LivermoreSubshell> result{host_shells_.data() + start_size,
                                    inp.shells.size()};
 
-    // Store binding energy, fit parameters, and tabulated cross sections
+    // Store binding energy and fit parameters
     for (auto i : range(inp.shells.size()))
     {
         result[i].binding_energy = inp.shells[i].binding_energy;
-        result[i].xs.energy      = this->extend_data(inp.shells[i].energy);
-        result[i].xs.xs          = this->extend_data(inp.shells[i].xs);
-        result[i].xs.interp      = Interp::linear;
         result[i].param_low      = this->extend_data(inp.shells[i].param_low);
         result[i].param_high     = this->extend_data(inp.shells[i].param_high);
     }
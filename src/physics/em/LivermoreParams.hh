@@ -7,7 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
-#include "base/DeviceVector.hh"
+#include "base/DeviceAllocation.hh"
+#include "base/ParamsImage.hh"
 #include "io/ImportPhysicsVector.hh"
 #include "physics/material/Types.hh"
 #include "LivermoreParamsPointers.hh"
@@ -51,6 +52,10 @@ class LivermoreParams
     struct Input
     {
         std::vector<ElementInput> elements;
+
+        //! Relative error allowed when resampling the subshell cross
+        //! sections (zero keeps the exact union of the subshell grids)
+        real_type shell_xs_tol = 0;
     };
 
   public:
@@ -63,17 +68,29 @@ class LivermoreParams
     // Access Livermore data on the device
     LivermoreParamsPointers device_pointers() const;
 
+    // Pack Livermore data into a relocatable image
+    ParamsImage make_image() const;
+
   private:
     std::vector<LivermoreElement>  host_elements_;
     std::vector<LivermoreSubshell> host_shells_;
     std::vector<real_type>         host_data_;
 
-    DeviceVector<LivermoreElement>  device_elements_;
-    DeviceVector<LivermoreSubshell> device_shells_;
-    DeviceVector<real_type>         device_data_;
+    DeviceAllocation        device_image_;
+    LivermoreParamsPointers device_ptrs_;
+
+    // Cumulative subshell cross sections of an element on a shared grid
+    struct ShellGrid
+    {
+        std::vector<real_type> energy;
+        std::vector<real_type> cum_xs; //!< [energy][shell]
+    };
 
     // HELPER FUNCTIONS
-    void                    append_livermore_element(const ElementInput& inp);
+    static ShellGrid        resample_shell_grids(const ElementInput& inp,
+                                                 real_type           tol);
+    void                    append_livermore_element(const ElementInput& inp,
+                                                     const ShellGrid&    grid);
     Span<LivermoreSubshell> extend_shells(const ElementInput& inp);
     Span<real_type>         extend_data(const std::vector<real_type>& data);
 };
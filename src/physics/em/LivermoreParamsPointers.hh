@@ -24,10 +24,6 @@ struct LivermoreSubshell
     // Binding energy of the electron
     units::MevEnergy binding_energy;
 
-    // Tabulated subshell photoionization cross section (used below 5 keV)
-    // TODO: value grid
-    ValueGrid xs;
-
     // Fit parameters for the integrated subshell photoionization cross
     // sections in the two different energy ranges (used above 5 keV)
     Span<const real_type> param_low;
@@ -56,6 +52,15 @@ struct LivermoreElement
 
     Span<const LivermoreSubshell> shells;
 
+    // Cumulative tabulated subshell photoionization cross sections (used
+    // below the low energy threshold) on a single energy grid shared by all
+    // subshells. Entry [energy][shell] is the sum of the cross sections of
+    // the open subshells up to and including that shell, so the values for
+    // every subshell at a grid point are contiguous. Each absorption edge
+    // appears twice: the first row excludes the subshell that opens there.
+    Span<const real_type> shell_energy;
+    Span<const real_type> shell_cum_xs;
+
     // Energy threshold for using the parameterized subshell cross sections in
     // the lower and upper energy range
     units::MevEnergy thresh_low;
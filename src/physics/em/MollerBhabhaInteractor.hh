@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "base/Array.hh"
 #include "base/Macros.hh"
 #include "base/Types.hh"
 #include "physics/base/Interaction.hh"
@@ -20,20 +21,47 @@ namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Brief class description.
+ * Moller (e-e-) and Bhabha (e+e-) scattering with delta-ray production.
  *
- * This is a model for XXXX process. Additional description
+ * The incident electron or positron knocks out a single atomic electron, with
+ * binding neglected, whose kinetic energy is above the electron production
+ * cut \f$ T_c \f$ of the material. Softer collisions are part of the
+ * continuous energy loss. The maximum energy transfer is \f$ T/2 \f$ for
+ * electrons (the faster of the two identical outgoing electrons is the
+ * primary) and \f$ T \f$ for positrons.
+ *
+ * The energy fraction \f$ \epsilon \f$ of the delta ray is sampled from
+ * \f$ 1/\epsilon^2 \f$ and accepted with the ratio of the full differential
+ * cross section to its envelope. The coefficients of the rejection function
+ * and its maximum depend only on the incident energy and the cut, so they
+ * are computed once at construction.
+ *
+ * The cut is the electron production threshold of the track's material:
+ * \code
+    CutView cuts(cut_pointers, material.def_id());
+    MollerBhabhaInteractor interact(shared, cuts.energy(shared.electron_id),
+                                    particle, direction, allocate);
+   \endcode
+ * and must be below the maximum energy transfer, i.e. the restricted cross
+ * section from \c MollerBhabhaMicroXsCalculator must be nonzero.
  *
  * \note This performs the same sampling routine as in Geant4's
- * XXXX class, as documented in section XXX of the Geant4 Physics
- * Reference (release 10.6).
+ * G4MollerBhabhaModel class, as documented in section 10.1 of the Geant4
+ * Physics Reference (release 10.6).
  */
 class MollerBhabhaInteractor
 {
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
   public:
     // Construct with shared and state data
     inline CELER_FUNCTION
     MollerBhabhaInteractor(const MollerBhabhaInteractorPointers& shared,
+                           MevEnergy                             electron_cut,
                            const ParticleTrackView&              particle,
                            const Real3&                          inc_direction,
                            SecondaryAllocatorView&               allocate);
@@ -45,26 +73,45 @@ class MollerBhabhaInteractor
     //// COMMON PROPERTIES ////
 
     //! Minimum incident energy for this model to be valid
-    static CELER_CONSTEXPR_FUNCTION units::MevEnergy min_incident_energy()
+    static CELER_CONSTEXPR_FUNCTION MevEnergy min_incident_energy()
     {
-        return units::MevEnergy{0}; // XXX
+        return MevEnergy{1e-3};
     }
 
     //! Maximum incident energy for this model to be valid
-    static CELER_CONSTEXPR_FUNCTION units::MevEnergy max_incident_energy()
+    static CELER_CONSTEXPR_FUNCTION MevEnergy max_incident_energy()
     {
-        return units::MevEnergy{0}; // XXX
+        return MevEnergy{1e8};
     }
 
   private:
     // Shared constant physics properties
     const MollerBhabhaInteractorPointers& shared_;
-    // Incident gamma energy
-    const units::MevEnergy inc_energy_;
+    // Incident kinetic energy
+    const MevEnergy inc_energy_;
+    // Incident momentum [MeV/c]
+    const real_type inc_momentum_;
+    // Incident mass [MeV/c^2]
+    const real_type inc_mass_;
+    // Whether the incident particle is an electron (Moller scattering)
+    const bool inc_is_electron_;
     // Incident direction
     const Real3& inc_direction_;
-    // Allocate space for one or more secondary particles
+    // Allocate space for the delta ray
     SecondaryAllocatorView& allocate_;
+
+    // Minimum and maximum energy transfer as a fraction of the energy
+    real_type min_x_;
+    real_type max_x_;
+    // Rejection function coefficients (electron: g; positron: beta^2 b_i)
+    Array<real_type, 4> coeffs_;
+    // Maximum of the rejection function on [min_x, max_x]
+    real_type max_rejection_;
+
+    // HELPER FUNCTIONS
+
+    inline CELER_FUNCTION real_type moller_rejection(real_type x) const;
+    inline CELER_FUNCTION real_type bhabha_rejection(real_type x) const;
 };
 
 //---------------------------------------------------------------------------//
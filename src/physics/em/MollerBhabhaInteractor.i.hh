@@ -6,59 +6,166 @@
 //! \file MollerBhabhaInteractor.i.hh
 //---------------------------------------------------------------------------//
 
+#include <cmath>
+#include "base/Algorithms.hh"
+#include "base/ArrayUtils.hh"
+#include "base/Assert.hh"
+#include "base/Constants.hh"
+#include "random/distributions/GenerateCanonical.hh"
+#include "random/distributions/UniformRealDistribution.hh"
+
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
  * Construct with shared and state data.
+ *
+ * The cut must be below the maximum energy transfer, i.e. the restricted
+ * cross section must be nonzero.
  */
 CELER_FUNCTION MollerBhabhaInteractor::MollerBhabhaInteractor(
     const MollerBhabhaInteractorPointers& shared,
+    MevEnergy                             electron_cut,
     const ParticleTrackView&              particle,
     const Real3&                          inc_direction,
     SecondaryAllocatorView&               allocate)
     : shared_(shared)
-    , inc_energy_(particle.energy().value())
+    , inc_energy_(particle.energy())
+    , inc_momentum_(particle.momentum().value())
+    , inc_mass_(particle.mass().value())
+    , inc_is_electron_(particle.def_id() == shared.electron_id)
     , inc_direction_(inc_direction)
     , allocate_(allocate)
 {
     REQUIRE(inc_energy_ >= this->min_incident_energy()
             && inc_energy_ <= this->max_incident_energy());
-    REQUIRE(particle.def_id() == shared_.gamma_id); // XXX
+    REQUIRE(particle.def_id() == shared_.electron_id
+            || particle.def_id() == shared_.positron_id);
+
+    min_x_ = electron_cut.value() / inc_energy_.value();
+    max_x_ = inc_is_electron_ ? real_type(0.5) : real_type(1);
+    REQUIRE(min_x_ > 0 && min_x_ < max_x_);
+
+    const real_type gamma    = 1 + inc_energy_.value() / inc_mass_;
+    const real_type gamma_sq = gamma * gamma;
+    if (inc_is_electron_)
+    {
+        // The rejection function increases monotonically with x
+        coeffs_[0]     = (2 * gamma - 1) / gamma_sq;
+        max_rejection_ = this->moller_rejection(max_x_);
+    }
+    else
+    {
+        const real_type beta_sq = 1 - 1 / gamma_sq;
+        const real_type y       = 1 / (1 + gamma);
+        const real_type y_sq    = y * y;
+        const real_type y12     = 1 - 2 * y;
+        const real_type y12_sq  = y12 * y12;
+        coeffs_[0]              = beta_sq * (2 - y_sq);
+        coeffs_[1]              = beta_sq * y12 * (3 + y_sq);
+        coeffs_[3]              = beta_sq * y12_sq * y12;
+        coeffs_[2]              = coeffs_[3] + beta_sq * y12_sq;
+
+        // Bound each (nonnegative) term of the polynomial separately
+        const real_type max_x_sq = max_x_ * max_x_;
+        max_rejection_ = 1 - min_x_ * coeffs_[0] + max_x_sq * coeffs_[1]
+                         - min_x_ * min_x_ * min_x_ * coeffs_[2]
+                         + max_x_sq * max_x_sq * coeffs_[3];
+    }
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Sample using the XXX model.
+ * Sample the delta ray energy and the exiting directions.
  */
 template<class Engine>
 CELER_FUNCTION Interaction MollerBhabhaInteractor::operator()(Engine& rng)
 {
-    // Allocate space for XXX (electron, multiple particles, ...)
-    Secondary* secondaries = this->allocate_(0); // XXX
-    if (secondaries == nullptr)
+    // Allocate space for the delta ray
+    SecondaryRecord* delta_record = this->allocate_(1);
+    if (delta_record == nullptr)
     {
         // Failed to allocate space for a secondary
         return Interaction::from_failure();
     }
 
-    // XXX sample
-    (void)sizeof(rng);
+    // Sample x from 1/x^2 on [min_x, max_x] and reject with the ratio of the
+    // differential cross section to the envelope
+    real_type x;
+    real_type rejection;
+    do
+    {
+        const real_type xi = generate_canonical(rng);
+        x         = min_x_ * max_x_ / (min_x_ * (1 - xi) + max_x_ * xi);
+        rejection = inc_is_electron_ ? this->moller_rejection(x)
+                                     : this->bhabha_rejection(x);
+    } while (max_rejection_ * generate_canonical(rng) > rejection);
+
+    // Delta ray direction from two-body kinematics
+    const real_type delta_energy   = x * inc_energy_.value();
+    const real_type delta_momentum = std::sqrt(
+        delta_energy * (delta_energy + 2 * inc_mass_));
+    const real_type delta_costheta
+        = min(delta_energy * (inc_energy_.value() + 2 * inc_mass_)
+                  / (delta_momentum * inc_momentum_),
+              real_type(1));
+    UniformRealDistribution<real_type> sample_phi(0, 2 * constants::pi);
+    const Real3                        delta_dir = rotate(
+        from_spherical(delta_costheta, sample_phi(rng)), inc_direction_);
 
     // Construct interaction for change to primary (incident) particle
     Interaction result;
-    result.action      = Action::scattered;                     // XXX
-    result.energy      = units::MevEnergy{inc_energy_.value()}; // XXX
+    result.action      = Action::scattered;
+    result.energy      = MevEnergy{inc_energy_.value() - delta_energy};
     result.direction   = inc_direction_;
-    result.secondaries = {secondaries, 1}; // XXX
+    result.secondaries = {delta_record, 1};
+
+    // Primary direction from momentum balance: p' = p - p_delta
+    if (result.energy > zero_quantity())
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            result.direction[i] = inc_momentum_ * inc_direction_[i]
+                                  - delta_momentum * delta_dir[i];
+        }
+        normalize_direction(&result.direction);
+    }
 
     // Save outgoing secondary data
-    secondaries[0].def_id    = shared_.electron_id; // XXX
-    secondaries[0].energy    = units::MevEnergy{0}; // XXX
-    secondaries[0].direction = {0, 0, 0};           // XXX
+    Secondary delta;
+    delta.def_id    = shared_.electron_id;
+    delta.energy    = MevEnergy{delta_energy};
+    delta.direction = delta_dir;
+    *delta_record   = SecondaryRecord(delta);
 
     return result;
 }
 
+//---------------------------------------------------------------------------//
+// PRIVATE HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Moller differential cross section relative to the 1/x^2 envelope.
+ */
+CELER_FUNCTION real_type
+MollerBhabhaInteractor::moller_rejection(real_type x) const
+{
+    const real_type g = coeffs_[0];
+    const real_type y = 1 - x;
+    return 1 - g * x + x * x * (1 - g + (1 - g * y) / (y * y));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Bhabha differential cross section relative to the 1/x^2 envelope.
+ */
+CELER_FUNCTION real_type
+MollerBhabhaInteractor::bhabha_rejection(real_type x) const
+{
+    const real_type x_sq = x * x;
+    return 1 - x * coeffs_[0] + x_sq * coeffs_[1] - x_sq * x * coeffs_[2]
+           + x_sq * x_sq * coeffs_[3];
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -0,0 +1,60 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file MollerBhabhaMicroXsCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "physics/base/Units.hh"
+#include "MollerBhabhaInteractorPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate Moller and Bhabha cross sections above an electron production cut.
+ *
+ * This is the analytic integral of the differential cross section sampled by
+ * \c MollerBhabhaInteractor between the cut and the maximum energy transfer,
+ * so the discrete step length is consistent with the delta rays that are
+ * produced. The result is per target electron: the macroscopic cross section
+ * is obtained by multiplying by the material's electron density.
+ */
+class MollerBhabhaMicroXsCalculator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
+  public:
+    // Construct with shared and state data
+    inline CELER_FUNCTION
+    MollerBhabhaMicroXsCalculator(const MollerBhabhaInteractorPointers& shared,
+                                  MevEnergy                electron_cut,
+                                  const ParticleTrackView& particle);
+
+    // Compute cross section per electron [cm^2]
+    inline CELER_FUNCTION real_type operator()() const;
+
+  private:
+    // Incident kinetic energy
+    real_type inc_energy_;
+    // Incident mass [MeV/c^2]
+    real_type inc_mass_;
+    // Whether the incident particle is an electron (Moller scattering)
+    bool inc_is_electron_;
+    // Electron production cut
+    real_type electron_cut_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "MollerBhabhaMicroXsCalculator.i.hh"
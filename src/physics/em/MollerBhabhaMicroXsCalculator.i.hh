@@ -0,0 +1,90 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file MollerBhabhaMicroXsCalculator.i.hh
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include "base/Assert.hh"
+#include "base/Constants.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with shared and state data.
+ */
+CELER_FUNCTION MollerBhabhaMicroXsCalculator::MollerBhabhaMicroXsCalculator(
+    const MollerBhabhaInteractorPointers& shared,
+    MevEnergy                             electron_cut,
+    const ParticleTrackView&              particle)
+    : inc_energy_(particle.energy().value())
+    , inc_mass_(particle.mass().value())
+    , inc_is_electron_(particle.def_id() == shared.electron_id)
+    , electron_cut_(electron_cut.value())
+{
+    REQUIRE(particle.def_id() == shared.electron_id
+            || particle.def_id() == shared.positron_id);
+    REQUIRE(electron_cut_ > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compute cross section per electron [cm^2].
+ *
+ * The cross section is zero if the cut is at or above the maximum energy
+ * transfer: half the kinetic energy for electrons and all of it for
+ * positrons.
+ */
+CELER_FUNCTION real_type MollerBhabhaMicroXsCalculator::operator()() const
+{
+    const real_type max_x = inc_is_electron_ ? real_type(0.5) : real_type(1);
+    const real_type min_x = electron_cut_ / inc_energy_;
+    if (min_x >= max_x)
+    {
+        return 0;
+    }
+
+    const real_type gamma    = 1 + inc_energy_ / inc_mass_;
+    const real_type gamma_sq = gamma * gamma;
+    const real_type beta_sq  = 1 - 1 / gamma_sq;
+    const real_type delta_x  = max_x - min_x;
+
+    real_type result;
+    if (inc_is_electron_)
+    {
+        const real_type g = (2 * gamma - 1) / gamma_sq;
+        result = (delta_x
+                      * (1 - g + 1 / (min_x * max_x)
+                         + 1 / ((1 - min_x) * (1 - max_x)))
+                  - g * std::log(max_x * (1 - min_x) / (min_x * (1 - max_x))))
+                 / beta_sq;
+    }
+    else
+    {
+        const real_type y      = 1 / (1 + gamma);
+        const real_type y_sq   = y * y;
+        const real_type y12    = 1 - 2 * y;
+        const real_type y12_sq = y12 * y12;
+        const real_type b1     = 2 - y_sq;
+        const real_type b2     = y12 * (3 + y_sq);
+        const real_type b4     = y12_sq * y12;
+        const real_type b3     = b4 + y12_sq;
+        result = delta_x
+                     * (1 / (beta_sq * min_x * max_x) + b2
+                        - real_type(0.5) * b3 * (min_x + max_x)
+                        + b4 * (min_x * min_x + min_x * max_x + max_x * max_x)
+                              / 3)
+                 - b1 * std::log(max_x / min_x);
+    }
+
+    // Prefactor 2 pi r_e^2 m c^2 / T
+    using constants::re_electron;
+    return 2 * constants::pi * re_electron * re_electron * inc_mass_ * result
+           / inc_energy_;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -33,6 +33,10 @@ namespace celeritas
  * are used. The angle of the emitted photoelectron is sampled from the
  * Sauter-Gavrila distribution.
  *
+ * The element's total microscopic cross section (the normalization for
+ * sampling the subshell) is usually already known from the element selection
+ * step, so it can be passed in directly rather than being recalculated.
+ *
  * \note This performs the same sampling routine as in Geant4's
  * G4LivermorePhotoElectricModel class, as documented in section 6.3.5 of the
  * Geant4 Physics Reference (release 10.6).
@@ -55,6 +59,16 @@ class PhotoelectricInteractor
                             const Real3&            inc_direction,
                             SecondaryAllocatorView& allocate);
 
+    // Construct with the element's precalculated micro cross section
+    inline CELER_FUNCTION
+    PhotoelectricInteractor(const PhotoelectricInteractorPointers& shared,
+                            const LivermoreParamsPointers&         data,
+                            ElementDefId                           el_id,
+                            real_type                              micro_xs,
+                            const ParticleTrackView&               particle,
+                            const Real3&            inc_direction,
+                            SecondaryAllocatorView& allocate);
+
     // Sample an interaction with the given RNG
     template<class Engine>
     inline CELER_FUNCTION Interaction operator()(Engine& rng);
@@ -78,21 +92,22 @@ class PhotoelectricInteractor
     const PhotoelectricInteractorPointers& shared_;
     // Livermore EPICS2014 photoelectric cross section data
     const LivermoreElement& el_;
-    // Index in MaterialParams/LivermoreParams elements
-    ElementDefId el_id_;
     // Incident direction
     const Real3& inc_direction_;
     // Incident gamma energy
     const MevEnergy inc_energy_;
     // Allocate space for one or more secondary particles
     SecondaryAllocatorView& allocate_;
-    // Microscopic cross section calculator
-    PhotoelectricMicroXsCalculator calc_micro_xs_;
+    // Total microscopic cross section of the element
+    real_type micro_xs_;
     // Reciprocal of the energy
     real_type inv_energy_;
 
     //// HELPER FUNCTIONS ////
 
+    // Sample the subshell from which the photoelectron is emitted
+    inline CELER_FUNCTION unsigned int sample_shell(real_type cutoff) const;
+
     // Sample the direction of the emitted photoelectron
     template<class Engine>
     inline CELER_FUNCTION Real3 sample_direction(Engine& rng) const;
@@ -6,9 +6,9 @@
 //! \file PhotoelectricInteractor.i.hh
 //---------------------------------------------------------------------------//
 
+#include "base/Algorithms.hh"
 #include "base/ArrayUtils.hh"
 #include "random/distributions/UniformRealDistribution.hh"
-#include "MockXsCalculator.hh"
 
 namespace celeritas
 {
@@ -23,17 +23,44 @@ CELER_FUNCTION PhotoelectricInteractor::PhotoelectricInteractor(
     const ParticleTrackView&               particle,
     const Real3&                           inc_direction,
     SecondaryAllocatorView&                allocate)
+    : PhotoelectricInteractor(
+        shared,
+        data,
+        el_id,
+        PhotoelectricMicroXsCalculator(shared, data, particle)(el_id),
+        particle,
+        inc_direction,
+        allocate)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the element's precalculated micro cross section.
+ *
+ * The cross section must be the one calculated by
+ * \c PhotoelectricMicroXsCalculator for this element and incident energy,
+ * e.g. the value stored by \c ElementSelector::elemental_micro_xs .
+ */
+CELER_FUNCTION PhotoelectricInteractor::PhotoelectricInteractor(
+    const PhotoelectricInteractorPointers& shared,
+    const LivermoreParamsPointers&         data,
+    ElementDefId                           el_id,
+    real_type                              micro_xs,
+    const ParticleTrackView&               particle,
+    const Real3&                           inc_direction,
+    SecondaryAllocatorView&                allocate)
     : shared_(shared)
     , el_(data.elements[el_id.get()])
-    , el_id_(el_id)
     , inc_direction_(inc_direction)
     , inc_energy_(particle.energy().value())
     , allocate_(allocate)
-    , calc_micro_xs_(shared, data, particle)
+    , micro_xs_(micro_xs)
 {
     REQUIRE(inc_energy_ > this->min_incident_energy()
             && inc_energy_ <= this->max_incident_energy());
     REQUIRE(particle.def_id() == shared_.gamma_id);
+    REQUIRE(micro_xs_ >= 0);
 
     inv_energy_ = 1. / inc_energy_.value();
 }
@@ -46,51 +73,16 @@ template<class Engine>
 CELER_FUNCTION Interaction PhotoelectricInteractor::operator()(Engine& rng)
 {
     // Allocate space for the single electron to be emitted
-    Secondary* photoelectron = this->allocate_(1);
-    if (photoelectron == nullptr)
+    SecondaryRecord* photoelectron_record = this->allocate_(1);
+    if (photoelectron_record == nullptr)
     {
         // Failed to allocate space for a secondary
         return Interaction::from_failure();
     }
 
     // Sample the shell from which the photoelectron is emitted
-    real_type    cutoff = generate_canonical(rng) * calc_micro_xs_(el_id_);
-    real_type    xs     = 0.;
-    unsigned int shell_id;
-    for (shell_id = 0; shell_id < el_.shells.size() - 1; ++shell_id)
-    {
-        const auto& shell = el_.shells[shell_id];
-        if (inc_energy_ > shell.binding_energy)
-        {
-            if (inc_energy_ < el_.thresh_low)
-            {
-                // Use the tabulated subshell cross sections
-                XsCalculator calc_xs(shell.xs);
-                xs += ipow<3>(inv_energy_) * calc_xs(inc_energy_.value());
-            }
-            else
-            {
-                // Use parameterized integrated subshell cross sections
-                const auto& param = inc_energy_ >= el_.thresh_high
-                                        ? shell.param_high
-                                        : shell.param_low;
-
-                // Calculate the subshell cross section from the fit parameters
-                // and energy as \sigma(E) = a_1 / E + a_2 / E^2 + a_3 / E^3 +
-                // a_4 / E^4 + a_5 / E^5 + a_6 / E^6.
-                // clang-format off
-                xs = inv_energy_ * (param[0] + inv_energy_ * (param[1]
-                   + inv_energy_ * (param[2] + inv_energy_ * (param[3]
-                   + inv_energy_ * (param[4] + inv_energy_ * param[5])))));
-                // clang-format on
-            }
-
-            if (xs >= cutoff)
-            {
-                break;
-            }
-        }
-    }
+    unsigned int shell_id
+        = this->sample_shell(generate_canonical(rng) * micro_xs_);
 
     // Construct interaction for change to primary (incident) particle
     Interaction result = Interaction::from_absorption();
@@ -106,17 +98,19 @@ CELER_FUNCTION Interaction PhotoelectricInteractor::operator()(Engine& rng)
     }
 
     // Outgoing secondary is an electron
-    result.secondaries    = {photoelectron, 1};
-    photoelectron->def_id = shared_.electron_id;
+    Secondary photoelectron;
+    result.secondaries   = {photoelectron_record, 1};
+    photoelectron.def_id = shared_.electron_id;
 
     // Electron kinetic energy is the difference between the incident photon
     // energy and the binding energy of the shell
-    photoelectron->energy
+    photoelectron.energy
         = MevEnergy{inc_energy_.value() - binding_energy.value()};
 
     // Direction of the emitted photoelectron is sampled from the
     // Sauter-Gavrila distribution
-    photoelectron->direction = this->sample_direction(rng);
+    photoelectron.direction = this->sample_direction(rng);
+    *photoelectron_record   = SecondaryRecord(photoelectron);
 
     // TODO: Atomic relaxation. For now assume the energy is deposited locally
     result.energy_deposition = binding_energy;
@@ -124,6 +118,91 @@ CELER_FUNCTION Interaction PhotoelectricInteractor::operator()(Engine& rng)
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the subshell from which the photoelectron is emitted.
+ *
+ * The first subshell whose cumulative cross section reaches the given cutoff
+ * is selected. Whether the tabulated or parameterized cross sections are used
+ * depends only on the incident energy, so that choice is made once outside
+ * the loop over subshells. The tabulated cross sections of all subshells are
+ * stored on a shared energy grid, so only one bin search is needed, and are
+ * already accumulated over subshells when the element data is built.
+ */
+CELER_FUNCTION unsigned int
+PhotoelectricInteractor::sample_shell(real_type cutoff) const
+{
+    const unsigned int last_shell = el_.shells.size() - 1;
+    unsigned int       shell_id   = 0;
+
+    if (inc_energy_ < el_.thresh_low)
+    {
+        // Use the tabulated cumulative subshell cross sections, which share a
+        // single energy grid: find the grid bin once for all subshells. An
+        // energy on an absorption edge falls in the bin below it, since the
+        // subshell opens only above its binding energy.
+        const auto&     grid   = el_.shell_energy;
+        const real_type energy = inc_energy_.value();
+        size_type       bin    = 0;
+        real_type       frac   = 0;
+        if (energy > grid.front())
+        {
+            bin = celeritas::lower_bound(grid.begin(), grid.end(), energy)
+                  - grid.begin() - 1;
+            frac = (energy - grid[bin]) / (grid[bin + 1] - grid[bin]);
+        }
+
+        // Interpolate the cumulative cross section up to each subshell
+        const size_type  num_shells    = el_.shells.size();
+        const real_type* cum_xs_lo     = el_.shell_cum_xs.data()
+                                         + bin * num_shells;
+        const real_type* cum_xs_hi     = cum_xs_lo + num_shells;
+        const real_type  inv_energy_cb = ipow<3>(inv_energy_);
+        for (; shell_id < last_shell; ++shell_id)
+        {
+            if (inc_energy_ > el_.shells[shell_id].binding_energy)
+            {
+                const real_type cum_xs
+                    = cum_xs_lo[shell_id]
+                      + frac * (cum_xs_hi[shell_id] - cum_xs_lo[shell_id]);
+                if (inv_energy_cb * cum_xs >= cutoff)
+                {
+                    break;
+                }
+            }
+        }
+    }
+    else
+    {
+        // Use parameterized integrated subshell cross sections
+        const bool use_high = inc_energy_ >= el_.thresh_high;
+        for (; shell_id < last_shell; ++shell_id)
+        {
+            const auto& shell = el_.shells[shell_id];
+            if (inc_energy_ > shell.binding_energy)
+            {
+                const auto& param = use_high ? shell.param_high
+                                             : shell.param_low;
+
+                // Calculate the subshell cross section from the fit parameters
+                // and energy as \sigma(E) = a_1 / E + a_2 / E^2 + a_3 / E^3 +
+                // a_4 / E^4 + a_5 / E^5 + a_6 / E^6.
+                // clang-format off
+                real_type xs
+                   = inv_energy_ * (param[0] + inv_energy_ * (param[1]
+                   + inv_energy_ * (param[2] + inv_energy_ * (param[3]
+                   + inv_energy_ * (param[4] + inv_energy_ * param[5])))));
+                // clang-format on
+                if (xs >= cutoff)
+                {
+                    break;
+                }
+            }
+        }
+    }
+    return shell_id;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Sample a direction according to the Sauter-Gavrila distribution.
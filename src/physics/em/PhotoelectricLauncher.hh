@@ -0,0 +1,64 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file PhotoelectricLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "physics/base/Interaction.hh"
+#include "physics/material/ElementSelector.hh"
+#include "physics/material/MaterialView.hh"
+#include "LivermoreParamsPointers.hh"
+#include "PhotoelectricInteractor.hh"
+#include "PhotoelectricInteractorPointers.hh"
+#include "PhotoelectricMicroXsCalculator.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the Livermore photoelectric interactor from a ModelDispatcher.
+ *
+ * The target element is sampled from the track's material weighted by the
+ * photoelectric micro cross sections, and the selected element's cross
+ * section is reused as the shell sampling normalization.
+ */
+struct PhotoelectricLauncher
+{
+    ModelId                         model;
+    PhotoelectricInteractorPointers shared;
+    LivermoreParamsPointers         data;
+
+    //! ID of the model
+    CELER_FUNCTION ModelId model_id() const { return model; }
+
+    //! Sample an interaction for the given track
+    template<class Track, class Engine>
+    CELER_FUNCTION Interaction operator()(Track& track, Engine& rng) const
+    {
+        auto         material = track.material();
+        MaterialView mat      = material.material_view();
+
+        PhotoelectricMicroXsCalculator calc_micro_xs(
+            shared, data, track.particle);
+        ElementSelector select_el(
+            mat, calc_micro_xs, material.element_scratch());
+        ElementComponentId comp_id = select_el(rng);
+
+        PhotoelectricInteractor interact(
+            shared,
+            data,
+            mat.elements()[comp_id.get()].element,
+            select_el.elemental_micro_xs()[comp_id.get()],
+            track.particle,
+            track.direction,
+            track.allocate);
+        return interact(rng);
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
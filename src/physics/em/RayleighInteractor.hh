@@ -11,22 +11,29 @@
 #include "base/Types.hh"
 #include "physics/base/Interaction.hh"
 #include "physics/base/ParticleTrackView.hh"
-#include "physics/base/SecondaryAllocatorView.hh"
-#include "physics/base/Secondary.hh"
 #include "physics/base/Units.hh"
+#include "physics/material/Types.hh"
 #include "RayleighInteractorPointers.hh"
+#include "RayleighParamsPointers.hh"
 
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Brief class description.
+ * Coherent (Rayleigh) scattering of a photon off an atom.
  *
- * This is a model for XXXX process. Additional description
+ * The photon changes direction without losing energy. The polar angle is
+ * sampled from the form-factor-weighted Thomson distribution tabulated by
+ * \c RayleighParams : one of the two bracketing energy grid points is chosen
+ * with probability given by the fractional position in \f$ \ln E \f$, the
+ * cumulative distribution of that row is inverted with a binary search, and
+ * \f$ 1 - \cos\theta \f$ is interpolated linearly within the bin. Sampling
+ * therefore takes a fixed number of random numbers and never rejects.
  *
- * \note This performs the same sampling routine as in Geant4's
- * XXXX class, as documented in section XXX of the Geant4 Physics
- * Reference (release 10.6).
+ * \note This fills the role of Geant4's G4LivermoreRayleighModel, but uses
+ * the Molière form factor rather than the EPDL97 form factor fits, and
+ * inverts tabulated distributions rather than sampling the fit with
+ * rejection.
  */
 class RayleighInteractor
 {
@@ -34,9 +41,10 @@ class RayleighInteractor
     // Construct with shared and state data
     inline CELER_FUNCTION
     RayleighInteractor(const RayleighInteractorPointers& shared,
+                       const RayleighParamsPointers&     data,
+                       ElementDefId                      el_id,
                        const ParticleTrackView&          particle,
-                       const Real3&                      inc_direction,
-                       SecondaryAllocatorView&           allocate);
+                       const Real3&                      inc_direction);
 
     // Sample an interaction with the given RNG
     template<class Engine>
@@ -47,24 +55,33 @@ class RayleighInteractor
     //! Minimum incident energy for this model to be valid
     static CELER_CONSTEXPR_FUNCTION units::MevEnergy min_incident_energy()
     {
-        return units::MevEnergy{0}; // XXX
+        return units::MevEnergy{1e-5};
     }
 
     //! Maximum incident energy for this model to be valid
     static CELER_CONSTEXPR_FUNCTION units::MevEnergy max_incident_energy()
     {
-        return units::MevEnergy{0}; // XXX
+        return units::MevEnergy{1e8};
     }
 
   private:
-    // Shared constant physics properties
-    const RayleighInteractorPointers& shared_;
+    // Tabulated Rayleigh data
+    const RayleighParamsPointers& data_;
+    // Element being scattered off
+    const ElementDefId el_id_;
     // Incident gamma energy
     const units::MevEnergy inc_energy_;
     // Incident direction
     const Real3& inc_direction_;
-    // Allocate space for one or more secondary particles
-    SecondaryAllocatorView& allocate_;
+
+    // HELPER FUNCTIONS
+
+    template<class Engine>
+    inline CELER_FUNCTION size_type sample_energy_idx(Engine& rng) const;
+
+    template<class Engine>
+    inline CELER_FUNCTION real_type sample_one_minus_mu(size_type row,
+                                                        Engine&   rng) const;
 };
 
 //---------------------------------------------------------------------------//
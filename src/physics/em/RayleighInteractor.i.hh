@@ -6,6 +6,16 @@
 //! \file RayleighInteractor.i.hh
 //---------------------------------------------------------------------------//
 
+#include <cmath>
+#include "base/Algorithms.hh"
+#include "base/ArrayUtils.hh"
+#include "base/Assert.hh"
+#include "base/Constants.hh"
+#include "base/UniformGrid.hh"
+#include "random/distributions/BernoulliDistribution.hh"
+#include "random/distributions/GenerateCanonical.hh"
+#include "random/distributions/UniformRealDistribution.hh"
+
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
@@ -14,50 +24,102 @@ namespace celeritas
  */
 CELER_FUNCTION
 RayleighInteractor::RayleighInteractor(const RayleighInteractorPointers& shared,
+                                       const RayleighParamsPointers&     data,
+                                       ElementDefId                      el_id,
                                        const ParticleTrackView& particle,
-                                       const Real3&             inc_direction,
-                                       SecondaryAllocatorView&  allocate)
-    : shared_(shared)
+                                       const Real3&             inc_direction)
+    : data_(data)
+    , el_id_(el_id)
     , inc_energy_(particle.energy().value())
     , inc_direction_(inc_direction)
-    , allocate_(allocate)
 {
+    REQUIRE(data_);
+    REQUIRE(el_id_ < data_.num_elements());
     REQUIRE(inc_energy_ >= this->min_incident_energy()
             && inc_energy_ <= this->max_incident_energy());
-    REQUIRE(particle.def_id() == shared_.gamma_id); // XXX
+    REQUIRE(particle.def_id() == shared.gamma_id);
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Sample using the XXX model.
+ * Sample the scattering angle from the tabulated distribution.
  */
 template<class Engine>
 CELER_FUNCTION Interaction RayleighInteractor::operator()(Engine& rng)
 {
-    // Allocate space for XXX (electron, multiple particles, ...)
-    Secondary* secondaries = this->allocate_(0); // XXX
-    if (secondaries == nullptr)
-    {
-        // Failed to allocate space for a secondary
-        return Interaction::from_failure();
-    }
+    const size_type row = data_.row(el_id_, this->sample_energy_idx(rng));
+    const real_type one_minus_costheta = this->sample_one_minus_mu(row, rng);
 
-    // XXX sample
-    (void)sizeof(rng);
+    // Sample azimuthal direction and rotate the outgoing direction
+    UniformRealDistribution<real_type> sample_phi(0, 2 * constants::pi);
 
     // Construct interaction for change to primary (incident) particle
     Interaction result;
-    result.action      = Action::scattered;                     // XXX
-    result.energy      = units::MevEnergy{inc_energy_.value()}; // XXX
-    result.direction   = inc_direction_;
-    result.secondaries = {secondaries, 1}; // XXX
+    result.action    = Action::scattered;
+    result.energy    = inc_energy_;
+    result.direction = rotate(
+        from_spherical(1 - one_minus_costheta, sample_phi(rng)),
+        inc_direction_);
+    return result;
+}
 
-    // Save outgoing secondary data
-    secondaries[0].def_id    = shared_.electron_id; // XXX
-    secondaries[0].energy    = units::MevEnergy{0}; // XXX
-    secondaries[0].direction = {0, 0, 0};           // XXX
+//---------------------------------------------------------------------------//
+// PRIVATE HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Choose one of the energy grid points bracketing the incident energy.
+ *
+ * The upper point is chosen with probability equal to the fractional position
+ * in \f$ \ln E \f$, so that the sampled distribution is interpolated between
+ * the tabulated ones. Outside the grid the nearest point is used.
+ */
+template<class Engine>
+CELER_FUNCTION size_type
+RayleighInteractor::sample_energy_idx(Engine& rng) const
+{
+    const UniformGrid loge_grid(data_.log_energy);
+    const real_type   loge = std::log(inc_energy_.value());
+    if (loge <= loge_grid.front())
+    {
+        return 0;
+    }
+    if (loge >= loge_grid.back())
+    {
+        return loge_grid.size() - 1;
+    }
+    const size_type idx  = loge_grid.find(loge);
+    const real_type frac = (loge - loge_grid[idx]) / data_.log_energy.delta;
+    return BernoulliDistribution(frac)(rng) ? idx + 1 : idx;
+}
 
-    return result;
+//---------------------------------------------------------------------------//
+/*!
+ * Invert the cumulative angular distribution of a table row.
+ *
+ * The distribution is uniform within each bin of the angular grid.
+ */
+template<class Engine>
+CELER_FUNCTION real_type
+RayleighInteractor::sample_one_minus_mu(size_type row, Engine& rng) const
+{
+    const size_type  num_angles = data_.num_angles;
+    const real_type* cdf        = data_.cdf.data() + row * num_angles;
+    const real_type  xi         = generate_canonical(rng);
+
+    // Find the bin [j, j + 1] with cdf[j] <= xi < cdf[j + 1]
+    const size_type j = celeritas::upper_bound(cdf + 1, cdf + num_angles, xi)
+                        - cdf - 1;
+    CHECK(j + 1 < num_angles);
+
+    // Bin edges: zero, then logarithmic from x_min to 2
+    const real_type log_x_min = data_.log_x_min[row];
+    const real_type delta = (std::log(real_type(2)) - log_x_min)
+                            / (num_angles - 2);
+    const real_type lo = j == 0 ? 0 : std::exp(log_x_min + (j - 1) * delta);
+    const real_type hi = std::exp(log_x_min + j * delta);
+
+    const real_type frac = (xi - cdf[j]) / (cdf[j + 1] - cdf[j]);
+    return min(lo + frac * (hi - lo), real_type(2));
 }
 
 //---------------------------------------------------------------------------//
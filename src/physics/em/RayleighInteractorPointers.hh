@@ -14,20 +14,17 @@ namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Device data for creating an interactor.
+ * Device data for creating a RayleighInteractor.
  */
 struct RayleighInteractorPointers
 {
-    //! ID of an electron
-    ParticleDefId electron_id;
     //! ID of a gamma
     ParticleDefId gamma_id;
-    // XXX additional data
 
     //! Check whether the data is assigned
-    explicit inline CELER_FUNCTION operator bool() const
+    explicit CELER_FUNCTION operator bool() const
     {
-        return electron_id && gamma_id; // XXX
+        return static_cast<bool>(gamma_id);
     }
 };
 
@@ -0,0 +1,53 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RayleighMicroXsCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "physics/base/Units.hh"
+#include "physics/material/Types.hh"
+#include "RayleighInteractorPointers.hh"
+#include "RayleighParamsPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate Rayleigh scattering cross sections from the tabulated data.
+ *
+ * The cross section is interpolated linearly in \f$ \ln \sigma \f$ versus
+ * \f$ \ln E \f$, which is exact in both the low-energy (constant) and
+ * high-energy (\f$ \sigma \propto E^{-2} \f$) limits. Outside the energy
+ * grid the cross section is extrapolated the same way.
+ */
+class RayleighMicroXsCalculator
+{
+  public:
+    // Construct with shared and state data
+    inline CELER_FUNCTION
+    RayleighMicroXsCalculator(const RayleighInteractorPointers& shared,
+                              const RayleighParamsPointers&     data,
+                              const ParticleTrackView&          particle);
+
+    // Compute cross section [cm^2]
+    inline CELER_FUNCTION real_type operator()(ElementDefId el_id) const;
+
+  private:
+    // Tabulated Rayleigh data
+    const RayleighParamsPointers& data_;
+    // Lower energy grid point
+    size_type energy_idx_;
+    // Fractional position in ln(E) between the grid points
+    real_type frac_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "RayleighMicroXsCalculator.i.hh"
@@ -0,0 +1,58 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RayleighMicroXsCalculator.i.hh
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include "base/Assert.hh"
+#include "base/UniformGrid.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with shared and state data.
+ */
+CELER_FUNCTION RayleighMicroXsCalculator::RayleighMicroXsCalculator(
+    const RayleighInteractorPointers& shared,
+    const RayleighParamsPointers&     data,
+    const ParticleTrackView&          particle)
+    : data_(data)
+{
+    REQUIRE(data_);
+    REQUIRE(particle.def_id() == shared.gamma_id);
+    REQUIRE(particle.energy().value() > 0);
+
+    const UniformGrid loge_grid(data_.log_energy);
+    const real_type   loge = std::log(particle.energy().value());
+    if (loge <= loge_grid.front())
+    {
+        energy_idx_ = 0;
+    }
+    else if (loge >= loge_grid.back())
+    {
+        energy_idx_ = loge_grid.size() - 2;
+    }
+    else
+    {
+        energy_idx_ = loge_grid.find(loge);
+    }
+    frac_ = (loge - loge_grid[energy_idx_]) / data_.log_energy.delta;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compute cross section [cm^2].
+ */
+CELER_FUNCTION
+real_type RayleighMicroXsCalculator::operator()(ElementDefId el_id) const
+{
+    const real_type* xs = data_.xs.data() + data_.row(el_id, energy_idx_);
+    return xs[0] * std::pow(xs[1] / xs[0], frac_);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,223 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RayleighParams.cc
+//---------------------------------------------------------------------------//
+#include "RayleighParams.hh"
+
+#include <algorithm>
+#include <cmath>
+#include "base/Constants.hh"
+#include "base/Range.hh"
+#include "comm/Device.hh"
+#include "physics/base/Units.hh"
+#include "physics/material/ElementView.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// Molière screening function coefficients
+constexpr real_type moliere_alpha[] = {0.10, 0.55, 0.35};
+constexpr real_type moliere_beta[]  = {6.0, 1.2, 0.3};
+
+using ScreeningArray = Array<real_type, RayleighParams::num_terms>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Unnormalized angular distribution in x = 1 - mu, divided by Z^2.
+ *
+ * The argument \c c holds \f$ 2 E^2 a_i \f$ for each screening term.
+ */
+real_type calc_angular_pdf(const ScreeningArray& c, real_type x)
+{
+    real_type form_factor = 0;
+    for (auto i : range(RayleighParams::num_terms))
+    {
+        form_factor += moliere_alpha[i] / (1 + c[i] * x);
+    }
+    const real_type mu = 1 - x;
+    return (1 + mu * mu) * form_factor * form_factor;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Integrate the angular distribution over [lo, hi] with Simpson's rule.
+ */
+real_type
+integrate_angular_pdf(const ScreeningArray& c, real_type lo, real_type hi)
+{
+    constexpr size_type num_intervals = 8;
+    const real_type     h = (hi - lo) / num_intervals;
+
+    real_type result = calc_angular_pdf(c, lo) + calc_angular_pdf(c, hi);
+    for (auto i : range<size_type>(1, num_intervals))
+    {
+        result += (i % 2 == 1 ? 4 : 2) * calc_angular_pdf(c, lo + i * h);
+    }
+    return result * h / 3;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+constexpr size_type RayleighParams::num_terms;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from the elements in the problem.
+ *
+ * Each bin of the cumulative distribution is integrated with a composite
+ * Simpson's rule.
+ * The first nonzero angle of each row is chosen so that the form factor is
+ * nearly constant in the first bin.
+ */
+RayleighParams::RayleighParams(const MaterialParams& materials,
+                               const Input&          inp)
+    : log_energy_(inp.log_energy), num_angles_(inp.num_angles)
+{
+    REQUIRE(inp.log_energy);
+    REQUIRE(inp.num_angles > 2);
+    REQUIRE(materials.num_elements() > 0);
+
+    const MaterialParamsPointers mat_ptrs     = materials.host_pointers();
+    const size_type              num_elements = materials.num_elements();
+    const size_type              num_rows = num_elements * log_energy_.size;
+
+    // Squared screening lengths in units of the photon wavelength
+    const real_type hbar_c = constants::hbar_planck * constants::c_light
+                             / units::Mev::value();
+    host_screening_.resize(num_elements * num_terms);
+    for (auto el : range<ElementDefId::value_type>(num_elements))
+    {
+        ElementView     element(mat_ptrs, ElementDefId{el});
+        const real_type b = 0.88534 * constants::a0_bohr / element.cbrt_z();
+        for (auto i : range(num_terms))
+        {
+            const real_type length = b / (hbar_c * moliere_beta[i]);
+            host_screening_[el * num_terms + i] = length * length;
+        }
+    }
+
+    const real_type   xs_prefactor = constants::pi * constants::re_electron
+                                   * constants::re_electron;
+    const UniformGrid loge_grid(log_energy_);
+    host_xs_.resize(num_rows);
+    host_log_x_min_.resize(num_rows);
+    host_cdf_.resize(num_rows * num_angles_);
+    for (auto el : range<ElementDefId::value_type>(num_elements))
+    {
+        ElementView     element(mat_ptrs, ElementDefId{el});
+        const real_type z = element.atomic_number();
+        for (auto e : range(loge_grid.size()))
+        {
+            const real_type energy = std::exp(loge_grid[e]);
+            ScreeningArray c;
+            for (auto i : range(num_terms))
+            {
+                c[i] = 2 * energy * energy
+                       * host_screening_[el * num_terms + i];
+            }
+            const real_type c_max = *std::max_element(c.begin(), c.end());
+
+            // Angular grid: zero, then logarithmic from x_min to 2
+            const real_type log_x_min
+                = std::log(std::min(real_type(1e-4), real_type(2e-3) / c_max));
+            const real_type delta = (std::log(2.0) - log_x_min)
+                                    / (num_angles_ - 2);
+            auto calc_x = [&](size_type j) -> real_type {
+                return j == 0 ? 0 : std::exp(log_x_min + (j - 1) * delta);
+            };
+
+            const size_type row = el * loge_grid.size() + e;
+            real_type*      cdf = host_cdf_.data() + row * num_angles_;
+            cdf[0]              = 0;
+            for (auto j : range<size_type>(1, num_angles_))
+            {
+                cdf[j] = cdf[j - 1]
+                         + integrate_angular_pdf(c, calc_x(j - 1), calc_x(j));
+            }
+            const real_type total = cdf[num_angles_ - 1];
+            CHECK(total > 0);
+            for (auto j : range(num_angles_))
+            {
+                cdf[j] /= total;
+            }
+            // Eliminate roundoff so the last bin is always selectable
+            cdf[num_angles_ - 1] = 1;
+
+            host_xs_[row]        = xs_prefactor * z * z * total;
+            host_log_x_min_[row] = log_x_min;
+        }
+    }
+
+    if (celeritas::is_device_enabled())
+    {
+        device_xs_ = DeviceVector<real_type>(host_xs_.size());
+        device_xs_.copy_to_device(make_span(host_xs_));
+        device_log_x_min_ = DeviceVector<real_type>(host_log_x_min_.size());
+        device_log_x_min_.copy_to_device(make_span(host_log_x_min_));
+        device_cdf_ = DeviceVector<real_type>(host_cdf_.size());
+        device_cdf_.copy_to_device(make_span(host_cdf_));
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Squared screening lengths of an element [1/MeV^2].
+ *
+ * These are \f$ a_i = (b / \hbar c \beta_i)^2 \f$, so that each term of the
+ * form factor is \f$ \alpha_i / (1 + 2 E^2 a_i (1 - \mu)) \f$.
+ */
+auto RayleighParams::screening(ElementDefId el) const
+    -> Array<real_type, num_terms>
+{
+    REQUIRE(el.get() * num_terms < host_screening_.size());
+    Array<real_type, num_terms> result;
+    std::copy_n(host_screening_.begin() + el.get() * num_terms,
+                num_terms,
+                result.begin());
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access tables on the host.
+ */
+RayleighParamsPointers RayleighParams::host_pointers() const
+{
+    RayleighParamsPointers result;
+    result.log_energy = log_energy_;
+    result.num_angles = num_angles_;
+    result.xs         = make_span(host_xs_);
+    result.log_x_min  = make_span(host_log_x_min_);
+    result.cdf        = make_span(host_cdf_);
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access tables on the device.
+ */
+RayleighParamsPointers RayleighParams::device_pointers() const
+{
+    REQUIRE(!device_xs_.empty());
+    RayleighParamsPointers result;
+    result.log_energy = log_energy_;
+    result.num_angles = num_angles_;
+    result.xs         = device_xs_.device_pointers();
+    result.log_x_min  = device_log_x_min_.device_pointers();
+    result.cdf        = device_cdf_.device_pointers();
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,82 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RayleighParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+#include "base/Array.hh"
+#include "base/DeviceVector.hh"
+#include "base/Types.hh"
+#include "base/UniformGrid.hh"
+#include "physics/material/MaterialParams.hh"
+#include "RayleighParamsPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Cross sections and angular distribution tables for Rayleigh scattering.
+ *
+ * The differential cross section for coherent scattering off an atom is
+ * \f[
+   \frac{d\sigma}{d\mu} = \pi r_e^2 (1 + \mu^2) F(q)^2 ,
+ * \f]
+ * where \f$ F \f$ is the atomic form factor at momentum transfer
+ * \f$ q^2 = 2 k^2 (1 - \mu) \f$, \f$ k = E / \hbar c \f$. The form factor
+ * of each element is the Molière parameterization of the Thomas–Fermi
+ * screening function:
+ * \f[
+   F(q) = Z \sum_{i=1}^3 \frac{\alpha_i}{1 + (q b / \beta_i)^2} ,
+   \quad b = 0.88534\, a_0 Z^{-1/3} .
+ * \f]
+ *
+ * At setup the cross sections and the cumulative distributions in
+ * \f$ x = 1 - \mu \f$ are integrated numerically for every element and
+ * energy grid point, so that the interactor can sample the scattering angle
+ * by a table lookup without rejection.
+ */
+class RayleighParams
+{
+  public:
+    //! Number of screening terms in the form factor
+    static constexpr size_type num_terms = 3;
+
+    //! Input data to construct this class
+    struct Input
+    {
+        UniformGrid::Params log_energy; //!< Energy grid [ln MeV]
+        size_type           num_angles = 128; //!< Angular grid points
+    };
+
+  public:
+    // Construct from the elements in the problem
+    RayleighParams(const MaterialParams& materials, const Input& inp);
+
+    // Squared screening lengths of an element [1/MeV^2]
+    Array<real_type, num_terms> screening(ElementDefId el) const;
+
+    // Access tables on the host
+    RayleighParamsPointers host_pointers() const;
+
+    // Access tables on the device
+    RayleighParamsPointers device_pointers() const;
+
+  private:
+    UniformGrid::Params    log_energy_;
+    size_type              num_angles_;
+    std::vector<real_type> host_screening_;
+    std::vector<real_type> host_xs_;
+    std::vector<real_type> host_log_x_min_;
+    std::vector<real_type> host_cdf_;
+
+    DeviceVector<real_type> device_xs_;
+    DeviceVector<real_type> device_log_x_min_;
+    DeviceVector<real_type> device_cdf_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,74 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RayleighParamsPointers.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Assert.hh"
+#include "base/Macros.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "base/UniformGrid.hh"
+#include "physics/material/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulated Rayleigh cross sections and angular distributions, all elements.
+ *
+ * Tables are stored at every point of a uniform grid in
+ * \f$ \ln(E / \mathrm{MeV}) \f$. For each element and grid point ("row") the
+ * data are:
+ * - the microscopic cross section [cm^2], indexed as [element][energy];
+ * - the logarithm of the smallest nonzero \f$ x = 1 - \cos\theta \f$ of the
+ *   angular grid, indexed as [element][energy]; and
+ * - the cumulative angular distribution on the angular grid, indexed as
+ *   [element][energy][angle].
+ *
+ * The angular grid of a row has \c num_angles points: \f$ x_0 = 0 \f$, then
+ * \f$ x_1 = x_\mathrm{min} \f$ through \f$ x_{n-1} = 2 \f$ spaced uniformly
+ * in \f$ \ln x \f$. Since the form factor cuts off the distribution at
+ * \f$ x \sim (\hbar c / E b)^2 \f$, the logarithmic spacing resolves the
+ * forward peak at all energies with a fixed number of points.
+ *
+ * \sa RayleighParams (owns the pointed-to data)
+ * \sa RayleighInteractor (samples the angular distribution)
+ */
+struct RayleighParamsPointers
+{
+    UniformGrid::Params   log_energy; //!< Energy grid [ln MeV]
+    size_type             num_angles = 0;
+    Span<const real_type> xs;        //!< Cross section [cm^2]
+    Span<const real_type> log_x_min; //!< First nonzero angle [ln(1-mu)]
+    Span<const real_type> cdf;       //!< Cumulative angular distribution
+
+    //! Check whether the interface is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return log_energy && num_angles > 2 && !xs.empty()
+               && xs.size() % log_energy.size == 0
+               && log_x_min.size() == xs.size()
+               && cdf.size() == xs.size() * num_angles;
+    }
+
+    //! Number of elements
+    CELER_FUNCTION size_type num_elements() const
+    {
+        return xs.size() / log_energy.size;
+    }
+
+    //! Index of the table row of an element at an energy grid point
+    CELER_FUNCTION size_type row(ElementDefId el, size_type energy_idx) const
+    {
+        REQUIRE(el < this->num_elements());
+        REQUIRE(energy_idx < log_energy.size);
+        return el.get() * log_energy.size + energy_idx;
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
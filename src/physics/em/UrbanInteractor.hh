@@ -11,31 +11,54 @@
 #include "base/Types.hh"
 #include "physics/base/Interaction.hh"
 #include "physics/base/ParticleTrackView.hh"
-#include "physics/base/SecondaryAllocatorView.hh"
-#include "physics/base/Secondary.hh"
 #include "physics/base/Units.hh"
+#include "physics/material/MaterialTrackView.hh"
 #include "UrbanInteractorPointers.hh"
+#include "UrbanParamsPointers.hh"
 
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Brief class description.
+ * Urban multiple scattering of an electron or positron along a step.
  *
- * This is a model for XXXX process. Additional description
+ * The cosine of the net deflection over a true path length \f$ t \f$ is
+ * sampled from a model function whose mean is exactly
+ * \f$ \exp(-t / \lambda_1) \f$ and whose width follows a modified Highland
+ * formula. The central part is exponential in \f$ 1 - \cos\theta \f$, the
+ * tail is a power law, and an isotropic component fixes the mean.
+ *
+ * All material and energy dependent coefficients, and the transport mean
+ * free path \f$ \lambda_1 \f$, come from the \c UrbanParams tables, so
+ * sampling takes a few table lookups, elementary functions and random
+ * numbers. When the energy drops along the step, \f$ \lambda_1 \f$ is
+ * assumed to vary linearly with the path length.
+ *
+ * The incident energy is at the start of the step and the end energy is
+ * after continuous losses, which are applied separately: the exiting energy
+ * in the interaction is unchanged. The lateral displacement is not sampled.
  *
  * \note This performs the same sampling routine as in Geant4's
- * XXXX class, as documented in section XXX of the Geant4 Physics
- * Reference (release 10.6).
+ * G4UrbanMscModel class (SampleCosineTheta and ComputeTheta0), as documented
+ * in the Urban model section of the Geant4 Physics Reference (release 10.6).
  */
 class UrbanInteractor
 {
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
   public:
     // Construct with shared and state data
     inline CELER_FUNCTION UrbanInteractor(const UrbanInteractorPointers& shared,
+                                          const UrbanParamsPointers&     data,
+                                          const MaterialTrackView& material,
                                           const ParticleTrackView& particle,
-                                          const Real3& inc_direction,
-                                          SecondaryAllocatorView& allocate);
+                                          real_type                true_path,
+                                          MevEnergy                end_energy,
+                                          const Real3& inc_direction);
 
     // Sample an interaction with the given RNG
     template<class Engine>
@@ -44,26 +67,48 @@ class UrbanInteractor
     //// COMMON PROPERTIES ////
 
     //! Minimum incident energy for this model to be valid
-    static CELER_CONSTEXPR_FUNCTION units::MevEnergy min_incident_energy()
+    static CELER_CONSTEXPR_FUNCTION MevEnergy min_incident_energy()
     {
-        return units::MevEnergy{0}; // XXX
+        return MevEnergy{1e-3};
     }
 
     //! Maximum incident energy for this model to be valid
-    static CELER_CONSTEXPR_FUNCTION units::MevEnergy max_incident_energy()
+    static CELER_CONSTEXPR_FUNCTION MevEnergy max_incident_energy()
     {
-        return units::MevEnergy{0}; // XXX
+        return MevEnergy{1e2};
     }
 
   private:
-    // Shared constant physics properties
-    const UrbanInteractorPointers& shared_;
-    // Incident gamma energy
-    const units::MevEnergy inc_energy_;
+    // Coefficients of the track's material
+    const UrbanMscMaterial& msc_;
+    // Incident kinetic energy
+    const MevEnergy inc_energy_;
+    // Kinetic energy at the end of the step
+    const MevEnergy end_energy_;
+    // Incident mass [MeV/c^2]
+    const real_type inc_mass_;
+    // Whether the incident particle is a positron
+    const bool inc_is_positron_;
+    // True path length [cm]
+    const real_type true_path_;
+    // Radiation length at the track's density [cm]
+    const real_type rad_length_;
     // Incident direction
     const Real3& inc_direction_;
-    // Allocate space for one or more secondary particles
-    SecondaryAllocatorView& allocate_;
+    // Number of transport mean free paths along the step
+    real_type tau_;
+
+    // HELPER FUNCTIONS
+
+    template<class Engine>
+    inline CELER_FUNCTION real_type sample_costheta(Engine& rng) const;
+
+    template<class Engine>
+    inline CELER_FUNCTION real_type sample_simple(Engine&   rng,
+                                                  real_type xmean,
+                                                  real_type x2mean) const;
+
+    inline CELER_FUNCTION real_type calc_theta0() const;
 };
 
 //---------------------------------------------------------------------------//
@@ -6,59 +6,299 @@
 //! \file UrbanInteractor.i.hh
 //---------------------------------------------------------------------------//
 
+#include <cmath>
+#include "base/Algorithms.hh"
+#include "base/ArrayUtils.hh"
+#include "base/Assert.hh"
+#include "base/Constants.hh"
+#include "random/distributions/GenerateCanonical.hh"
+#include "random/distributions/UniformRealDistribution.hh"
+#include "UrbanMfpCalculator.hh"
+
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
  * Construct with shared and state data.
+ *
+ * The end energy must be positive and no larger than the incident energy.
+ * Both the mean free path and the radiation length are divided by the
+ * track's material density scale, so a step in a compressed material is
+ * equivalent to a proportionally longer step at the nominal density.
  */
 CELER_FUNCTION
 UrbanInteractor::UrbanInteractor(const UrbanInteractorPointers& shared,
+                                 const UrbanParamsPointers&     data,
+                                 const MaterialTrackView&       material,
                                  const ParticleTrackView&       particle,
-                                 const Real3&                   inc_direction,
-                                 SecondaryAllocatorView&        allocate)
-    : shared_(shared)
-    , inc_energy_(particle.energy().value())
+                                 real_type                      true_path,
+                                 MevEnergy                      end_energy,
+                                 const Real3&                   inc_direction)
+    : msc_(data.materials[material.def_id().get()])
+    , inc_energy_(particle.energy())
+    , end_energy_(end_energy)
+    , inc_mass_(particle.mass().value())
+    , inc_is_positron_(particle.def_id() == shared.positron_id)
+    , true_path_(true_path)
+    , rad_length_(material.material_view().radiation_length())
     , inc_direction_(inc_direction)
-    , allocate_(allocate)
 {
     REQUIRE(inc_energy_ >= this->min_incident_energy()
             && inc_energy_ <= this->max_incident_energy());
-    REQUIRE(particle.def_id() == shared_.gamma_id); // XXX
+    REQUIRE(particle.def_id() == shared.electron_id
+            || particle.def_id() == shared.positron_id);
+    REQUIRE(end_energy_ > zero_quantity() && end_energy_ <= inc_energy_);
+    REQUIRE(true_path_ > 0);
+
+    // Number of transport mean free paths, with lambda linear in the path
+    UrbanMfpCalculator calc_lambda(data, material);
+    const real_type    lambda_start = calc_lambda(inc_energy_);
+    tau_                            = true_path_ / lambda_start;
+    if (end_energy_ < inc_energy_)
+    {
+        const real_type lambda_end = calc_lambda(end_energy_);
+        if (std::fabs(lambda_end - lambda_start)
+            > real_type(0.01) * lambda_start)
+        {
+            tau_ = true_path_ * std::log(lambda_start / lambda_end)
+                   / (lambda_start - lambda_end);
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Sample using the XXX model.
+ * Sample the direction at the end of the step.
  */
 template<class Engine>
 CELER_FUNCTION Interaction UrbanInteractor::operator()(Engine& rng)
 {
-    // Allocate space for XXX (electron, multiple particles, ...)
-    Secondary* secondaries = this->allocate_(0); // XXX
-    if (secondaries == nullptr)
-    {
-        // Failed to allocate space for a secondary
-        return Interaction::from_failure();
-    }
-
-    // XXX sample
-    (void)sizeof(rng);
+    const real_type costheta = this->sample_costheta(rng);
+    CHECK(costheta >= -1 && costheta <= 1);
 
     // Construct interaction for change to primary (incident) particle
     Interaction result;
-    result.action      = Action::scattered;                     // XXX
-    result.energy      = units::MevEnergy{inc_energy_.value()}; // XXX
-    result.direction   = inc_direction_;
-    result.secondaries = {secondaries, 1}; // XXX
+    result.action = Action::scattered;
+    result.energy = inc_energy_;
 
-    // Save outgoing secondary data
-    secondaries[0].def_id    = shared_.electron_id; // XXX
-    secondaries[0].energy    = units::MevEnergy{0}; // XXX
-    secondaries[0].direction = {0, 0, 0};           // XXX
+    // Sample azimuthal direction and rotate the outgoing direction
+    UniformRealDistribution<real_type> sample_phi(0, 2 * constants::pi);
+    result.direction
+        = rotate(from_spherical(costheta, sample_phi(rng)), inc_direction_);
 
     return result;
 }
 
+//---------------------------------------------------------------------------//
+// PRIVATE HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the cosine of the deflection angle.
+ */
+template<class Engine>
+CELER_FUNCTION real_type UrbanInteractor::sample_costheta(Engine& rng) const
+{
+    // Limits on tau, theta0, and energy loss; numerical cutoff
+    constexpr real_type tau_small     = 1e-16;
+    constexpr real_type tau_big       = 8;
+    constexpr real_type tau_lim       = 1e-6;
+    constexpr real_type theta0_max    = constants::pi / 6;
+    constexpr real_type rel_loss_max  = 0.5;
+    constexpr real_type numerical_lim = 0.01;
+
+    if (tau_ >= tau_big)
+    {
+        // Distribution is nearly isotropic
+        return UniformRealDistribution<real_type>(-1, 1)(rng);
+    }
+    if (tau_ < tau_small)
+    {
+        return 1;
+    }
+
+    // Mean of cos(theta) and of cos^2(theta)
+    real_type xmean;
+    real_type x2mean;
+    if (tau_ < tau_lim)
+    {
+        xmean  = 1 - tau_ * (1 - real_type(0.5) * tau_);
+        x2mean = 1 - tau_ * (5 - real_type(6.25) * tau_) / 3;
+    }
+    else
+    {
+        xmean  = std::exp(-tau_);
+        x2mean = (1 + 2 * std::exp(real_type(-2.5) * tau_)) / 3;
+    }
+
+    // Too large a step for a low-energy particle
+    if (1 - end_energy_.value() / inc_energy_.value() > rel_loss_max)
+    {
+        return this->sample_simple(rng, xmean, x2mean);
+    }
+
+    const real_type theta0    = this->calc_theta0();
+    const real_type theta0_sq = theta0 * theta0;
+    if (theta0_sq < tau_small)
+    {
+        return 1;
+    }
+    if (theta0 > theta0_max)
+    {
+        return this->sample_simple(rng, xmean, x2mean);
+    }
+
+    // Width of the central part in 1 - cos(theta)
+    real_type x = theta0_sq * (1 - theta0_sq / 12);
+    if (theta0_sq > numerical_lim)
+    {
+        const real_type sint = 2 * std::sin(real_type(0.5) * theta0);
+        x                    = sint * sint;
+    }
+
+    // Tail parameter, which should not be too small
+    const real_type u          = std::exp(std::log(tau_) / 6);
+    const real_type lambda_eff = true_path_ / tau_;
+    real_type       xsi = msc_.tail[0] + u * (msc_.tail[1] + msc_.tail[2] * u)
+                    + msc_.tail[3] * std::log(lambda_eff / rad_length_);
+    xsi = max(xsi, real_type(1.9));
+
+    // Exponent of the tail, avoiding singularities
+    real_type c = xsi;
+    if (std::fabs(c - 3) < real_type(0.001))
+    {
+        c = real_type(3.001);
+    }
+    else if (std::fabs(c - 2) < real_type(0.001))
+    {
+        c = real_type(2.001);
+    }
+    const real_type c1 = c - 1;
+
+    const real_type ea     = std::exp(-xsi);
+    const real_type eaa    = 1 - ea;
+    const real_type xmean1 = 1 - (1 - (1 + xsi) * ea) * x / eaa;
+    if (xmean1 <= real_type(0.999) * xmean)
+    {
+        return this->sample_simple(rng, xmean, x2mean);
+    }
+
+    // Tail matched to the central part with a continuous derivative
+    const real_type b      = 1 + (c - xsi) * x;
+    const real_type b1     = b + 1;
+    const real_type bx     = c * x;
+    const real_type d      = std::pow(bx / b1, c1);
+    const real_type xmean2 = (1 - xsi * x + d - (bx - b1 * d) / (c - 2))
+                             / (1 - d);
+
+    // Probability of the central part, and of central or tail given the mean
+    const real_type f1x0  = ea / eaa;
+    const real_type f2x0  = c1 / (c * (1 - d));
+    const real_type prob  = f2x0 / (f1x0 + f2x0);
+    const real_type qprob = xmean / (prob * xmean1 + (1 - prob) * xmean2);
+    if (qprob > 1)
+    {
+        // Model function is too wide to reproduce the mean
+        return this->sample_simple(rng, xmean, x2mean);
+    }
+
+    if (generate_canonical(rng) >= qprob)
+    {
+        return UniformRealDistribution<real_type>(-1, 1)(rng);
+    }
+    if (generate_canonical(rng) < prob)
+    {
+        // Central part
+        return max(1 + std::log(ea + generate_canonical(rng) * eaa) * x,
+                   real_type(-1));
+    }
+
+    // Tail
+    real_type var = (1 - d) * generate_canonical(rng);
+    if (var < numerical_lim * d)
+    {
+        var /= d * c1;
+        return -1 + var * (1 - real_type(0.5) * var * c) * (2 + (c - xsi) * x);
+    }
+    return min(1 + x * (c - xsi - c * std::pow(var + d, -1 / c1)),
+               real_type(1));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample from a simple distribution with the given first two moments.
+ *
+ * This is used when the model function is not applicable, i.e. for large
+ * angles or energy losses, or when its mean is too small.
+ */
+template<class Engine>
+CELER_FUNCTION real_type UrbanInteractor::sample_simple(Engine&   rng,
+                                                        real_type xmean,
+                                                        real_type x2mean) const
+{
+    const real_type a = (2 * xmean + 9 * x2mean - 3)
+                        / (2 * xmean - 3 * x2mean + 1);
+    const real_type prob = (a + 2) * xmean / a;
+    if (generate_canonical(rng) < prob)
+    {
+        return -1 + 2 * std::pow(generate_canonical(rng), 1 / (a + 1));
+    }
+    return UniformRealDistribution<real_type>(-1, 1)(rng);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Width of the central part of the angular distribution.
+ *
+ * This is the Highland formula with a correction fitted to electron
+ * scattering data, using the geometric mean of the start and end energies.
+ */
+CELER_FUNCTION real_type UrbanInteractor::calc_theta0() const
+{
+    // Highland constant [MeV]
+    constexpr real_type c_highland = 13.6;
+
+    const real_type inc        = inc_energy_.value();
+    const real_type end        = end_energy_.value();
+    const real_type inv_betacp
+        = std::sqrt((inc + inc_mass_) / (inc * (inc + 2 * inc_mass_))
+                    * (end + inc_mass_) / (end * (end + 2 * inc_mass_)));
+
+    real_type y = true_path_ / rad_length_;
+    if (inc_is_positron_)
+    {
+        // Correction as a function of the speed of the positron
+        constexpr real_type xl = 0.6;
+        constexpr real_type xh = 0.9;
+        constexpr real_type e  = 113;
+
+        const real_type tau = std::sqrt(inc * end) / inc_mass_;
+        const real_type x = std::sqrt(tau * (tau + 2)) / (tau + 1);
+        const real_type a = msc_.positron[0];
+        const real_type b = msc_.positron[1];
+        const real_type c = msc_.positron[2];
+        const real_type d = msc_.positron[3];
+
+        real_type corr;
+        if (x < xl)
+        {
+            corr = a * (1 - std::exp(-b * x));
+        }
+        else if (x > xh)
+        {
+            corr = c + d * std::exp(e * (x - 1));
+        }
+        else
+        {
+            const real_type yl = a * (1 - std::exp(-b * xl));
+            const real_type yh = c + d * std::exp(e * (xh - 1));
+            corr               = yl + (yh - yl) * (x - xl) / (xh - xl);
+        }
+        y *= corr * msc_.positron[4];
+    }
+
+    return c_highland * std::sqrt(y) * inv_betacp
+           * (msc_.theta0[0] + msc_.theta0[1] * std::log(y));
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
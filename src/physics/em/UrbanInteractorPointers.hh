@@ -14,20 +14,19 @@ namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Device data for creating an interactor.
+ * Device data for creating an UrbanInteractor.
  */
 struct UrbanInteractorPointers
 {
     //! ID of an electron
     ParticleDefId electron_id;
-    //! ID of a gamma
-    ParticleDefId gamma_id;
-    // XXX additional data
+    //! ID of a positron
+    ParticleDefId positron_id;
 
     //! Check whether the data is assigned
     explicit inline CELER_FUNCTION operator bool() const
     {
-        return electron_id && gamma_id; // XXX
+        return electron_id && positron_id;
     }
 };
 
@@ -0,0 +1,55 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file UrbanMfpCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/base/Units.hh"
+#include "physics/material/MaterialTrackView.hh"
+#include "UrbanParamsPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the transport mean free path of an electron or positron.
+ *
+ * The tabulated values are interpolated linearly in
+ * \f$ \ln \lambda_1 \f$ versus \f$ \ln E \f$ and scaled by the density of the
+ * track's material. Outside the energy grid the nearest interval is
+ * extrapolated.
+ */
+class UrbanMfpCalculator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
+  public:
+    // Construct with material data
+    inline CELER_FUNCTION UrbanMfpCalculator(const UrbanParamsPointers& data,
+                                             const MaterialTrackView& material);
+
+    // Compute transport mean free path [cm]
+    inline CELER_FUNCTION real_type operator()(MevEnergy energy) const;
+
+  private:
+    // Tabulated multiple scattering data
+    const UrbanParamsPointers& data_;
+    // Start of the material's table row
+    size_type row_;
+    // Inverse of the density relative to the nominal material
+    real_type inv_density_scale_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "UrbanMfpCalculator.i.hh"
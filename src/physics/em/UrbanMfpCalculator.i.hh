@@ -0,0 +1,61 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file UrbanMfpCalculator.i.hh
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include "base/Assert.hh"
+#include "base/UniformGrid.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with material data.
+ */
+CELER_FUNCTION
+UrbanMfpCalculator::UrbanMfpCalculator(const UrbanParamsPointers& data,
+                                       const MaterialTrackView&   material)
+    : data_(data)
+    , row_(data.row(material.def_id(), 0))
+    , inv_density_scale_(1 / material.density_scale())
+{
+    REQUIRE(data_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compute transport mean free path [cm].
+ */
+CELER_FUNCTION real_type UrbanMfpCalculator::operator()(MevEnergy energy) const
+{
+    REQUIRE(energy.value() > 0);
+
+    const UniformGrid loge_grid(data_.log_energy);
+    const real_type   loge = std::log(energy.value());
+    size_type         energy_idx;
+    if (loge <= loge_grid.front())
+    {
+        energy_idx = 0;
+    }
+    else if (loge >= loge_grid.back())
+    {
+        energy_idx = loge_grid.size() - 2;
+    }
+    else
+    {
+        energy_idx = loge_grid.find(loge);
+    }
+    const real_type frac = (loge - loge_grid[energy_idx])
+                           / data_.log_energy.delta;
+
+    const real_type* lambda = data_.lambda.data() + row_ + energy_idx;
+    return lambda[0] * std::pow(lambda[1] / lambda[0], frac)
+           * inv_density_scale_;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,185 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file UrbanParams.cc
+//---------------------------------------------------------------------------//
+#include "UrbanParams.hh"
+
+#include <cmath>
+#include "base/Constants.hh"
+#include "base/Range.hh"
+#include "comm/Device.hh"
+#include "physics/material/MaterialView.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the Urban model coefficients from the effective atomic number.
+ *
+ * These are the empirical fits of G4UrbanMscModel (release 10.6).
+ */
+UrbanMscMaterial calc_material_coeffs(real_type zeff)
+{
+    UrbanMscMaterial result;
+
+    // Correction to the Highland formula for the width
+    const real_type w    = std::exp(std::log(zeff) / 6);
+    const real_type facz = 0.990395 + w * (-0.168386 + w * 0.093286);
+    result.theta0[0]     = facz * (1 - 8.7780e-2 / zeff);
+    result.theta0[1]     = facz * (4.0780e-2 + 1.7315e-4 * zeff);
+
+    // Parameters of the tail of the angular distribution
+    const real_type z13 = w * w;
+    result.tail[0]      = 2.3785 - 4.1981e-1 * z13 + 6.3100e-2 * z13 * z13;
+    result.tail[1]      = 4.7526e-1 + 1.7694 * z13 - 3.3885e-1 * z13 * z13;
+    result.tail[2]      = 2.3683e-1 - 1.8111 * z13 + 3.2774e-1 * z13 * z13;
+    result.tail[3] = 1.7888e-2 + 1.9659e-2 * z13 - 2.6664e-3 * z13 * z13;
+
+    // Correction to the width for positrons
+    result.positron[0] = 0.994 - 4.08e-3 * zeff;
+    result.positron[1] = 7.16 + (52.6 + 365 / zeff) / zeff;
+    result.positron[2] = 1 - 4.47e-3 * zeff;
+    result.positron[3] = 1.21e-3 * zeff;
+    result.positron[4] = 1 + zeff * (1.84035e-4 * zeff - 1.86427e-2)
+                         + 0.41125;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from the materials in the problem.
+ */
+UrbanParams::UrbanParams(const MaterialParams& materials, const Input& inp)
+    : log_energy_(inp.log_energy)
+{
+    REQUIRE(inp.log_energy);
+    REQUIRE(materials.num_materials() > 0);
+
+    const MaterialParamsPointers mat_ptrs = materials.host_pointers();
+    const UniformGrid            loge_grid(log_energy_);
+    host_materials_.resize(materials.num_materials());
+    host_lambda_.resize(materials.num_materials() * loge_grid.size());
+    for (auto mat_idx : range<MaterialDefId::value_type>(
+             materials.num_materials()))
+    {
+        const MaterialView material(mat_ptrs, MaterialDefId{mat_idx});
+
+        // Mass-weighted effective atomic number
+        real_type z_mass = 0;
+        real_type mass   = 0;
+        for (const MatElementComponent& comp : material.elements())
+        {
+            const ElementView element(mat_ptrs, comp.element);
+            const real_type   el_mass = comp.fraction
+                                      * element.atomic_mass().value();
+            z_mass += el_mass * element.atomic_number();
+            mass += el_mass;
+        }
+        CHECK(mass > 0);
+        host_materials_[mat_idx] = calc_material_coeffs(z_mass / mass);
+
+        // Transport mean free path at nominal density
+        for (auto e : range(loge_grid.size()))
+        {
+            const MevEnergy energy{std::exp(loge_grid[e])};
+            real_type       macro_xs = 0;
+            for (auto el_idx : range<ElementComponentId::value_type>(
+                     material.num_elements()))
+            {
+                const ElementComponentId comp_id{el_idx};
+                macro_xs += material.get_element_density(comp_id)
+                            * transport_xs(material.element_view(comp_id),
+                                           energy);
+            }
+            CHECK(macro_xs > 0);
+            host_lambda_[mat_idx * loge_grid.size() + e] = 1 / macro_xs;
+        }
+    }
+
+    if (celeritas::is_device_enabled())
+    {
+        device_materials_
+            = DeviceVector<UrbanMscMaterial>(host_materials_.size());
+        device_materials_.copy_to_device(make_span(host_materials_));
+        device_lambda_ = DeviceVector<real_type>(host_lambda_.size());
+        device_lambda_.copy_to_device(make_span(host_lambda_));
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport cross section of an electron off an element [cm^2].
+ */
+real_type
+UrbanParams::transport_xs(const ElementView& element, MevEnergy energy)
+{
+    REQUIRE(energy > zero_quantity());
+    using constants::alpha_fine_structure;
+    const real_type mass = constants::electron_mass * constants::c_light
+                           * constants::c_light / units::Mev::value();
+    const real_type hbar_c = constants::hbar_planck * constants::c_light
+                             / units::Mev::value();
+
+    const real_type kinetic     = energy.value();
+    const real_type momentum_sq = kinetic * (kinetic + 2 * mass);
+    const real_type beta_sq     = momentum_sq
+                              / ((kinetic + mass) * (kinetic + mass));
+    const real_type z = element.atomic_number();
+
+    // Molière screening parameter
+    const real_type tf_radius = 0.88534 * constants::a0_bohr
+                                / element.cbrt_z();
+    const real_type screen = hbar_c * hbar_c
+                             / (4 * momentum_sq * tf_radius * tf_radius)
+                             * (1.13
+                                + 3.76 * alpha_fine_structure
+                                      * alpha_fine_structure * z * z
+                                      / beta_sq);
+
+    const real_type re_mc2 = constants::re_electron * mass;
+    return 2 * constants::pi * z * (z + 1) * re_mc2 * re_mc2
+           / (beta_sq * momentum_sq)
+           * (std::log1p(1 / screen) - 1 / (1 + screen));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access tables on the host.
+ */
+UrbanParamsPointers UrbanParams::host_pointers() const
+{
+    UrbanParamsPointers result;
+    result.log_energy = log_energy_;
+    result.materials  = make_span(host_materials_);
+    result.lambda     = make_span(host_lambda_);
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access tables on the device.
+ */
+UrbanParamsPointers UrbanParams::device_pointers() const
+{
+    REQUIRE(!device_lambda_.empty());
+    UrbanParamsPointers result;
+    result.log_energy = log_energy_;
+    result.materials  = device_materials_.device_pointers();
+    result.lambda     = device_lambda_.device_pointers();
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
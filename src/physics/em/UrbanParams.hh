@@ -0,0 +1,81 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file UrbanParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+#include "base/DeviceVector.hh"
+#include "base/Types.hh"
+#include "base/UniformGrid.hh"
+#include "physics/base/Units.hh"
+#include "physics/material/ElementView.hh"
+#include "physics/material/MaterialParams.hh"
+#include "UrbanParamsPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Material and energy dependent data for Urban multiple scattering.
+ *
+ * Everything the angular sampling needs that does not depend on the step is
+ * computed here once:
+ * - the corrections to the Highland width, the tail parameter, and the
+ *   positron width from the effective atomic number
+ *   \f$ Z_\mathrm{eff} = \sum_i w_i Z_i \f$ (\f$ w_i \f$ mass fractions) of
+ *   each material; and
+ * - the transport mean free path \f$ \lambda_1 \f$ of each material on the
+ *   energy grid.
+ *
+ * The transport cross section of each element is that of screened Rutherford
+ * scattering off the nucleus and atomic electrons,
+ * \f[
+   \sigma_1 = 2\pi Z(Z+1) \left(\frac{r_e m c^2}{\beta p c}\right)^2
+   \left[ \ln\left(1 + \frac{1}{A}\right) - \frac{1}{1 + A} \right] ,
+ * \f]
+ * with Molière's screening parameter
+ * \f$ A = (\hbar c / 2 p c\, a)^2 (1.13 + 3.76 (\alpha Z / \beta)^2) \f$
+ * and Thomas–Fermi radius \f$ a = 0.88534\, a_0 Z^{-1/3} \f$.
+ */
+class UrbanParams
+{
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
+    //! Input data to construct this class
+    struct Input
+    {
+        UniformGrid::Params log_energy; //!< Energy grid [ln MeV]
+    };
+
+  public:
+    // Construct from the materials in the problem
+    UrbanParams(const MaterialParams& materials, const Input& inp);
+
+    // Transport cross section of an electron off an element [cm^2]
+    static real_type transport_xs(const ElementView& element, MevEnergy energy);
+
+    // Access tables on the host
+    UrbanParamsPointers host_pointers() const;
+
+    // Access tables on the device
+    UrbanParamsPointers device_pointers() const;
+
+  private:
+    UniformGrid::Params           log_energy_;
+    std::vector<UrbanMscMaterial> host_materials_;
+    std::vector<real_type>        host_lambda_;
+
+    DeviceVector<UrbanMscMaterial> device_materials_;
+    DeviceVector<real_type>        device_lambda_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,71 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file UrbanParamsPointers.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Array.hh"
+#include "base/Assert.hh"
+#include "base/Macros.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "base/UniformGrid.hh"
+#include "physics/material/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Urban multiple scattering coefficients of a material.
+ *
+ * These depend only on the effective atomic number of the material.
+ */
+struct UrbanMscMaterial
+{
+    Array<real_type, 2> theta0;   //!< Correction to the Highland width
+    Array<real_type, 4> tail;     //!< Tail parameter coefficients
+    Array<real_type, 5> positron; //!< Positron correction to the width
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Urban multiple scattering data, all materials.
+ *
+ * The transport mean free path of electrons and positrons at the nominal
+ * density of each material is stored at every point of a uniform grid in
+ * \f$ \ln(E / \mathrm{MeV}) \f$, indexed as [material][energy].
+ *
+ * \sa UrbanParams (owns the pointed-to data)
+ * \sa UrbanMfpCalculator (interpolates the transport mean free path)
+ * \sa UrbanInteractor (samples the deflection over a step)
+ */
+struct UrbanParamsPointers
+{
+    UniformGrid::Params          log_energy; //!< Energy grid [ln MeV]
+    Span<const UrbanMscMaterial> materials;  //!< Coefficients [material]
+    Span<const real_type>        lambda;     //!< Transport mfp [cm]
+
+    //! Check whether the interface is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return log_energy && !materials.empty()
+               && lambda.size() == materials.size() * log_energy.size;
+    }
+
+    //! Number of materials
+    CELER_FUNCTION size_type num_materials() const { return materials.size(); }
+
+    //! Index of the table row of a material at an energy grid point
+    CELER_FUNCTION size_type row(MaterialDefId mat, size_type energy_idx) const
+    {
+        REQUIRE(mat < this->num_materials());
+        REQUIRE(energy_idx < log_energy.size);
+        return mat.get() * log_energy.size + energy_idx;
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -11,32 +11,58 @@
 #include "base/Types.hh"
 #include "physics/base/Interaction.hh"
 #include "physics/base/ParticleTrackView.hh"
-#include "physics/base/SecondaryAllocatorView.hh"
-#include "physics/base/Secondary.hh"
 #include "physics/base/Units.hh"
 #include "WentzelInteractorPointers.hh"
+#include "WentzelParamsPointers.hh"
 
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Brief class description.
+ * Wentzel single Coulomb scattering of a charged lepton off an atom.
  *
- * This is a model for XXXX process. Additional description
+ * The deflection \f$ \mu = 1 - \cos\theta \f$ is sampled exactly from the
+ * screened Rutherford distribution \f$ 1/(\mu + 2A)^2 \f$ above a limiting
+ * deflection \f$ \mu_c \f$. The target is the nucleus with probability
+ * \f$ Z/(Z+1) \f$ and an atomic electron otherwise. The sample is then
+ * accepted with the probability
+ * \f$ (1 - \beta^2 \mu / 2)\, F^2(\mu) \f$, the product of the spin factor
+ * and (for the nucleus only) the squared nuclear form factor. A rejected
+ * sample leaves the particle undeflected, which keeps the total rate equal
+ * to the one from \c WentzelMicroXsCalculator.
  *
- * \note This performs the same sampling routine as in Geant4's
- * XXXX class, as documented in section XXX of the Geant4 Physics
- * Reference (release 10.6).
+ * The screening and form factor parameters are interpolated from the
+ * \c WentzelParams tables for the sampled element, so each collision takes
+ * a few table lookups and random numbers. With a limiting cosine of 1 this is
+ * a pure single scattering model; with the cosine of the angle separating
+ * soft and hard collisions it samples the hard component of a mixed
+ * multiple scattering scheme, where the soft collisions are handled by a
+ * condensed history model.
+ *
+ * The energy transfer to the target (recoil) is neglected: the exiting
+ * energy is unchanged and there are no secondaries.
+ *
+ * \note This follows the single scattering part of Geant4's
+ * G4WentzelOKandVIxSection class (SampleSingleScattering), as documented in
+ * the Wentzel-VI section of the Geant4 Physics Reference (release 10.6).
  */
 class WentzelInteractor
 {
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
   public:
     // Construct with shared and state data
     inline CELER_FUNCTION
     WentzelInteractor(const WentzelInteractorPointers& shared,
+                      const WentzelParamsPointers&     data,
+                      ElementDefId                     element,
                       const ParticleTrackView&         particle,
-                      const Real3&                     inc_direction,
-                      SecondaryAllocatorView&          allocate);
+                      real_type                        costheta_limit,
+                      const Real3&                     inc_direction);
 
     // Sample an interaction with the given RNG
     template<class Engine>
@@ -45,26 +71,32 @@ class WentzelInteractor
     //// COMMON PROPERTIES ////
 
     //! Minimum incident energy for this model to be valid
-    static CELER_CONSTEXPR_FUNCTION units::MevEnergy min_incident_energy()
+    static CELER_CONSTEXPR_FUNCTION MevEnergy min_incident_energy()
     {
-        return units::MevEnergy{0}; // XXX
+        return MevEnergy{1e-3};
     }
 
     //! Maximum incident energy for this model to be valid
-    static CELER_CONSTEXPR_FUNCTION units::MevEnergy max_incident_energy()
+    static CELER_CONSTEXPR_FUNCTION MevEnergy max_incident_energy()
     {
-        return units::MevEnergy{0}; // XXX
+        return MevEnergy{1e8};
     }
 
   private:
-    // Shared constant physics properties
-    const WentzelInteractorPointers& shared_;
-    // Incident gamma energy
-    const units::MevEnergy inc_energy_;
+    // Incident kinetic energy
+    const MevEnergy inc_energy_;
     // Incident direction
     const Real3& inc_direction_;
-    // Allocate space for one or more secondary particles
-    SecondaryAllocatorView& allocate_;
+    // Minimum value of 1 - cos(theta)
+    const real_type min_mu_;
+    // Atomic number of the target element
+    real_type atomic_number_;
+    // Screening parameter 2A
+    real_type screening_;
+    // Nuclear form factor coefficient
+    real_type form_factor_;
+    // Square of the incident speed relative to c
+    real_type beta_sq_;
 };
 
 //---------------------------------------------------------------------------//
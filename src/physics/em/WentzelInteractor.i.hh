@@ -6,56 +6,90 @@
 //! \file WentzelInteractor.i.hh
 //---------------------------------------------------------------------------//
 
+#include "base/Algorithms.hh"
+#include "base/ArrayUtils.hh"
+#include "base/Assert.hh"
+#include "base/Constants.hh"
+#include "random/distributions/BernoulliDistribution.hh"
+#include "random/distributions/GenerateCanonical.hh"
+#include "random/distributions/UniformRealDistribution.hh"
+#include "detail/WentzelTableView.hh"
+
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
  * Construct with shared and state data.
+ *
+ * Only deflections with a cosine below \c costheta_limit are sampled: use 1
+ * for pure single scattering.
  */
 CELER_FUNCTION
 WentzelInteractor::WentzelInteractor(const WentzelInteractorPointers& shared,
+                                     const WentzelParamsPointers&     data,
+                                     ElementDefId                     element,
                                      const ParticleTrackView&         particle,
-                                     const Real3&            inc_direction,
-                                     SecondaryAllocatorView& allocate)
-    : shared_(shared)
-    , inc_energy_(particle.energy().value())
+                                     real_type    costheta_limit,
+                                     const Real3& inc_direction)
+    : inc_energy_(particle.energy())
     , inc_direction_(inc_direction)
-    , allocate_(allocate)
+    , min_mu_(1 - costheta_limit)
 {
     REQUIRE(inc_energy_ >= this->min_incident_energy()
             && inc_energy_ <= this->max_incident_energy());
-    REQUIRE(particle.def_id() == shared_.gamma_id); // XXX
+    REQUIRE(shared.applies(particle.def_id()));
+    REQUIRE(costheta_limit > -1 && costheta_limit <= 1);
+
+    const detail::WentzelTableView table(data, particle);
+    atomic_number_ = table.atomic_number(element);
+    screening_     = table.screening(element);
+    form_factor_   = table.form_factor(element);
+
+    const real_type total = inc_energy_.value() + particle.mass().value();
+    beta_sq_ = particle.momentum_sq().value() / (total * total);
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Sample using the XXX model.
+ * Sample a single elastic collision.
  */
 template<class Engine>
 CELER_FUNCTION Interaction WentzelInteractor::operator()(Engine& rng)
 {
-    // Allocate space for XXX (electron, multiple particles, ...)
-    Secondary* secondaries = this->allocate_(0); // XXX
-    if (secondaries == nullptr)
+    // Scatter off the nucleus or off an atomic electron
+    const bool nucleus = BernoulliDistribution(
+        atomic_number_ / (atomic_number_ + 1))(rng);
+
+    // Sample 1 - cos(theta) from the screened Rutherford distribution
+    const real_type w1 = min_mu_ + screening_;
+    const real_type w2 = 2 + screening_;
+    real_type       mu = w1 * w2 / (w2 - generate_canonical(rng) * (w2 - w1))
+                   - screening_;
+    mu = min(max(mu, min_mu_), real_type(2));
+
+    // Spin and nuclear size corrections
+    real_type accept = 1 - real_type(0.5) * beta_sq_ * mu;
+    if (nucleus)
     {
-        // Failed to allocate space for a secondary
-        return Interaction::from_failure();
+        accept /= ipow<4>(1 + form_factor_ * mu);
     }
 
-    // XXX sample
-    (void)sizeof(rng);
-
     // Construct interaction for change to primary (incident) particle
     Interaction result;
-    result.action      = Action::scattered;                     // XXX
-    result.energy      = units::MevEnergy{inc_energy_.value()}; // XXX
-    result.direction   = inc_direction_;
-    result.secondaries = {secondaries, 1}; // XXX
+    result.action    = Action::scattered;
+    result.energy    = inc_energy_;
+    result.direction = inc_direction_;
+
+    if (generate_canonical(rng) > accept)
+    {
+        // Rejected collision does not deflect the particle
+        return result;
+    }
 
-    // Save outgoing secondary data
-    secondaries[0].def_id    = shared_.electron_id; // XXX
-    secondaries[0].energy    = units::MevEnergy{0}; // XXX
-    secondaries[0].direction = {0, 0, 0};           // XXX
+    // Sample azimuthal direction and rotate the outgoing direction
+    UniformRealDistribution<real_type> sample_phi(0, 2 * constants::pi);
+    result.direction
+        = rotate(from_spherical(1 - mu, sample_phi(rng)), inc_direction_);
 
     return result;
 }
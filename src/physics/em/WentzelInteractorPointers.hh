@@ -15,19 +15,31 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Device data for creating an interactor.
+ *
+ * Muons are optional: their IDs may be unassigned if the problem has none.
  */
 struct WentzelInteractorPointers
 {
     //! ID of an electron
     ParticleDefId electron_id;
-    //! ID of a gamma
-    ParticleDefId gamma_id;
-    // XXX additional data
+    //! ID of a positron
+    ParticleDefId positron_id;
+    //! ID of a negative muon
+    ParticleDefId mu_minus_id;
+    //! ID of a positive muon
+    ParticleDefId mu_plus_id;
 
     //! Check whether the data is assigned
     explicit inline CELER_FUNCTION operator bool() const
     {
-        return electron_id && gamma_id; // XXX
+        return electron_id && positron_id;
+    }
+
+    //! Whether the model applies to a particle type
+    CELER_FUNCTION bool applies(ParticleDefId id) const
+    {
+        return id == electron_id || id == positron_id || id == mu_minus_id
+               || id == mu_plus_id;
     }
 };
 
@@ -0,0 +1,63 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file WentzelMicroXsCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "physics/base/Units.hh"
+#include "detail/WentzelTableView.hh"
+#include "WentzelInteractorPointers.hh"
+#include "WentzelParamsPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate Wentzel single scattering cross sections above an angular limit.
+ *
+ * This is the integral of the screened Rutherford cross section, scattering
+ * off both the nucleus and the atomic electrons, from the limiting deflection
+ * to backscattering:
+ * \f[
+   \sigma = 2\pi z^2 Z(Z+1) \left(\frac{r_e m_e c^2}{\beta p c}\right)^2
+   \frac{\mu_c + 1}{(1 - \mu_c + 2A)(2 + 2A)} .
+ * \f]
+ * The spin and nuclear form factor corrections are not integrated: they are
+ * applied as rejections in \c WentzelInteractor, which leaves the particle
+ * undeflected when a sample is rejected. This upper bound is therefore the
+ * correct rate for the collisions sampled by the interactor.
+ *
+ * The calculator is a valid \c ElementSelector cross section functor.
+ */
+class WentzelMicroXsCalculator
+{
+  public:
+    // Construct with shared and state data
+    inline CELER_FUNCTION
+    WentzelMicroXsCalculator(const WentzelInteractorPointers& shared,
+                             const WentzelParamsPointers&     data,
+                             const ParticleTrackView&         particle,
+                             real_type                        costheta_limit);
+
+    // Compute cross section per atom [cm^2]
+    inline CELER_FUNCTION real_type operator()(ElementDefId el) const;
+
+  private:
+    // Interpolated screening parameters
+    detail::WentzelTableView table_;
+    // Prefactor 2 pi (z r_e m_e c^2 / beta p c)^2 [cm^2]
+    real_type prefactor_;
+    // Minimum value of 1 - cos(theta)
+    real_type min_mu_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "WentzelMicroXsCalculator.i.hh"
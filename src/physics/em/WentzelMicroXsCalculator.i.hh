@@ -0,0 +1,58 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file WentzelMicroXsCalculator.i.hh
+//---------------------------------------------------------------------------//
+
+#include "base/Assert.hh"
+#include "base/Constants.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with shared and state data.
+ *
+ * Only collisions with a deflection cosine below \c costheta_limit are
+ * counted: use 1 for pure single scattering, or the cosine of the angle
+ * separating soft and hard collisions in a mixed scheme.
+ */
+CELER_FUNCTION WentzelMicroXsCalculator::WentzelMicroXsCalculator(
+    const WentzelInteractorPointers& shared,
+    const WentzelParamsPointers&     data,
+    const ParticleTrackView&         particle,
+    real_type                        costheta_limit)
+    : table_(data, particle), min_mu_(1 - costheta_limit)
+{
+    REQUIRE(shared.applies(particle.def_id()));
+    REQUIRE(costheta_limit >= -1 && costheta_limit <= 1);
+
+    // (beta p)^2 = p^4 / E^2 [MeV^2]
+    const real_type p_sq      = particle.momentum_sq().value();
+    const real_type total     = particle.energy().value()
+                            + particle.mass().value();
+    const real_type beta_p_sq = p_sq * p_sq / (total * total);
+
+    const real_type re_mc2 = constants::re_electron * data.electron_mass;
+    const real_type charge = particle.charge().value();
+    prefactor_ = 2 * constants::pi * charge * charge * re_mc2 * re_mc2
+                 / beta_p_sq;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compute cross section per atom [cm^2].
+ */
+CELER_FUNCTION real_type
+WentzelMicroXsCalculator::operator()(ElementDefId el) const
+{
+    const real_type z      = table_.atomic_number(el);
+    const real_type screen = table_.screening(el);
+    return prefactor_ * z * (z + 1) * (2 - min_mu_)
+           / ((min_mu_ + screen) * (2 + screen));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
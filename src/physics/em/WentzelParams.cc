@@ -0,0 +1,160 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file WentzelParams.cc
+//---------------------------------------------------------------------------//
+#include "WentzelParams.hh"
+
+#include <cmath>
+#include "base/Constants.hh"
+#include "base/Range.hh"
+#include "comm/Device.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// Electron rest energy [MeV]
+constexpr real_type electron_mass_c2()
+{
+    return constants::electron_mass * constants::c_light * constants::c_light
+           / units::Mev::value();
+}
+
+//---------------------------------------------------------------------------//
+// Reduced Planck constant times the speed of light [MeV cm]
+constexpr real_type hbar_c()
+{
+    return constants::hbar_planck * constants::c_light / units::Mev::value();
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from the elements in the problem.
+ */
+WentzelParams::WentzelParams(const MaterialParams& materials, const Input& inp)
+    : log_energy_(inp.log_energy)
+{
+    REQUIRE(inp.log_energy);
+    REQUIRE(materials.num_elements() > 0);
+
+    const MaterialParamsPointers mat_ptrs     = materials.host_pointers();
+    const size_type              num_elements = materials.num_elements();
+    const UniformGrid            loge_grid(log_energy_);
+    host_atomic_number_.resize(num_elements);
+    host_screening_.resize(num_elements * loge_grid.size());
+    host_form_factor_.resize(num_elements * loge_grid.size());
+    for (auto el : range<ElementDefId::value_type>(num_elements))
+    {
+        const ElementView element(mat_ptrs, ElementDefId{el});
+        host_atomic_number_[el] = element.atomic_number();
+        for (auto e : range(loge_grid.size()))
+        {
+            const MevEnergy energy{std::exp(loge_grid[e])};
+            const size_type row    = el * loge_grid.size() + e;
+            host_screening_[row]   = screening(element, energy);
+            host_form_factor_[row] = form_factor(element, energy);
+        }
+    }
+
+    if (celeritas::is_device_enabled())
+    {
+        device_atomic_number_
+            = DeviceVector<real_type>(host_atomic_number_.size());
+        device_atomic_number_.copy_to_device(make_span(host_atomic_number_));
+        device_screening_ = DeviceVector<real_type>(host_screening_.size());
+        device_screening_.copy_to_device(make_span(host_screening_));
+        device_form_factor_ = DeviceVector<real_type>(host_form_factor_.size());
+        device_form_factor_.copy_to_device(make_span(host_form_factor_));
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Screening parameter 2A for an electron.
+ */
+real_type WentzelParams::screening(const ElementView& element, MevEnergy energy)
+{
+    REQUIRE(energy > zero_quantity());
+    using constants::alpha_fine_structure;
+
+    const real_type mass        = electron_mass_c2();
+    const real_type kinetic     = energy.value();
+    const real_type momentum_sq = kinetic * (kinetic + 2 * mass);
+    const real_type beta_sq     = momentum_sq
+                              / ((kinetic + mass) * (kinetic + mass));
+    const real_type z = element.atomic_number();
+
+    const real_type tf_radius = 0.88534 * constants::a0_bohr
+                                / element.cbrt_z();
+    return hbar_c() * hbar_c() / (2 * momentum_sq * tf_radius * tf_radius)
+           * (1.13
+              + 3.76 * alpha_fine_structure * alpha_fine_structure * z * z
+                    / beta_sq);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Nuclear form factor coefficient for an electron.
+ */
+real_type
+WentzelParams::form_factor(const ElementView& element, MevEnergy energy)
+{
+    REQUIRE(energy > zero_quantity());
+
+    // Nuclear radius [cm]
+    constexpr real_type fermi = 1e-13 * units::centimeter;
+    const real_type     radius
+        = element.atomic_number() == 1
+              ? 0.84 * fermi
+              : 1.27 * fermi
+                    * std::pow(element.atomic_mass().value(), real_type(0.27));
+
+    const real_type kinetic     = energy.value();
+    const real_type momentum_sq = kinetic * (kinetic + 2 * electron_mass_c2());
+    return momentum_sq * radius * radius / (6 * hbar_c() * hbar_c());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access tables on the host.
+ */
+WentzelParamsPointers WentzelParams::host_pointers() const
+{
+    WentzelParamsPointers result;
+    result.log_energy    = log_energy_;
+    result.electron_mass = electron_mass_c2();
+    result.atomic_number = make_span(host_atomic_number_);
+    result.screening     = make_span(host_screening_);
+    result.form_factor   = make_span(host_form_factor_);
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access tables on the device.
+ */
+WentzelParamsPointers WentzelParams::device_pointers() const
+{
+    REQUIRE(!device_screening_.empty());
+    WentzelParamsPointers result;
+    result.log_energy    = log_energy_;
+    result.electron_mass = electron_mass_c2();
+    result.atomic_number = device_atomic_number_.device_pointers();
+    result.screening     = device_screening_.device_pointers();
+    result.form_factor   = device_form_factor_.device_pointers();
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
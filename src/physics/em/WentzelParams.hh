@@ -0,0 +1,86 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file WentzelParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+#include "base/DeviceVector.hh"
+#include "base/Types.hh"
+#include "base/UniformGrid.hh"
+#include "physics/base/Units.hh"
+#include "physics/material/ElementView.hh"
+#include "physics/material/MaterialParams.hh"
+#include "WentzelParamsPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulated parameters for single Coulomb scattering off atoms.
+ *
+ * The Wentzel model of elastic scattering of a charged particle off an atom
+ * is
+ * \f[
+   \frac{d\sigma}{d\mu} = 2\pi z^2 Z(Z+1)
+   \left(\frac{r_e m_e c^2}{\beta p c}\right)^2
+   \frac{1}{(1 - \mu + 2A)^2} ,
+ * \f]
+ * where the screening parameter is Molière's
+ * \f$ 2A = 2 (\hbar c / 2 p c\, a)^2 (1.13 + 3.76 (\alpha Z / \beta)^2) \f$
+ * with the Thomas–Fermi radius \f$ a = 0.88534\, a_0 Z^{-1/3} \f$. The
+ * \f$ Z^2 \f$ part from the nucleus is additionally suppressed by the square
+ * of the exponential nuclear form factor
+ * \f$ F = (1 + c (1 - \mu))^{-2} \f$, with \f$ c = (p R / \hbar c)^2 / 6 \f$
+ * for the nuclear radius \f$ R = 1.27 A^{0.27} \f$ fm (0.84 fm for
+ * hydrogen).
+ *
+ * \f$ 2A \f$ and \f$ c \f$ are tabulated for each element at every point of
+ * the energy grid.
+ */
+class WentzelParams
+{
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
+    //! Input data to construct this class
+    struct Input
+    {
+        UniformGrid::Params log_energy; //!< Electron energy grid [ln MeV]
+    };
+
+  public:
+    // Construct from the elements in the problem
+    WentzelParams(const MaterialParams& materials, const Input& inp);
+
+    // Screening parameter 2A for an electron
+    static real_type screening(const ElementView& element, MevEnergy energy);
+
+    // Nuclear form factor coefficient for an electron
+    static real_type form_factor(const ElementView& element, MevEnergy energy);
+
+    // Access tables on the host
+    WentzelParamsPointers host_pointers() const;
+
+    // Access tables on the device
+    WentzelParamsPointers device_pointers() const;
+
+  private:
+    UniformGrid::Params    log_energy_;
+    std::vector<real_type> host_atomic_number_;
+    std::vector<real_type> host_screening_;
+    std::vector<real_type> host_form_factor_;
+
+    DeviceVector<real_type> device_atomic_number_;
+    DeviceVector<real_type> device_screening_;
+    DeviceVector<real_type> device_form_factor_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
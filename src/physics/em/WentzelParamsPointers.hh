@@ -0,0 +1,67 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file WentzelParamsPointers.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Assert.hh"
+#include "base/Macros.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "base/UniformGrid.hh"
+#include "physics/material/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Screening and nuclear size parameters for Wentzel scattering, all elements.
+ *
+ * The parameters are stored for an electron at every point of a uniform grid
+ * in \f$ \ln(T / \mathrm{MeV}) \f$, indexed as [element][energy]. A particle
+ * of mass \f$ m \f$ and kinetic energy \f$ T \f$ has the same speed as an
+ * electron of kinetic energy \f$ T m_e / m \f$, and its momentum is larger
+ * by \f$ m / m_e \f$, so the electron tables apply to any charged particle
+ * after scaling:
+ * - the screening parameter \f$ A \propto 1/p^2 \f$, and
+ * - the nuclear form factor coefficient \f$ \propto p^2 \f$.
+ *
+ * \sa WentzelParams (owns the pointed-to data)
+ * \sa detail::WentzelTableView (interpolates the data for a particle)
+ */
+struct WentzelParamsPointers
+{
+    UniformGrid::Params   log_energy; //!< Electron energy grid [ln MeV]
+    real_type             electron_mass = 0; //!< Table mass [MeV/c^2]
+    Span<const real_type> atomic_number;     //!< Z [element]
+    Span<const real_type> screening;   //!< Screening parameter 2A
+    Span<const real_type> form_factor; //!< Nuclear size coefficient
+
+    //! Check whether the interface is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return log_energy && electron_mass > 0 && !atomic_number.empty()
+               && screening.size() == atomic_number.size() * log_energy.size
+               && form_factor.size() == screening.size();
+    }
+
+    //! Number of elements
+    CELER_FUNCTION size_type num_elements() const
+    {
+        return atomic_number.size();
+    }
+
+    //! Index of the table row of an element at an energy grid point
+    CELER_FUNCTION size_type row(ElementDefId el, size_type energy_idx) const
+    {
+        REQUIRE(el < this->num_elements());
+        REQUIRE(energy_idx < log_energy.size);
+        return el.get() * log_energy.size + energy_idx;
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,60 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BremRelTableView.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "../BremRelParamsPointers.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Evaluate and sample the running integral of one bremsstrahlung table row.
+ *
+ * The integrand is taken to be constant in each bin of the \f$ \ln x \f$
+ * grid, so the integral is linear in \f$ \ln x \f$ within a bin. Sampling
+ * above a cut chooses between the partial bin containing the cut and the
+ * full bins above it; a full bin is chosen with the alias table that starts
+ * at it, so the cost is independent of the row length.
+ */
+class BremRelTableView
+{
+  public:
+    // Construct from tables and a row index
+    inline CELER_FUNCTION
+    BremRelTableView(const BremRelParamsPointers& data, size_type row);
+
+    // Running integral at the given energy fraction [cm^2]
+    inline CELER_FUNCTION real_type integral(real_type log_x) const;
+
+    // Sample the energy fraction above the given cut
+    template<class Engine>
+    inline CELER_FUNCTION real_type sample(real_type log_x_cut,
+                                           Engine&   rng) const;
+
+    //! Integral over the full spectrum above x_min [cm^2]
+    CELER_FUNCTION real_type total() const { return cdf_[size_ - 1]; }
+
+  private:
+    const BremRelParamsPointers& data_;
+    size_type                    alias_begin_;
+    const real_type*             cdf_;
+    real_type                    dxs_min_;
+    size_type                    size_;
+    real_type                    log_x_min_;
+    real_type                    delta_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
+
+#include "BremRelTableView.i.hh"
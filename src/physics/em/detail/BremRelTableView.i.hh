@@ -0,0 +1,104 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BremRelTableView.i.hh
+//---------------------------------------------------------------------------//
+
+#include "base/Assert.hh"
+#include "random/distributions/AliasDistribution.hh"
+#include "random/distributions/BernoulliDistribution.hh"
+#include "random/distributions/GenerateCanonical.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from tables and a row index.
+ */
+CELER_FUNCTION
+BremRelTableView::BremRelTableView(const BremRelParamsPointers& data,
+                                   size_type                    row)
+    : data_(data)
+    , alias_begin_(row * data.alias_size())
+    , cdf_(data.cdf.data() + row * data.log_x.size)
+    , dxs_min_(data.dxs_min[row])
+    , size_(data.log_x.size)
+    , log_x_min_(data.log_x.front)
+    , delta_(data.log_x.delta)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Running integral at the given energy fraction [cm^2].
+ *
+ * The result is negative below the grid and saturates at \f$ x = 1 \f$.
+ */
+CELER_FUNCTION real_type BremRelTableView::integral(real_type log_x) const
+{
+    const real_type u = (log_x - log_x_min_) / delta_;
+    if (u <= 0)
+    {
+        return dxs_min_ * (log_x - log_x_min_);
+    }
+    if (u >= size_ - 1)
+    {
+        return this->total();
+    }
+    const size_type bin  = static_cast<size_type>(u);
+    const real_type frac = u - bin;
+    return (1 - frac) * cdf_[bin] + frac * cdf_[bin + 1];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the energy fraction \f$ \ln x \f$ above the given cut.
+ *
+ * The region between the cut and the next grid point (or \f$ x_\mathrm{min}
+ * \f$ if the cut is below the grid) is chosen with probability proportional
+ * to its integral, and sampled uniformly in \f$ \ln x \f$. Otherwise one of
+ * the full bins above it is chosen from its alias table and sampled uniformly.
+ * If the row has no cross section above the cut, the cut is returned.
+ */
+template<class Engine>
+CELER_FUNCTION real_type BremRelTableView::sample(real_type log_x_cut,
+                                                  Engine&   rng) const
+{
+    REQUIRE(log_x_cut < 0);
+    const real_type lower = this->integral(log_x_cut);
+    if (!(lower < this->total()))
+    {
+        return log_x_cut;
+    }
+
+    // First grid point above the cut
+    size_type bin = 0;
+    if (log_x_cut >= log_x_min_)
+    {
+        bin = static_cast<size_type>((log_x_cut - log_x_min_) / delta_) + 1;
+        bin = bin < size_ ? bin : size_ - 1;
+    }
+
+    BernoulliDistribution in_partial_bin(cdf_[bin] - lower,
+                                         this->total() - cdf_[bin]);
+    if (in_partial_bin(rng))
+    {
+        const real_type edge = log_x_min_ + bin * delta_;
+        return log_x_cut + generate_canonical(rng) * (edge - log_x_cut);
+    }
+
+    const size_type   offset = alias_begin_ + data_.alias_offset(bin);
+    const size_type   size   = size_ - 1 - bin;
+    AliasDistribution sample_bin(data_.alias_prob.subspan(offset, size),
+                                 data_.alias_idx.subspan(offset, size));
+    const size_type   full_bin = bin + sample_bin(rng);
+    return log_x_min_ + (full_bin + generate_canonical(rng)) * delta_;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -44,8 +44,8 @@ template<class Engine>
 CELER_FUNCTION Interaction EPlusGGInteractor::operator()(Engine& rng)
 {
     // Allocate space for two gammas
-    Secondary* secondaries = this->allocate_(2);
-    if (secondaries == nullptr)
+    SecondaryRecord* records = this->allocate_(2);
+    if (records == nullptr)
     {
         // Failed to allocate space for two secondaries
         return Interaction::from_failure();
@@ -53,9 +53,10 @@ CELER_FUNCTION Interaction EPlusGGInteractor::operator()(Engine& rng)
 
     // Construct an interaction with an absorbed process
     Interaction result = Interaction::from_absorption();
-    result.secondaries = {secondaries, 2};
+    result.secondaries = {records, 2};
 
     // Sample two gammas
+    Secondary secondaries[2];
     secondaries[0].def_id = secondaries[1].def_id = shared_.gamma_id;
 
     if (inc_energy_ == 0)
@@ -118,6 +119,8 @@ CELER_FUNCTION Interaction EPlusGGInteractor::operator()(Engine& rng)
         normalize_direction(&secondaries[1].direction);
     }
 
+    records[0] = SecondaryRecord(secondaries[0]);
+    records[1] = SecondaryRecord(secondaries[1]);
     return result;
 }
 
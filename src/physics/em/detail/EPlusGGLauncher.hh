@@ -0,0 +1,42 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EPlusGGLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "physics/base/Interaction.hh"
+#include "EPlusGG.hh"
+#include "EPlusGGInteractor.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the positron annihilation interactor from a ModelDispatcher.
+ */
+struct EPlusGGLauncher
+{
+    EPlusGGPointers data;
+
+    //! ID of the model
+    CELER_FUNCTION ModelId model_id() const { return data.model_id; }
+
+    //! Sample an interaction for the given track
+    template<class Track, class Engine>
+    CELER_FUNCTION Interaction operator()(Track& track, Engine& rng) const
+    {
+        EPlusGGInteractor interact(
+            data, track.particle, track.direction, track.allocate);
+        return interact(rng);
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
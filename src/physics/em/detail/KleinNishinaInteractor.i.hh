@@ -46,8 +46,8 @@ template<class Engine>
 CELER_FUNCTION Interaction KleinNishinaInteractor::operator()(Engine& rng)
 {
     // Allocate space for the single electron to be emitted
-    Secondary* electron_secondary = this->allocate_(1);
-    if (electron_secondary == nullptr)
+    SecondaryRecord* electron_record = this->allocate_(1);
+    if (electron_record == nullptr)
     {
         // Failed to allocate space for a secondary
         return Interaction::from_failure();
@@ -101,7 +101,7 @@ CELER_FUNCTION Interaction KleinNishinaInteractor::operator()(Engine& rng)
     result.action      = Action::scattered;
     result.energy      = units::MevEnergy{epsilon * inc_energy_.value()};
     result.direction   = inc_direction_;
-    result.secondaries = {electron_secondary, 1};
+    result.secondaries = {electron_record, 1};
 
     // Sample azimuthal direction and rotate the outgoing direction
     UniformRealDistribution<real_type> sample_phi(0, 2 * constants::pi);
@@ -110,18 +110,20 @@ CELER_FUNCTION Interaction KleinNishinaInteractor::operator()(Engine& rng)
                  result.direction);
 
     // Outgoing secondary is an electron
-    electron_secondary->def_id = shared_.electron_id;
+    Secondary electron_secondary;
+    electron_secondary.def_id = shared_.electron_id;
     // Construct secondary energy by neglecting electron binding energy
-    electron_secondary->energy
+    electron_secondary.energy
         = units::MevEnergy{inc_energy_.value() - result.energy.value()};
     // Calculate exiting electron direction via conservation of momentum
     for (int i = 0; i < 3; ++i)
     {
-        electron_secondary->direction[i]
+        electron_secondary.direction[i]
             = inc_direction_[i] * inc_energy_.value()
               - result.direction[i] * result.energy.value();
     }
-    normalize_direction(&electron_secondary->direction);
+    normalize_direction(&electron_secondary.direction);
+    *electron_record = SecondaryRecord(electron_secondary);
 
     // Cutoff for secondary production happens *after* the interaction
     // code.
@@ -0,0 +1,42 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file KleinNishinaLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "physics/base/Interaction.hh"
+#include "KleinNishina.hh"
+#include "KleinNishinaInteractor.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the Klein-Nishina interactor from a ModelDispatcher.
+ */
+struct KleinNishinaLauncher
+{
+    KleinNishinaPointers data;
+
+    //! ID of the model
+    CELER_FUNCTION ModelId model_id() const { return data.model_id; }
+
+    //! Sample an interaction for the given track
+    template<class Track, class Engine>
+    CELER_FUNCTION Interaction operator()(Track& track, Engine& rng) const
+    {
+        KleinNishinaInteractor interact(
+            data, track.particle, track.direction, track.allocate);
+        return interact(rng);
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,62 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file WentzelTableView.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "../WentzelParamsPointers.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate the Wentzel screening tables for a charged particle.
+ *
+ * The energy grid point and interpolation fraction are found once, from the
+ * electron-equivalent kinetic energy of the particle, and shared by all
+ * elements. Values are interpolated linearly in the logarithm of the value
+ * and the energy, extrapolating the nearest interval outside the grid, and
+ * scaled by the particle mass.
+ */
+class WentzelTableView
+{
+  public:
+    // Construct from tables and the incident particle
+    inline CELER_FUNCTION WentzelTableView(const WentzelParamsPointers& data,
+                                           const ParticleTrackView& particle);
+
+    // Screening parameter 2A of an element
+    inline CELER_FUNCTION real_type screening(ElementDefId el) const;
+
+    // Nuclear form factor coefficient of an element
+    inline CELER_FUNCTION real_type form_factor(ElementDefId el) const;
+
+    //! Atomic number of an element
+    CELER_FUNCTION real_type atomic_number(ElementDefId el) const
+    {
+        return data_.atomic_number[el.get()];
+    }
+
+  private:
+    const WentzelParamsPointers& data_;
+    size_type                    energy_idx_;
+    real_type                    frac_;
+    real_type                    mass_ratio_sq_;
+
+    inline CELER_FUNCTION real_type interpolate(Span<const real_type> values,
+                                                ElementDefId el) const;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
+
+#include "WentzelTableView.i.hh"
@@ -0,0 +1,87 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file WentzelTableView.i.hh
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include "base/Assert.hh"
+#include "base/UniformGrid.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from tables and the incident particle.
+ */
+CELER_FUNCTION
+WentzelTableView::WentzelTableView(const WentzelParamsPointers& data,
+                                   const ParticleTrackView&     particle)
+    : data_(data)
+{
+    REQUIRE(data_);
+    REQUIRE(particle.energy().value() > 0);
+
+    // Electron kinetic energy with the same speed as the particle
+    const real_type mass_ratio = particle.mass().value() / data_.electron_mass;
+    mass_ratio_sq_             = mass_ratio * mass_ratio;
+
+    const UniformGrid loge_grid(data_.log_energy);
+    const real_type   loge = std::log(particle.energy().value() / mass_ratio);
+    if (loge <= loge_grid.front())
+    {
+        energy_idx_ = 0;
+    }
+    else if (loge >= loge_grid.back())
+    {
+        energy_idx_ = loge_grid.size() - 2;
+    }
+    else
+    {
+        energy_idx_ = loge_grid.find(loge);
+    }
+    frac_ = (loge - loge_grid[energy_idx_]) / data_.log_energy.delta;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Screening parameter 2A of an element.
+ *
+ * The screening angle is inversely proportional to the momentum.
+ */
+CELER_FUNCTION real_type WentzelTableView::screening(ElementDefId el) const
+{
+    return this->interpolate(data_.screening, el) / mass_ratio_sq_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Nuclear form factor coefficient of an element.
+ *
+ * The coefficient is proportional to the square of the momentum.
+ */
+CELER_FUNCTION real_type WentzelTableView::form_factor(ElementDefId el) const
+{
+    return this->interpolate(data_.form_factor, el) * mass_ratio_sq_;
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate a table row at the particle's energy.
+ */
+CELER_FUNCTION real_type WentzelTableView::interpolate(
+    Span<const real_type> values, ElementDefId el) const
+{
+    const real_type* v = values.data() + data_.row(el, energy_idx_);
+    return v[0] * std::pow(v[1] / v[0], frac_);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
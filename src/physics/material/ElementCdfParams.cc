@@ -0,0 +1,129 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ElementCdfParams.cc
+//---------------------------------------------------------------------------//
+#include "ElementCdfParams.hh"
+
+#include <cmath>
+#include "base/Range.hh"
+#include "comm/Device.hh"
+#include "ElementSelector.hh"
+#include "MaterialView.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct by tabulating the given cross sections for every material.
+ *
+ * Where a material's cross section vanishes (e.g. below threshold), the
+ * elements are weighted by their abundance alone so that every row is a valid
+ * distribution. Materials without elements have empty tables.
+ */
+ElementCdfParams::ElementCdfParams(const MaterialParams& materials,
+                                   const Input&          inp)
+    : log_energy_(inp.log_energy)
+{
+    REQUIRE(inp.log_energy);
+    REQUIRE(inp.micro_xs);
+
+    const MaterialParamsPointers mat_ptrs = materials.host_pointers();
+    const UniformGrid            loge_grid(log_energy_);
+
+    std::vector<real_type> storage(materials.max_element_components());
+    host_offsets_.reserve(mat_ptrs.materials.size() + 1);
+    host_offsets_.push_back(0);
+    host_micro_xs_.reserve(mat_ptrs.materials.size() * loge_grid.size());
+
+    for (auto mat_idx : range(mat_ptrs.materials.size()))
+    {
+        const MaterialView material(mat_ptrs, MaterialDefId(mat_idx));
+        const auto&        elements = material.elements();
+
+        for (auto i : range(loge_grid.size()))
+        {
+            if (elements.empty())
+            {
+                host_micro_xs_.push_back(0);
+                continue;
+            }
+
+            const MevEnergy energy{std::exp(loge_grid[i])};
+            ElementSelector select_element(
+                material,
+                [&inp, energy](ElementDefId el) {
+                    return inp.micro_xs(el, energy);
+                },
+                make_span(storage));
+            const real_type mat_xs   = select_element.material_micro_xs();
+            const auto      micro_xs = select_element.elemental_micro_xs();
+            host_micro_xs_.push_back(mat_xs);
+
+            // Accumulate the normalized weight of each element
+            real_type accum = 0;
+            for (auto el_idx : range(elements.size()))
+            {
+                const real_type weight = mat_xs > 0 ? micro_xs[el_idx] / mat_xs
+                                                    : 1;
+                accum += elements[el_idx].fraction * weight;
+                host_cdf_.push_back(accum);
+            }
+            // Avoid roundoff in the final bin
+            host_cdf_.back() = 1;
+        }
+        host_offsets_.push_back(host_cdf_.size());
+    }
+
+    if (celeritas::is_device_enabled())
+    {
+        device_offsets_ = DeviceVector<size_type>(host_offsets_.size());
+        device_offsets_.copy_to_device(make_span(host_offsets_));
+        device_cdf_ = DeviceVector<real_type>(host_cdf_.size());
+        device_cdf_.copy_to_device(make_span(host_cdf_));
+        device_micro_xs_ = DeviceVector<real_type>(host_micro_xs_.size());
+        device_micro_xs_.copy_to_device(make_span(host_micro_xs_));
+    }
+
+    ENSURE(host_offsets_.size() == mat_ptrs.materials.size() + 1);
+    ENSURE(host_micro_xs_.size()
+           == mat_ptrs.materials.size() * loge_grid.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access tables on the host.
+ */
+ElementCdfParamsPointers ElementCdfParams::host_pointers() const
+{
+    ElementCdfParamsPointers result;
+    result.log_energy = log_energy_;
+    result.offsets    = make_span(host_offsets_);
+    result.cdf        = make_span(host_cdf_);
+    result.micro_xs   = make_span(host_micro_xs_);
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access tables on the device.
+ */
+ElementCdfParamsPointers ElementCdfParams::device_pointers() const
+{
+    REQUIRE(!device_offsets_.empty());
+    ElementCdfParamsPointers result;
+    result.log_energy = log_energy_;
+    result.offsets    = device_offsets_.device_pointers();
+    result.cdf        = device_cdf_.device_pointers();
+    result.micro_xs   = device_micro_xs_.device_pointers();
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
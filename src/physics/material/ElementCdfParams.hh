@@ -0,0 +1,74 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ElementCdfParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <functional>
+#include <vector>
+#include "base/DeviceVector.hh"
+#include "base/Types.hh"
+#include "base/UniformGrid.hh"
+#include "physics/base/Units.hh"
+#include "ElementCdfParamsPointers.hh"
+#include "MaterialParams.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Precomputed element-selection tables for a single model.
+ *
+ * At each grid energy, an \c ElementSelector is constructed for every
+ * material with the model's microscopic cross section calculator, and the
+ * resulting cumulative element weights are stored. During transport an \c
+ * ElementCdfSelector then replaces the per-element cross section evaluation
+ * with one grid lookup, an interpolation and a short search.
+ *
+ * The \c micro_xs input wraps the same calculators that are given to \c
+ * ElementSelector, with the energy that they would otherwise take from the
+ * track's \c ParticleTrackView made explicit.
+ */
+class ElementCdfParams
+{
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy   = units::MevEnergy;
+    using MicroXsCalc = std::function<real_type(ElementDefId, MevEnergy)>;
+    //!@}
+
+    //! Input data to construct this class
+    struct Input
+    {
+        UniformGrid::Params log_energy; //!< Energy grid [ln MeV]
+        MicroXsCalc         micro_xs;   //!< Element cross section
+    };
+
+  public:
+    // Construct by tabulating the given cross sections for every material
+    ElementCdfParams(const MaterialParams& materials, const Input& inp);
+
+    // Access tables on the host
+    ElementCdfParamsPointers host_pointers() const;
+
+    // Access tables on the device
+    ElementCdfParamsPointers device_pointers() const;
+
+  private:
+    UniformGrid::Params    log_energy_;
+    std::vector<size_type> host_offsets_;
+    std::vector<real_type> host_cdf_;
+    std::vector<real_type> host_micro_xs_;
+
+    DeviceVector<size_type> device_offsets_;
+    DeviceVector<real_type> device_cdf_;
+    DeviceVector<real_type> device_micro_xs_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,51 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ElementCdfParamsPointers.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "base/UniformGrid.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulated element-selection probabilities for one model, all materials.
+ *
+ * For each material, the cumulative cross-section-weighted element fractions
+ * are stored at every point of a uniform grid in \f$ \ln(E / \mathrm{MeV})
+ * \f$: \c cdf is indexed as [material][energy][element] with the start of
+ * each material's block given by \c offsets. The abundance-weighted
+ * microscopic cross section of the material is stored alongside as
+ * [material][energy].
+ *
+ * \sa ElementCdfParams (owns the pointed-to data)
+ * \sa ElementCdfSelector (samples from the tables in a kernel)
+ */
+struct ElementCdfParamsPointers
+{
+    UniformGrid::Params   log_energy; //!< Energy grid [ln MeV]
+    Span<const size_type> offsets;    //!< Start of each table [material + 1]
+    Span<const real_type> cdf;        //!< Cumulative fractions
+    Span<const real_type> micro_xs;   //!< Material micro xs [material][energy]
+
+    //! Check whether the interface is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return log_energy && offsets.size() >= 2;
+    }
+
+    //! Number of materials
+    CELER_FUNCTION size_type num_materials() const
+    {
+        return offsets.size() - 1;
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,63 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ElementCdfSelector.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/base/Units.hh"
+#include "ElementCdfParamsPointers.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Select an element from precomputed cumulative distributions.
+ *
+ * This is a drop-in replacement for \c ElementSelector when the model's
+ * element-selection tables have been built by \c ElementCdfParams. The
+ * distribution at the given energy is linearly interpolated in log energy
+ * between the two bracketing grid points; energies outside the grid use the
+ * nearest row.
+ *
+ * \code
+    ElementCdfSelector select_element(tables, mat_id, particle.energy());
+    ElementComponentId id = select_element(rng);
+   \endcode
+ */
+class ElementCdfSelector
+{
+  public:
+    // Construct with tables, material, and energy
+    inline CELER_FUNCTION
+    ElementCdfSelector(const ElementCdfParamsPointers& data,
+                       MaterialDefId                   material,
+                       units::MevEnergy                energy);
+
+    // Sample with the given RNG
+    template<class Engine>
+    inline CELER_FUNCTION ElementComponentId operator()(Engine& rng) const;
+
+    // Interpolated weighted material microscopic cross section
+    inline CELER_FUNCTION real_type material_micro_xs() const;
+
+    //! Number of elements to select from
+    CELER_FUNCTION size_type num_elements() const { return num_elements_; }
+
+  private:
+    const real_type* lower_; // Distribution at the lower grid point
+    const real_type* upper_; // Distribution at the upper grid point
+    real_type        frac_;  // Interpolation fraction in log energy
+    size_type        num_elements_;
+    real_type        micro_xs_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "ElementCdfSelector.i.hh"
@@ -0,0 +1,95 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ElementCdfSelector.i.hh
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include "base/Assert.hh"
+#include "random/distributions/GenerateCanonical.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with tables, material, and energy.
+ */
+CELER_FUNCTION
+ElementCdfSelector::ElementCdfSelector(const ElementCdfParamsPointers& data,
+                                       MaterialDefId                   material,
+                                       units::MevEnergy                energy)
+{
+    REQUIRE(data);
+    REQUIRE(material < data.num_materials());
+    REQUIRE(energy.value() > 0);
+
+    const UniformGrid loge_grid(data.log_energy);
+    const size_type   table_begin = data.offsets[material.get()];
+    num_elements_ = (data.offsets[material.get() + 1] - table_begin)
+                    / loge_grid.size();
+    REQUIRE(num_elements_ > 0);
+
+    // Find the bracketing grid points, clamping to the grid bounds
+    const real_type loge = std::log(energy.value());
+    size_type       bin;
+    if (loge <= loge_grid.front())
+    {
+        bin   = 0;
+        frac_ = 0;
+    }
+    else if (loge >= loge_grid.back())
+    {
+        bin   = loge_grid.size() - 2;
+        frac_ = 1;
+    }
+    else
+    {
+        bin   = loge_grid.find(loge);
+        frac_ = (loge - loge_grid[bin]) / data.log_energy.delta;
+    }
+
+    lower_ = data.cdf.data() + table_begin + bin * num_elements_;
+    upper_ = lower_ + num_elements_;
+
+    const real_type* xs = data.micro_xs.data()
+                          + material.get() * loge_grid.size() + bin;
+    micro_xs_ = (1 - frac_) * xs[0] + frac_ * xs[1];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the element with the given RNG.
+ *
+ * The last element is selected without a comparison, so single-element
+ * materials don't draw a random number.
+ */
+template<class Engine>
+CELER_FUNCTION ElementComponentId
+ElementCdfSelector::operator()(Engine& rng) const
+{
+    size_type i = 0;
+    if (num_elements_ > 1)
+    {
+        const real_type xi = generate_canonical(rng);
+        for (size_type imax = num_elements_ - 1; i != imax; ++i)
+        {
+            if (xi < (1 - frac_) * lower_[i] + frac_ * upper_[i])
+                break;
+        }
+    }
+    return ElementComponentId(i);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolated weighted material microscopic cross section.
+ */
+CELER_FUNCTION real_type ElementCdfSelector::material_micro_xs() const
+{
+    return micro_xs_;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
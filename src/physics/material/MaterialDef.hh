@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "base/Array.hh"
 #include "base/Span.hh"
 #include "base/Types.hh"
 #include "physics/base/Units.hh"
@@ -27,6 +28,30 @@ struct MatElementComponent
     real_type    fraction; //!< Fraction of number density
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Sternheimer parameters for the density effect correction to energy loss.
+ *
+ * The correction as a function of \f$ x = \log_{10}(\beta\gamma) \f$ is
+ * \f[
+   \delta(x) = \begin{cases}
+   2 \ln 10 \, x - \bar{C} & x \ge x_1 \\
+   2 \ln 10 \, x - \bar{C} + a (x_1 - x)^m & x_0 \le x < x_1 \\
+   0 & x < x_0
+   \end{cases}
+ * \f]
+ * for insulators (R. M. Sternheimer and R. F. Peierls, Phys. Rev. B 3, 3681
+ * (1971)).
+ */
+struct MatDensityEffect
+{
+    real_type cbar = 0; //!< 1 + 2 ln(I / plasma energy)
+    real_type x0   = 0; //!< Lower limit of log10(beta gamma)
+    real_type x1   = 0; //!< Upper limit of log10(beta gamma)
+    real_type a    = 0; //!< Coefficient of the intermediate range term
+    real_type m    = 0; //!< Exponent of the intermediate range term
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Fundamental (static) properties of a material.
@@ -48,6 +73,13 @@ struct MaterialDef
     real_type density;          //!< Density [g/cm^3]
     real_type electron_density; //!< Electron number density [1/cm^3]
     real_type rad_length;       //!< Radiation length [cm]
+
+    // IONIZATION PROPERTIES (zero for vacuum)
+
+    units::MevEnergy    mean_exc_energy;     //!< Mean excitation energy I
+    real_type           log_mean_exc_energy; //!< ln(I / MeV)
+    MatDensityEffect    density_effect;      //!< Sternheimer parameters
+    Array<real_type, 3> shell_correction;    //!< Shell correction terms
 };
 
 //---------------------------------------------------------------------------//
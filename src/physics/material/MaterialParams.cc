@@ -40,47 +40,45 @@ MaterialParams::MaterialParams(const Input& inp) : max_el_(0)
     host_materials_.reserve(inp.materials.size());
     elnames_.reserve(inp.elements.size());
     matnames_.reserve(inp.materials.size());
+    input_to_element_.reserve(inp.elements.size());
+    input_to_material_.reserve(inp.materials.size());
 
-    // Build elements and materials on host.
+    // Build elements and materials on host, merging duplicates
     for (const auto& el : inp.elements)
     {
-        this->append_element_def(el);
+        input_to_element_.push_back(this->insert_element_def(el));
     }
     for (const auto& mat : inp.materials)
     {
-        this->append_material_def(mat);
+        input_to_material_.push_back(this->insert_material_def(mat));
     }
 
-    if (celeritas::is_device_enabled())
+    if (host_elements_.size() != inp.elements.size()
+        || host_materials_.size() != inp.materials.size())
     {
-        // Allocate device vectors
-        device_elements_ = DeviceVector<ElementDef>{host_elements_.size()};
-        device_elcomponents_
-            = DeviceVector<MatElementComponent>{host_elcomponents_.size()};
-        device_materials_ = DeviceVector<MaterialDef>{host_materials_.size()};
-
-        // Remap material->elcomponent spans
-        auto remap_elements
-            = make_span_remapper(make_span(host_elcomponents_),
-                                 device_elcomponents_.device_pointers());
-
-        std::vector<MaterialDef> temp_device_mats = host_materials_;
-        for (MaterialDef& m : temp_device_mats)
-        {
-            m.elements = remap_elements(m.elements);
-        }
+        CELER_LOG(info) << "Merged identical definitions: "
+                        << host_elements_.size() << " of "
+                        << inp.elements.size() << " elements and "
+                        << host_materials_.size() << " of "
+                        << inp.materials.size() << " materials are unique";
+    }
 
-        // Copy vectors to device
-        device_elements_.copy_to_device(make_span(host_elements_));
-        device_elcomponents_.copy_to_device(make_span(host_elcomponents_));
-        device_materials_.copy_to_device(make_span(temp_device_mats));
+    if (celeritas::is_device_enabled())
+    {
+        // Upload all data in a single copy
+        ParamsImage image = this->make_image();
+        device_image_     = image.copy_to_device();
+        device_ptrs_      = image.root<MaterialParamsPointers>(
+            device_image_.device_pointers().data());
     }
 
-    ENSURE(host_elements_.size() == inp.elements.size());
+    ENSURE(host_elements_.size() <= inp.elements.size());
     ENSURE(host_elcomponents_.size() <= host_elcomponents_.capacity());
-    ENSURE(host_materials_.size() == inp.materials.size());
-    ENSURE(elnames_.size() == inp.elements.size());
-    ENSURE(matnames_.size() == inp.materials.size());
+    ENSURE(host_materials_.size() <= inp.materials.size());
+    ENSURE(elnames_.size() == host_elements_.size());
+    ENSURE(matnames_.size() == host_materials_.size());
+    ENSURE(input_to_element_.size() == inp.elements.size());
+    ENSURE(input_to_material_.size() == inp.materials.size());
 }
 
 //---------------------------------------------------------------------------//
@@ -104,12 +102,49 @@ MaterialParamsPointers MaterialParams::host_pointers() const
  */
 MaterialParamsPointers MaterialParams::device_pointers() const
 {
-    MaterialParamsPointers result;
-    result.elements               = device_elements_.device_pointers();
-    result.materials              = device_materials_.device_pointers();
-    result.max_element_components = this->max_element_components();
+    ENSURE(device_ptrs_);
+    return device_ptrs_;
+}
 
-    ENSURE(result);
+//---------------------------------------------------------------------------//
+/*!
+ * Pack element and material data into a relocatable image.
+ *
+ * The root of the image is a \c MaterialParamsPointers whose spans, as well
+ * as the element component spans of each material, are registered as
+ * relocations.
+ */
+ParamsImage MaterialParams::make_image() const
+{
+    ParamsImage result(
+        ParamsImage::padded_size<MaterialParamsPointers>(1)
+        + ParamsImage::padded_size<ElementDef>(host_elements_.size())
+        + ParamsImage::padded_size<MatElementComponent>(
+            host_elcomponents_.size())
+        + ParamsImage::padded_size<MaterialDef>(host_materials_.size()));
+
+    MaterialParamsPointers& root
+        = result.allocate<MaterialParamsPointers>(1).front();
+    auto elements     = result.insert(make_span(host_elements_));
+    auto elcomponents = result.insert(make_span(host_elcomponents_));
+    auto materials    = result.insert(make_span(host_materials_));
+
+    // Remap material->elcomponent spans into the image
+    auto remap_elements
+        = make_span_remapper(make_span(host_elcomponents_), elcomponents);
+    for (MaterialDef& m : materials)
+    {
+        m.elements = remap_elements(m.elements);
+        result.add_relocation(m.elements);
+    }
+
+    root.elements               = elements;
+    root.materials              = materials;
+    root.max_element_components = this->max_element_components();
+    result.add_relocation(root.elements);
+    result.add_relocation(root.materials);
+
+    ENSURE(result.size() == result.capacity());
     return result;
 }
 
@@ -120,9 +155,12 @@ MaterialParamsPointers MaterialParams::device_pointers() const
  * Convert an element input to an element definition and store.
  *
  * This adds computed quantities in addition to the input values. The result
- * is pushed back onto the host list of stored elements.
+ * is pushed back onto the host list of stored elements unless an element
+ * with the same atomic number and mass already exists, in which case the
+ * input name becomes an alias of the existing element. The ID of the stored
+ * element is returned.
  */
-void MaterialParams::append_element_def(const ElementInput& inp)
+ElementDefId MaterialParams::insert_element_def(const ElementInput& inp)
 {
     REQUIRE(inp.atomic_number > 0);
     REQUIRE(inp.atomic_mass > zero_quantity());
@@ -142,18 +180,47 @@ void MaterialParams::append_element_def(const ElementInput& inp)
         = detail::calc_coulomb_correction(result.atomic_number);
     result.mass_radiation_coeff = detail::calc_mass_rad_coeff(result);
 
-    elnames_.push_back(inp.name);
+    // Reuse an identical element
+    ElementDefId id;
+    for (auto i : range(host_elements_.size()))
+    {
+        const ElementDef& other = host_elements_[i];
+        if (other.atomic_number == result.atomic_number
+            && soft_equal(other.atomic_mass.value(),
+                          result.atomic_mass.value()))
+        {
+            id = ElementDefId(i);
+            break;
+        }
+    }
+    if (!id)
+    {
+        // Add to host vector
+        id = ElementDefId(host_elements_.size());
+        host_elements_.push_back(result);
+        elnames_.push_back(inp.name);
+    }
+
+    auto iter_inserted = elname_to_id_.insert({inp.name, id});
+    if (!iter_inserted.second && iter_inserted.first->second != id)
+    {
+        // Insertion failed, so element name is a duplicate
+        CELER_LOG(warning)
+            << "Element " << inp.name << " already exists with id "
+            << iter_inserted.first->second.get() << ". This new id ("
+            << id.get() << ") will not be available.";
+    }
 
-    // Add to host vector
-    host_elements_.push_back(result);
+    return id;
 }
 
 //---------------------------------------------------------------------------//
 /*!
  * Process and store element components to the internal list.
  *
- * \todo It's the caller's responsibility to ensure that element IDs
- * aren't duplicated.
+ * Input element IDs are mapped to the stored elements, and components that
+ * refer to the same element (directly or through an identical element) are
+ * combined.
  */
 Span<MatElementComponent>
 MaterialParams::extend_elcomponents(const MaterialInput& inp)
@@ -171,10 +238,11 @@ MaterialParams::extend_elcomponents(const MaterialInput& inp)
     real_type norm = 0.0;
     for (auto i : range(inp.elements_fractions.size()))
     {
-        REQUIRE(inp.elements_fractions[i].first < host_elements_.size());
+        REQUIRE(inp.elements_fractions[i].first < input_to_element_.size());
         REQUIRE(inp.elements_fractions[i].second >= 0);
         // Store number fraction
-        result[i].element  = inp.elements_fractions[i].first;
+        result[i].element
+            = input_to_element_[inp.elements_fractions[i].first.get()];
         result[i].fraction = inp.elements_fractions[i].second;
         // Add fractions to verify unity
         norm += inp.elements_fractions[i].second;
@@ -206,29 +274,39 @@ MaterialParams::extend_elcomponents(const MaterialInput& inp)
             return lhs.element < rhs.element;
         });
 
+    // Combine components of the same element
+    size_type num_unique = 0;
+    for (auto i : range(result.size()))
+    {
+        if (num_unique > 0
+            && result[num_unique - 1].element == result[i].element)
+        {
+            result[num_unique - 1].fraction += result[i].fraction;
+        }
+        else
+        {
+            result[num_unique++] = result[i];
+        }
+    }
+    host_elcomponents_.resize(start_size + num_unique);
+    result = {host_elcomponents_.data() + start_size, num_unique};
+
     return result;
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Convert an material input to an material definition and store.
+ * Convert a material input to a material definition and store.
+ *
+ * If an identical material was already stored, the new element components are
+ * discarded and the input name becomes an alias of the existing material.
+ * The ID of the stored material is returned.
  */
-void MaterialParams::append_material_def(const MaterialInput& inp)
+MaterialDefId MaterialParams::insert_material_def(const MaterialInput& inp)
 {
     REQUIRE(inp.number_density >= 0);
     REQUIRE((inp.number_density == 0) == inp.elements_fractions.empty());
 
-    auto iter_inserted = matname_to_id_.insert(
-        {inp.name, MaterialDefId(host_materials_.size())});
-    if (!iter_inserted.second)
-    {
-        // Insertion failed, so material name is a duplicate
-        CELER_LOG(warning)
-            << "Material " << inp.name << " already exists with id "
-            << iter_inserted.second << ". This new id ("
-            << host_materials_.size() << ") will not be available.";
-    }
-
     MaterialDef result;
     // Copy basic properties
     result.number_density = inp.number_density;
@@ -244,6 +322,7 @@ void MaterialParams::append_material_def(const MaterialInput& inp)
     real_type avg_amu_mass = 0;
     real_type avg_z        = 0;
     real_type rad_coeff    = 0;
+    real_type log_mean_exc = 0;
     for (const MatElementComponent& comp : result.elements)
     {
         CHECK(comp.element < host_elements_.size());
@@ -252,24 +331,104 @@ void MaterialParams::append_material_def(const MaterialInput& inp)
         avg_amu_mass += comp.fraction * el.atomic_mass.value();
         avg_z += comp.fraction * el.atomic_number;
         rad_coeff += comp.fraction * el.mass_radiation_coeff;
+        log_mean_exc
+            += comp.fraction * el.atomic_number
+               * std::log(
+                   detail::get_mean_exc_energy(el.atomic_number).value());
     }
     result.density = result.number_density * avg_amu_mass
                      * constants::atomic_mass;
     result.electron_density = result.number_density * avg_z;
     result.rad_length       = 1 / (rad_coeff * result.density);
 
-    // Add to host vector
-    host_materials_.push_back(result);
-    matnames_.push_back(inp.name);
-
-    // Update maximum number of materials
-    max_el_ = std::max(max_el_, result.elements.size());
+    /*!
+     * Calculate ionization properties for energy loss. The mean excitation
+     * energy uses the Bragg additivity rule (weighted by electron fraction).
+     */
+    result.mean_exc_energy     = zero_quantity();
+    result.log_mean_exc_energy = 0;
+    result.shell_correction    = {0, 0, 0};
+    if (avg_z > 0)
+    {
+        result.log_mean_exc_energy = log_mean_exc / avg_z;
+        result.mean_exc_energy
+            = units::MevEnergy{std::exp(result.log_mean_exc_energy)};
+        result.density_effect = detail::calc_density_effect(
+            result.mean_exc_energy,
+            detail::calc_plasma_energy(result.electron_density),
+            result.matter_state);
+        result.shell_correction
+            = detail::calc_shell_correction(result.mean_exc_energy);
+    }
 
     ENSURE(result.number_density >= 0);
     ENSURE(result.temperature >= 0);
     ENSURE((result.density > 0) == (inp.number_density > 0));
     ENSURE((result.electron_density > 0) == (inp.number_density > 0));
     ENSURE(result.rad_length > 0);
+
+    MaterialDefId id = this->find_duplicate(result);
+    if (id)
+    {
+        // Release the element components, which were appended last
+        host_elcomponents_.resize(host_elcomponents_.size()
+                                  - result.elements.size());
+    }
+    else
+    {
+        // Add to host vector
+        id = MaterialDefId(host_materials_.size());
+        host_materials_.push_back(result);
+        matnames_.push_back(inp.name);
+
+        // Update maximum number of materials
+        max_el_ = std::max(max_el_, result.elements.size());
+    }
+
+    auto iter_inserted = matname_to_id_.insert({inp.name, id});
+    if (!iter_inserted.second && iter_inserted.first->second != id)
+    {
+        // Insertion failed, so material name is a duplicate
+        CELER_LOG(warning)
+            << "Material " << inp.name << " already exists with id "
+            << iter_inserted.first->second.get() << ". This new id ("
+            << id.get() << ") will not be available.";
+    }
+
+    return id;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find a stored material that is physically identical to the given one.
+ */
+MaterialDefId MaterialParams::find_duplicate(const MaterialDef& mat) const
+{
+    auto same_components = [](Span<const MatElementComponent> lhs,
+                              Span<const MatElementComponent> rhs) {
+        if (lhs.size() != rhs.size())
+            return false;
+        for (auto i : range(lhs.size()))
+        {
+            if (lhs[i].element != rhs[i].element
+                || !soft_equal(lhs[i].fraction, rhs[i].fraction))
+                return false;
+        }
+        return true;
+    };
+
+    for (auto i : range(host_materials_.size()))
+    {
+        const MaterialDef& other = host_materials_[i];
+        if (other.matter_state == mat.matter_state
+            && soft_equal(other.number_density, mat.number_density)
+            && soft_equal(other.temperature, mat.temperature)
+            && same_components(other.elements, mat.elements))
+        {
+            return MaterialDefId(i);
+        }
+    }
+    return {};
 }
 
 //---------------------------------------------------------------------------//
@@ -11,7 +11,8 @@
 #include <string>
 #include <unordered_map>
 #include <vector>
-#include "base/DeviceVector.hh"
+#include "base/DeviceAllocation.hh"
+#include "base/ParamsImage.hh"
 #include "base/Types.hh"
 #include "physics/base/Units.hh"
 #include "ElementDef.hh"
@@ -24,6 +25,16 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Data management for material, element, and nuclide properties.
+ *
+ * Imported geometries often define the same element or material several
+ * times under different names (e.g. a copy per volume). Physically identical
+ * elements (same atomic number and mass) and materials (same state,
+ * temperature, density, and composition) are stored only once, so that data
+ * tables keyed on the element or material ID are not duplicated. Every input
+ * name remains available to \c find (materials) and \c find_element, while
+ * \c id_to_label returns the name of the first definition. The
+ * \c canonical_id accessors map the index of an input element or material to
+ * its stored ID.
  */
 class MaterialParams
 {
@@ -64,16 +75,39 @@ class MaterialParams
     // Get material name
     inline const std::string& id_to_label(MaterialDefId id) const;
 
-    // Find a material from a name
-    // TODO: Map different MaterialDefIds with same material name
+    // Find a material from a name or alias
     inline MaterialDefId find(const std::string& name) const;
 
+    // Find an element from a name or alias
+    inline ElementDefId find_element(const std::string& name) const;
+
+    // Get the stored ID of an element from its index in the input
+    inline ElementDefId canonical_id(ElementDefId input_id) const;
+
+    // Get the stored ID of a material from its index in the input
+    inline MaterialDefId canonical_id(MaterialDefId input_id) const;
+
+    //! Number of unique elements
+    ElementDefId::value_type num_elements() const
+    {
+        return host_elements_.size();
+    }
+
+    //! Number of unique materials
+    MaterialDefId::value_type num_materials() const
+    {
+        return host_materials_.size();
+    }
+
     // Access material properties on the host
     MaterialParamsPointers host_pointers() const;
 
     // Access material properties on the device
     MaterialParamsPointers device_pointers() const;
 
+    // Pack element and material data into a relocatable image
+    ParamsImage make_image() const;
+
     //! Maximum number of elements in any one material
     size_type max_element_components() const { return max_el_; }
 
@@ -82,19 +116,22 @@ class MaterialParams
     std::vector<MatElementComponent> host_elcomponents_;
     std::vector<MaterialDef>         host_materials_;
 
-    DeviceVector<ElementDef>          device_elements_;
-    DeviceVector<MatElementComponent> device_elcomponents_;
-    DeviceVector<MaterialDef>         device_materials_;
+    DeviceAllocation       device_image_;
+    MaterialParamsPointers device_ptrs_;
 
     std::vector<std::string>                       elnames_;
     std::vector<std::string>                       matnames_;
+    std::unordered_map<std::string, ElementDefId>  elname_to_id_;
     std::unordered_map<std::string, MaterialDefId> matname_to_id_;
+    std::vector<ElementDefId>                      input_to_element_;
+    std::vector<MaterialDefId>                     input_to_material_;
     size_type                                      max_el_;
 
     // HELPER FUNCTIONS
-    void                      append_element_def(const ElementInput& inp);
+    ElementDefId              insert_element_def(const ElementInput& inp);
     Span<MatElementComponent> extend_elcomponents(const MaterialInput& inp);
-    void                      append_material_def(const MaterialInput& inp);
+    MaterialDefId             insert_material_def(const MaterialInput& inp);
+    MaterialDefId             find_duplicate(const MaterialDef& mat) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -32,8 +32,8 @@ const std::string& MaterialParams::id_to_label(MaterialDefId mat) const
 /*!
  * Find the material ID corresponding to a name.
  *
- * This function will have to be updated to allow for multiple MaterialDefIds
- * with same material name.
+ * The name of any input material is accepted, including those that were
+ * merged into an identical material with a different name.
  */
 MaterialDefId MaterialParams::find(const std::string& name) const
 {
@@ -43,5 +43,39 @@ MaterialDefId MaterialParams::find(const std::string& name) const
     return iter->second;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Find the element ID corresponding to a name.
+ *
+ * The name of any input element is accepted, including those that were
+ * merged into an identical element with a different name.
+ */
+ElementDefId MaterialParams::find_element(const std::string& name) const
+{
+    auto iter = elname_to_id_.find(name);
+    if (iter == elname_to_id_.end())
+        return {};
+    return iter->second;
+}
+
+/*!
+ * Get the stored ID of an element from its index in the input.
+ */
+ElementDefId MaterialParams::canonical_id(ElementDefId input_id) const
+{
+    REQUIRE(input_id < input_to_element_.size());
+    return input_to_element_[input_id.get()];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the stored ID of a material from its index in the input.
+ */
+MaterialDefId MaterialParams::canonical_id(MaterialDefId input_id) const
+{
+    REQUIRE(input_id < input_to_material_.size());
+    return input_to_material_[input_id.get()];
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
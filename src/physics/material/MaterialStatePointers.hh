@@ -14,13 +14,33 @@
 
 namespace celeritas
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Data required to initialize the material state of a track.
+ *
+ * The density scale allows a single material definition (and its physics
+ * tables) to be used at several densities, e.g. a gas at different pressures
+ * in different volumes.
+ */
+struct MaterialTrackInitializer
+{
+    MaterialDefId def_id;            //!< Current material being tracked
+    real_type     density_scale = 1; //!< Density relative to the definition
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Dynamic material state of a particle track.
+ *
+ * The logarithm of the density scale is stored when the state is initialized
+ * (see \c MaterialTrackView ) so that density-dependent quantities need no
+ * transcendental functions at lookup time.
  */
 struct MaterialTrackState
 {
-    MaterialDefId def_id; //!< Current material being tracked
+    MaterialDefId def_id;                //!< Current material being tracked
+    real_type     density_scale     = 1; //!< Density relative to definition
+    real_type     log_density_scale = 0; //!< Natural log of density scale
 };
 
 //---------------------------------------------------------------------------//
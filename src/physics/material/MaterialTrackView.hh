@@ -27,6 +27,12 @@ namespace celeritas
  * calculations prove to be hot spots we will experiment with cacheing some of
  * the variables.
  *
+ * The track's material may be at a multiple of the defined density (see
+ * \c MaterialTrackState ). The material view returned here applies the
+ * density scale, and data tabulated per material in units of inverse length
+ * (e.g. macroscopic cross sections) should be multiplied by
+ * \c density_scale() .
+ *
  * The element scratch space is "thread-private" data with a fixed size
  * *greater than or equal to* the number of elemental components in the current
  * material.
@@ -36,7 +42,7 @@ class MaterialTrackView
   public:
     //!@{
     //! Type aliases
-    using Initializer_t = MaterialTrackState;
+    using Initializer_t = MaterialTrackInitializer;
     //!@}
 
   public:
@@ -55,6 +61,9 @@ class MaterialTrackView
     // Current material identifier
     inline CELER_FUNCTION MaterialDefId def_id() const;
 
+    // Density relative to the current material definition
+    inline CELER_FUNCTION real_type density_scale() const;
+
     //// STATIC PROPERTIES ////
 
     // Get a view to material properties
@@ -34,7 +34,11 @@ CELER_FUNCTION MaterialTrackView&
 MaterialTrackView::operator=(const Initializer_t& other)
 {
     REQUIRE(other.def_id < params_.materials.size());
-    this->state() = other;
+    REQUIRE(other.density_scale > 0);
+    MaterialTrackState& state = this->state();
+    state.def_id              = other.def_id;
+    state.density_scale       = other.density_scale;
+    state.log_density_scale   = std::log(other.density_scale);
     return *this;
 }
 
@@ -49,11 +53,20 @@ CELER_FORCEINLINE_FUNCTION MaterialDefId MaterialTrackView::def_id() const
 
 //---------------------------------------------------------------------------//
 /*!
- * Get material properties for the current material.
+ * Density relative to the current material definition.
+ */
+CELER_FORCEINLINE_FUNCTION real_type MaterialTrackView::density_scale() const
+{
+    return this->state().density_scale;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get material properties for the current material at the current density.
  */
 CELER_FORCEINLINE_FUNCTION MaterialView MaterialTrackView::material_view() const
 {
-    return MaterialView(params_, this->def_id());
+    return MaterialView(params_, this->state());
 }
 
 //---------------------------------------------------------------------------//
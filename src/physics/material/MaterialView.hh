@@ -9,8 +9,10 @@
 
 #include "base/Macros.hh"
 #include "base/Types.hh"
+#include "physics/base/Units.hh"
 #include "ElementView.hh"
 #include "MaterialParamsPointers.hh"
+#include "MaterialStatePointers.hh"
 #include "Types.hh"
 
 namespace celeritas
@@ -26,6 +28,14 @@ namespace celeritas
  * The \c get_element_density and \c element_view helper functions can be used
  * to calculate elemental densities and properties.
  *
+ * A material can be viewed at a multiple of its defined density. The number,
+ * mass, and electron densities (and therefore any macroscopic cross section
+ * calculated from them) are multiplied by the density scale, and the radiation
+ * length is divided by it. This is exact for all quantities that are linear in
+ * the density. Composition, temperature, and microscopic quantities are
+ * unaffected. The density effect parameters are shifted to account for the
+ * change in plasma energy.
+ *
  * \note The material -> nuclide mapping will be implemented when we add
  * hadronic physics. A separate NuclideComponentId and NuclideView will operate
  * analogously to the element access.
@@ -37,6 +47,10 @@ class MaterialView
     inline CELER_FUNCTION
     MaterialView(const MaterialParamsPointers& params, MaterialDefId id);
 
+    // Construct from params and the material state of a track
+    inline CELER_FUNCTION MaterialView(const MaterialParamsPointers& params,
+                                       const MaterialTrackState&     state);
+
     //// MATERIAL DATA ////
 
     // Number density [1/cm^3]
@@ -48,6 +62,9 @@ class MaterialView
     // Material state
     inline CELER_FUNCTION MatterState matter_state() const;
 
+    //! Density relative to the material definition
+    CELER_FUNCTION real_type density_scale() const { return density_scale_; }
+
     //// ELEMENT ACCESS ////
 
     // Number of elemental components
@@ -75,9 +92,25 @@ class MaterialView
     // Radiation length for high-energy electron Bremsstrahlung [cm]
     inline CELER_FUNCTION real_type radiation_length() const;
 
+    //// IONIZATION DATA ////
+
+    // Mean excitation energy [MeV]
+    inline CELER_FUNCTION units::MevEnergy mean_exc_energy() const;
+
+    // Log of the mean excitation energy in MeV
+    inline CELER_FUNCTION real_type log_mean_exc_energy() const;
+
+    // Sternheimer density effect parameters at the scaled density
+    inline CELER_FUNCTION MatDensityEffect density_effect() const;
+
+    // Shell correction coefficients
+    inline CELER_FUNCTION const Array<real_type, 3>& shell_correction() const;
+
   private:
     const MaterialParamsPointers& params_;
     MaterialDefId                 id_;
+    real_type                     density_scale_;
+    real_type                     log_density_scale_;
 
     // HELPER FUNCTIONS
 
@@ -15,18 +15,34 @@ namespace celeritas
 CELER_FUNCTION
 MaterialView::MaterialView(const MaterialParamsPointers& params,
                            MaterialDefId                 id)
-    : params_(params), id_(id)
+    : params_(params), id_(id), density_scale_(1), log_density_scale_(0)
 {
     REQUIRE(id < params.materials.size());
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct at the (possibly scaled) density of a track's material.
+ */
+CELER_FUNCTION
+MaterialView::MaterialView(const MaterialParamsPointers& params,
+                           const MaterialTrackState&     state)
+    : params_(params)
+    , id_(state.def_id)
+    , density_scale_(state.density_scale)
+    , log_density_scale_(state.log_density_scale)
+{
+    REQUIRE(id_ < params.materials.size());
+    REQUIRE(density_scale_ > 0);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get atomic number density [1/cm^3].
  */
 CELER_FUNCTION real_type MaterialView::number_density() const
 {
-    return this->material_def().number_density;
+    return density_scale_ * this->material_def().number_density;
 }
 
 //---------------------------------------------------------------------------//
@@ -94,7 +110,7 @@ CELER_FUNCTION const Span<const MatElementComponent>&
  */
 CELER_FUNCTION real_type MaterialView::density() const
 {
-    return this->material_def().density;
+    return density_scale_ * this->material_def().density;
 }
 
 //---------------------------------------------------------------------------//
@@ -103,7 +119,7 @@ CELER_FUNCTION real_type MaterialView::density() const
  */
 CELER_FUNCTION real_type MaterialView::electron_density() const
 {
-    return this->material_def().electron_density;
+    return density_scale_ * this->material_def().electron_density;
 }
 
 //---------------------------------------------------------------------------//
@@ -112,7 +128,60 @@ CELER_FUNCTION real_type MaterialView::electron_density() const
  */
 CELER_FUNCTION real_type MaterialView::radiation_length() const
 {
-    return this->material_def().rad_length;
+    return this->material_def().rad_length / density_scale_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Mean excitation energy [MeV].
+ */
+CELER_FUNCTION units::MevEnergy MaterialView::mean_exc_energy() const
+{
+    return this->material_def().mean_exc_energy;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Natural log of the mean excitation energy in MeV.
+ */
+CELER_FUNCTION real_type MaterialView::log_mean_exc_energy() const
+{
+    return this->material_def().log_mean_exc_energy;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sternheimer density effect parameters.
+ *
+ * Since the plasma energy is proportional to the square root of the electron
+ * density, scaling the density by \f$ s \f$ shifts \f$ \bar{C} \f$ by
+ * \f$ -\ln s \f$ and the limits \f$ x_0, x_1 \f$ by \f$ -\ln s / (2 \ln
+ * 10) \f$. The logarithm of the scale is stored in the track state, so no
+ * transcendental functions are evaluated here.
+ */
+CELER_FUNCTION MatDensityEffect MaterialView::density_effect() const
+{
+    MatDensityEffect result = this->material_def().density_effect;
+    if (log_density_scale_ != 0 && result.cbar != 0)
+    {
+        // 1 / (2 ln 10)
+        constexpr real_type inv_two_ln10 = 0.217147240951625862;
+
+        const real_type x_shift = log_density_scale_ * inv_two_ln10;
+        result.cbar -= log_density_scale_;
+        result.x0 -= x_shift;
+        result.x1 -= x_shift;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Shell correction coefficients of successive powers of (beta gamma)^-2.
+ */
+CELER_FUNCTION const Array<real_type, 3>& MaterialView::shell_correction() const
+{
+    return this->material_def().shell_correction;
 }
 
 //---------------------------------------------------------------------------//
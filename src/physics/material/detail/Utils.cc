@@ -14,6 +14,7 @@
 #include "base/Range.hh"
 #include "base/Quantity.hh"
 #include "physics/material/ElementDef.hh"
+#include "physics/material/MaterialDef.hh"
 
 namespace celeritas
 {
@@ -106,6 +107,143 @@ real_type calc_mass_rad_coeff(const ElementDef& el)
               + z_real * lrad_prime);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the mean excitation energy of an element.
+ *
+ * Values through Z=98 are the recommended ICRU Report 37 values, as tabulated
+ * by NIST and used by Geant4 for elemental materials. Heavier elements use
+ * the approximation \f$ I \approx (10 \mathrm{eV}) Z \f$.
+ */
+units::MevEnergy get_mean_exc_energy(int atomic_number)
+{
+    REQUIRE(atomic_number > 0);
+
+    // clang-format off
+    static const real_type mean_exc_energy_ev[] = {
+        19.2, 41.8, 40.0, 63.7, 76.0, 81.0, 82.0, 95.0, 115.0, 137.0,
+        149.0, 156.0, 166.0, 173.0, 173.0, 180.0, 174.0, 188.0, 190.0, 191.0,
+        216.0, 233.0, 245.0, 257.0, 272.0, 286.0, 297.0, 311.0, 322.0, 330.0,
+        334.0, 350.0, 347.0, 348.0, 343.0, 352.0, 363.0, 366.0, 379.0, 393.0,
+        417.0, 424.0, 428.0, 441.0, 449.0, 470.0, 470.0, 469.0, 488.0, 488.0,
+        487.0, 485.0, 491.0, 482.0, 488.0, 491.0, 501.0, 523.0, 535.0, 546.0,
+        560.0, 574.0, 580.0, 591.0, 614.0, 628.0, 650.0, 658.0, 674.0, 684.0,
+        694.0, 705.0, 718.0, 727.0, 736.0, 746.0, 757.0, 790.0, 790.0, 800.0,
+        810.0, 823.0, 823.0, 830.0, 825.0, 794.0, 827.0, 826.0, 841.0, 847.0,
+        878.0, 890.0, 902.0, 921.0, 934.0, 939.0, 952.0, 966.0};
+    // clang-format on
+    constexpr int max_z = sizeof(mean_exc_energy_ev) / sizeof(real_type);
+
+    real_type result_ev = atomic_number <= max_z
+                              ? mean_exc_energy_ev[atomic_number - 1]
+                              : 10 * atomic_number;
+    return units::MevEnergy{1e-6 * result_ev};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the plasma energy of a material from its electron density.
+ *
+ * This is \f$ \hbar \omega_p = \hbar c \sqrt{4 \pi n_e r_e} \f$.
+ */
+units::MevEnergy calc_plasma_energy(real_type electron_density)
+{
+    REQUIRE(electron_density >= 0);
+    using constants::c_light;
+    using constants::hbar_planck;
+    using constants::pi;
+    using constants::re_electron;
+
+    constexpr real_type hbar_c = hbar_planck * c_light / units::Mev::value();
+    return units::MevEnergy{
+        hbar_c * std::sqrt(4 * pi * electron_density * re_electron)};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the Sternheimer density effect parameters of an insulator.
+ *
+ * This is the general parameterization of Sternheimer and Peierls (Phys. Rev.
+ * B 3, 3681 (1971)) in terms of the mean excitation energy, plasma energy, and
+ * state of matter, as implemented in Geant4's G4IonisParamMat for materials
+ * without tabulated coefficients. The correction of the parameters for gases
+ * away from standard temperature and pressure is not applied.
+ */
+MatDensityEffect calc_density_effect(units::MevEnergy mean_exc_energy,
+                                     units::MevEnergy plasma_energy,
+                                     MatterState      matter_state)
+{
+    REQUIRE(mean_exc_energy > zero_quantity());
+    REQUIRE(plasma_energy > zero_quantity());
+
+    MatDensityEffect result;
+    result.cbar
+        = 1 + 2 * std::log(mean_exc_energy.value() / plasma_energy.value());
+    result.m = 3;
+
+    if (matter_state == MatterState::solid
+        || matter_state == MatterState::liquid)
+    {
+        // Condensed materials
+        const bool      low_i    = mean_exc_energy.value() < 100e-6;
+        const real_type c_limit  = low_i ? 3.681 : 5.215;
+        const real_type x0_shift = low_i ? 1.0 : 1.5;
+
+        result.x0 = result.cbar < c_limit ? 0.2
+                                          : 0.326 * result.cbar - x0_shift;
+        result.x1 = low_i ? 2.0 : 3.0;
+    }
+    else
+    {
+        // Gases
+        static const real_type c_limit[]
+            = {10., 10.5, 11., 11.5, 12.25, 13.804};
+        static const real_type x0_val[] = {1.6, 1.7, 1.8, 1.9, 2.0, 2.0};
+        static const real_type x1_val[] = {4.0, 4.0, 4.0, 4.0, 4.0, 5.0};
+
+        result.x0 = 0.326 * result.cbar - 2.5;
+        result.x1 = 5.0;
+        for (auto i : range(std::end(c_limit) - std::begin(c_limit)))
+        {
+            if (result.cbar < c_limit[i])
+            {
+                result.x0 = x0_val[i];
+                result.x1 = x1_val[i];
+                break;
+            }
+        }
+    }
+
+    const real_type two_ln10 = 2 * std::log(10.0);
+    result.a = (result.cbar - two_ln10 * result.x0)
+               / ipow<3>(result.x1 - result.x0);
+
+    ENSURE(result.x1 > result.x0);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the shell correction coefficients for a material.
+ *
+ * These are the coefficients of successive powers of \f$ (\beta\gamma)^{-2}
+ * \f$ in the shell correction to the Bethe formula, parameterized in terms
+ * of the mean excitation energy as in Geant4's G4IonisParamMat.
+ */
+Array<real_type, 3> calc_shell_correction(units::MevEnergy mean_exc_energy)
+{
+    REQUIRE(mean_exc_energy > zero_quantity());
+
+    const real_type rate  = 1e3 * mean_exc_energy.value(); // I in keV
+    const real_type rate2 = rate * rate;
+
+    Array<real_type, 3> result;
+    result[0] = (0.422377 + 3.858019 * rate) * rate2;
+    result[1] = (0.0304043 - 0.1667989 * rate) * rate2;
+    result[2] = (-0.00038106 + 0.00157955 * rate) * rate2;
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
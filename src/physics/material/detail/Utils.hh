@@ -7,17 +7,27 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "base/Array.hh"
 #include "base/Types.hh"
+#include "physics/base/Units.hh"
+#include "physics/material/Types.hh"
 
 namespace celeritas
 {
 struct ElementDef;
+struct MatDensityEffect;
 
 namespace detail
 {
 //---------------------------------------------------------------------------//
 real_type calc_coulomb_correction(int atomic_number);
 real_type calc_mass_rad_coeff(const ElementDef& el);
+units::MevEnergy get_mean_exc_energy(int atomic_number);
+units::MevEnergy calc_plasma_energy(real_type electron_density);
+MatDensityEffect calc_density_effect(units::MevEnergy mean_exc_energy,
+                                     units::MevEnergy plasma_energy,
+                                     MatterState      matter_state);
+Array<real_type, 3> calc_shell_correction(units::MevEnergy mean_exc_energy);
 
 //---------------------------------------------------------------------------//
 } // namespace detail
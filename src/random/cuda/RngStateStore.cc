@@ -27,20 +27,7 @@ RngStateStore::RngStateStore(size_type size, unsigned long host_seed)
     REQUIRE(celeritas::is_device_enabled());
     REQUIRE(size > 0);
 
-    // Host-side RNG for seeding device RNG
-    using seed_type = RngSeed::value_type;
-    std::mt19937                             host_rng(host_seed);
-    std::uniform_int_distribution<seed_type> sample_uniform_int;
-
-    // Create seeds on host
-    std::vector<seed_type> host_seeds(size);
-    for (auto& seed : host_seeds)
-        seed = sample_uniform_int(host_rng);
-
-    DeviceVector<seed_type> device_seeds(size);
-    device_seeds.copy_to_device(make_span(host_seeds));
-    detail::rng_state_init_device(this->device_pointers(),
-                                  device_seeds.device_pointers());
+    rng_state_init(this->device_pointers(), host_seed);
 }
 
 //---------------------------------------------------------------------------//
@@ -57,5 +44,34 @@ RngStatePointers RngStateStore::device_pointers()
     return result;
 }
 
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Seed on-device RNG states from a host seed.
+ *
+ * A host-side generator creates one seed per state, which are copied to the
+ * device and used to initialize the device RNG states.
+ */
+void rng_state_init(const RngStatePointers& device_ptrs,
+                    unsigned long           host_seed)
+{
+    REQUIRE(device_ptrs);
+
+    // Host-side RNG for seeding device RNG
+    using seed_type = RngSeed::value_type;
+    std::mt19937                             host_rng(host_seed);
+    std::uniform_int_distribution<seed_type> sample_uniform_int;
+
+    // Create seeds on host
+    std::vector<seed_type> host_seeds(device_ptrs.rng.size());
+    for (auto& seed : host_seeds)
+        seed = sample_uniform_int(host_rng);
+
+    DeviceVector<seed_type> device_seeds(host_seeds.size());
+    device_seeds.copy_to_device(make_span(host_seeds));
+    detail::rng_state_init_device(device_ptrs, device_seeds.device_pointers());
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
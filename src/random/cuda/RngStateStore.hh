@@ -37,5 +37,10 @@ class RngStateStore
     DeviceVector<RngState> data_;
 };
 
+//---------------------------------------------------------------------------//
+// Seed on-device RNG states from a host seed
+void rng_state_init(const RngStatePointers& device_ptrs,
+                    unsigned long           host_seed);
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -0,0 +1,53 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AliasDistribution.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sample an index from a discrete distribution in constant time.
+ *
+ * Walker's alias method picks a uniformly random index \em i and keeps it
+ * with probability \c prob[i], otherwise returning \c alias[i]. The tables
+ * are constructed on the host with \c build_alias_table .
+ * \code
+    AliasDistribution sample_bin(prob, alias);
+    size_type bin = sample_bin(rng);
+   \endcode
+ */
+class AliasDistribution
+{
+  public:
+    //!@{
+    //! Type aliases
+    using result_type = size_type;
+    //!@}
+
+  public:
+    // Construct from acceptance probabilities and aliases
+    inline CELER_FUNCTION AliasDistribution(Span<const real_type> prob,
+                                            Span<const size_type> alias);
+
+    // Sample an index
+    template<class Generator>
+    inline CELER_FUNCTION result_type operator()(Generator& rng) const;
+
+  private:
+    Span<const real_type> prob_;
+    Span<const size_type> alias_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "AliasDistribution.i.hh"
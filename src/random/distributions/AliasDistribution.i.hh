@@ -0,0 +1,44 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AliasDistribution.i.hh
+//---------------------------------------------------------------------------//
+
+#include "base/Algorithms.hh"
+#include "base/Assert.hh"
+#include "GenerateCanonical.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from acceptance probabilities and aliases.
+ */
+CELER_FUNCTION
+AliasDistribution::AliasDistribution(Span<const real_type> prob,
+                                     Span<const size_type> alias)
+    : prob_(prob), alias_(alias)
+{
+    REQUIRE(!prob_.empty());
+    REQUIRE(prob_.size() == alias_.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample an index.
+ */
+template<class Generator>
+CELER_FUNCTION auto AliasDistribution::operator()(Generator& rng) const
+    -> result_type
+{
+    const size_type size = prob_.size();
+    const size_type i    = min(
+        static_cast<size_type>(generate_canonical<real_type>(rng) * size),
+        size - 1);
+    return generate_canonical<real_type>(rng) < prob_[i] ? i : alias_[i];
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,75 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AliasTable.cc
+//---------------------------------------------------------------------------//
+#include "AliasTable.hh"
+
+#include <vector>
+#include "base/Assert.hh"
+#include "base/Range.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Build the tables of an AliasDistribution from unnormalized weights.
+ *
+ * This is Vose's construction: indices whose scaled weight is below the mean
+ * are paired with an index above the mean, which donates the remainder of
+ * the slot and becomes the alias. The result is exact up to roundoff.
+ */
+void build_alias_table(Span<const real_type> weights,
+                       Span<real_type>       prob,
+                       Span<size_type>       alias)
+{
+    REQUIRE(!weights.empty());
+    REQUIRE(prob.size() == weights.size() && alias.size() == weights.size());
+
+    real_type total = 0;
+    for (real_type w : weights)
+    {
+        REQUIRE(w >= 0);
+        total += w;
+    }
+    REQUIRE(total > 0);
+
+    const size_type        size = weights.size();
+    std::vector<size_type> small;
+    std::vector<size_type> large;
+    for (auto i : range(size))
+    {
+        prob[i]  = weights[i] * size / total;
+        alias[i] = i;
+        (prob[i] < 1 ? small : large).push_back(i);
+    }
+
+    while (!small.empty() && !large.empty())
+    {
+        const size_type lo = small.back();
+        const size_type hi = large.back();
+        small.pop_back();
+        alias[lo] = hi;
+        prob[hi] -= 1 - prob[lo];
+        if (prob[hi] < 1)
+        {
+            large.pop_back();
+            small.push_back(hi);
+        }
+    }
+
+    // Remaining slots are full up to roundoff
+    for (size_type i : small)
+    {
+        prob[i] = 1;
+    }
+    for (size_type i : large)
+    {
+        prob[i] = 1;
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,22 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AliasTable.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Span.hh"
+#include "base/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// Build the tables of an AliasDistribution from unnormalized weights
+void build_alias_table(Span<const real_type> weights,
+                       Span<real_type>       prob,
+                       Span<size_type>       alias);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
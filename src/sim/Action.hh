@@ -28,6 +28,8 @@ enum class Action
     begin_killed_,
     absorbed = begin_killed_, //!< Absorbed (killed)
     cutoff_energy,            //!< Below energy cutoff (killed)
+    cutoff_time,              //!< Outside the time window (killed)
+    cutoff_region,            //!< Inside a kill region (killed)
     escaped,                  //!< Exited geometry (killed)
     end_killed_
 };
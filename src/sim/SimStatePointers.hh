@@ -20,10 +20,11 @@ namespace celeritas
  */
 struct SimTrackState
 {
-    TrackId track_id;      //!< Unique ID for this track
-    TrackId parent_id;     //!< ID of parent that created it
-    EventId event_id;      //!< ID of originating event
-    bool    alive = false; //!< Whether this track is alive
+    TrackId   track_id;      //!< Unique ID for this track
+    TrackId   parent_id;     //!< ID of parent that created it
+    EventId   event_id;      //!< ID of originating event
+    bool      alive = false; //!< Whether this track is alive
+    real_type time  = 0;     //!< Time since the start of the event [s]
 };
 
 //---------------------------------------------------------------------------//
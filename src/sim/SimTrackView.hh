@@ -9,6 +9,7 @@
 
 #include "base/Macros.hh"
 #include "base/Types.hh"
+#include "physics/base/Units.hh"
 #include "SimStatePointers.hh"
 
 namespace celeritas
@@ -17,7 +18,9 @@ namespace celeritas
 /*!
  * Simulation properties for a single track.
  *
- * Manage the simulation state.
+ * Manage the simulation state. The track's time is not updated by the
+ * physics: whatever moves the track must advance it with \c advance_time so
+ * that time-based tracking cuts can be applied.
  */
 class SimTrackView
 {
@@ -39,17 +42,23 @@ class SimTrackView
 
     //!@{
     //! State accessors
-    CELER_FUNCTION TrackId track_id() const { return state_.track_id; }
-    CELER_FUNCTION TrackId parent_id() const { return state_.parent_id; }
-    CELER_FUNCTION EventId event_id() const { return state_.event_id; }
-    CELER_FUNCTION bool    alive() const { return state_.alive; }
+    CELER_FUNCTION TrackId   track_id() const { return state_.track_id; }
+    CELER_FUNCTION TrackId   parent_id() const { return state_.parent_id; }
+    CELER_FUNCTION EventId   event_id() const { return state_.event_id; }
+    CELER_FUNCTION bool      alive() const { return state_.alive; }
+    CELER_FUNCTION real_type time() const { return state_.time; }
     //!@}
 
     //!@{
     //! State modifiers via non-const references
-    CELER_FUNCTION bool& alive() { return state_.alive; }
+    CELER_FUNCTION bool&      alive() { return state_.alive; }
+    CELER_FUNCTION real_type& time() { return state_.time; }
     //!@}
 
+    // Advance the time over a step [cm] at the given speed
+    inline CELER_FUNCTION void
+    advance_time(real_type step, units::LightSpeed speed);
+
   private:
     SimTrackState& state_;
 };
@@ -29,5 +29,20 @@ CELER_FUNCTION SimTrackView& SimTrackView::operator=(const Initializer_t& other)
     return *this;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Advance the time over a step [cm] at the given speed.
+ *
+ * The speed should be that of the particle over the step, e.g. the pre-step
+ * speed for a step with small energy loss.
+ */
+CELER_FUNCTION void
+SimTrackView::advance_time(real_type step, units::LightSpeed speed)
+{
+    REQUIRE(step >= 0);
+    REQUIRE(speed.value() > 0);
+    state_.time += step / unit_cast(speed);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
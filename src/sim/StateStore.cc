@@ -8,20 +8,72 @@
 #include "StateStore.hh"
 
 #include "base/Assert.hh"
+#include "base/Memory.hh"
+#include "comm/Device.hh"
+#include "geometry/GeoParams.hh"
+#include "random/cuda/RngStateStore.hh"
+#include "detail/SimStateInit.hh"
 
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Construct with the track state storage objects.
+ * Construct with the track state input.
+ *
+ * With an arena, all segments are reserved before the single allocation,
+ * after which the simulation and RNG states are initialized in place.
  */
 StateStore::StateStore(const Input& inp)
-    : particle_states_(ParticleStateStore(inp.num_tracks))
-    , geo_states_(GeoStateStore(*inp.geo, inp.num_tracks))
-    , sim_states_(SimStateStore(inp.num_tracks))
-    , rng_states_(RngStateStore(inp.num_tracks, inp.host_seed))
-    , interactions_(this->size())
+    : num_tracks_(inp.num_tracks)
+    , max_secondaries_(inp.max_secondaries)
+    , max_depth_(inp.geo->max_depth())
 {
+    REQUIRE(celeritas::is_device_enabled());
+    REQUIRE(inp.num_tracks > 0);
+
+    if (!inp.use_arena)
+    {
+        components_.reset(new ComponentStores{
+            ParticleStateStore(num_tracks_),
+            GeoStateStore(*inp.geo, num_tracks_),
+            SimStateStore(num_tracks_),
+            RngStateStore(num_tracks_, inp.host_seed),
+            DeviceVector<Interaction>(num_tracks_)});
+        if (max_secondaries_ > 0)
+        {
+            secondary_store_ = SecondaryAllocatorStore(max_secondaries_);
+        }
+        return;
+    }
+
+    vgstate_ = detail::VGNavStateStore(num_tracks_, max_depth_);
+    vgnext_  = detail::VGNavStateStore(num_tracks_, max_depth_);
+
+    particle_     = arena_.reserve<ParticleTrackState>("particle", num_tracks_);
+    pos_          = arena_.reserve<Real3>("geo.pos", num_tracks_);
+    dir_          = arena_.reserve<Real3>("geo.dir", num_tracks_);
+    next_step_    = arena_.reserve<real_type>("geo.next_step", num_tracks_);
+    sim_          = arena_.reserve<SimTrackState>("sim", num_tracks_);
+    rng_          = arena_.reserve<RngState>("rng", num_tracks_);
+    interactions_ = arena_.reserve<Interaction>("interactions", num_tracks_);
+    if (max_secondaries_ > 0)
+    {
+        secondaries_ = arena_.reserve<SecondaryRecord>("secondaries",
+                                                       max_secondaries_);
+        secondary_size_
+            = arena_.reserve<SecondarySize>("secondaries.size", 1);
+    }
+    arena_.allocate();
+
+    StatePointers ptrs = this->device_pointers();
+    detail::sim_state_init_device(ptrs.sim);
+    rng_state_init(ptrs.rng, inp.host_seed);
+    if (max_secondaries_ > 0)
+    {
+        this->clear_secondaries();
+    }
+
+    ENSURE(this->uses_arena());
 }
 
 //---------------------------------------------------------------------------//
@@ -31,14 +83,109 @@ StateStore::StateStore(const Input& inp)
 StatePointers StateStore::device_pointers()
 {
     StatePointers result;
-    result.particle     = particle_states_.device_pointers();
-    result.geo          = geo_states_.device_pointers();
-    result.sim          = sim_states_.device_pointers();
-    result.rng          = rng_states_.device_pointers();
-    result.interactions = interactions_.device_pointers();
+    if (components_)
+    {
+        result.particle     = components_->particle.device_pointers();
+        result.geo          = components_->geo.device_pointers();
+        result.sim          = components_->sim.device_pointers();
+        result.rng          = components_->rng.device_pointers();
+        result.interactions = components_->interactions.device_pointers();
+        ENSURE(result);
+        return result;
+    }
+
+    result.particle.vars = arena_.device_pointers(particle_);
+
+    result.geo.size       = num_tracks_;
+    result.geo.vgmaxdepth = max_depth_;
+    result.geo.vgstate    = vgstate_.device_pointers();
+    result.geo.vgnext     = vgnext_.device_pointers();
+    result.geo.pos        = arena_.device_pointers(pos_).data();
+    result.geo.dir        = arena_.device_pointers(dir_).data();
+    result.geo.next_step  = arena_.device_pointers(next_step_).data();
+
+    result.sim.vars     = arena_.device_pointers(sim_);
+    result.rng.rng      = arena_.device_pointers(rng_);
+    result.interactions = arena_.device_pointers(interactions_);
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a view to the secondary allocator storage.
+ */
+SecondaryAllocatorPointers StateStore::secondary_pointers()
+{
+    REQUIRE(max_secondaries_ > 0);
+    if (components_)
+    {
+        return secondary_store_.device_pointers();
+    }
+
+    SecondaryAllocatorPointers result;
+    result.storage = arena_.device_pointers(secondaries_);
+    result.size    = arena_.device_pointers(secondary_size_).data();
     ENSURE(result);
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Reset the number of allocated secondaries to zero.
+ */
+void StateStore::clear_secondaries()
+{
+    REQUIRE(max_secondaries_ > 0);
+    if (components_)
+    {
+        secondary_store_.clear();
+        return;
+    }
+    device_memset_zero(arena_.device_pointers(secondary_size_));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Total bytes in the track-state arena.
+ */
+size_type StateStore::size_bytes() const
+{
+    REQUIRE(this->uses_arena());
+    return arena_.size_bytes();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Per-component breakdown of the track-state arena.
+ */
+auto StateStore::memory_breakdown() const -> const VecSegment&
+{
+    REQUIRE(this->uses_arena());
+    return arena_.segments();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the complete track state (excluding navigation states) to host.
+ *
+ * This includes the secondary allocator storage and its size.
+ */
+void StateStore::copy_to_host(Span<Byte> bytes) const
+{
+    REQUIRE(this->uses_arena());
+    arena_.copy_to_host(bytes);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Restore the complete track state (excluding navigation states) from host.
+ */
+void StateStore::copy_to_device(Span<const Byte> bytes)
+{
+    REQUIRE(this->uses_arena());
+    arena_.copy_to_device(bytes);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
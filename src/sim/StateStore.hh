@@ -7,18 +7,40 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <memory>
+#include "base/DeviceArena.hh"
 #include "base/DeviceVector.hh"
 #include "geometry/GeoStateStore.hh"
+#include "geometry/detail/VGNavStateStore.hh"
 #include "physics/base/ParticleStateStore.hh"
+#include "physics/base/SecondaryAllocatorPointers.hh"
+#include "physics/base/SecondaryAllocatorStore.hh"
 #include "random/cuda/RngStateStore.hh"
 #include "SimStateStore.hh"
 #include "StatePointers.hh"
 
 namespace celeritas
 {
+class GeoParams;
 //---------------------------------------------------------------------------//
 /*!
  * Manage device data for tracks.
+ *
+ * By default all track-state arrays (particle, geometry, simulation, RNG, and
+ * interaction results) and the secondary allocator storage are carved out of
+ * a single aligned \c DeviceArena, so the complete state is one allocation
+ * that can be zeroed or checkpointed as a unit.
+ *
+ * The VecGeom navigation state pools are the one exception. Each
+ * \c NavStatePool allocates and lays out its own device buffer, and the
+ * geometry kernels address states through the pool's internal pointers, so
+ * the pools cannot be placed in the arena. They are therefore also left out
+ * of the \c copy_to_host and \c copy_to_device checkpoints.
+ *
+ * With \c Input::use_arena false, the state is instead held by the
+ * per-component stores (\c ParticleStateStore, \c GeoStateStore, etc.) as
+ * separate allocations, and the memory accessors and checkpoint functions are
+ * unavailable.
  */
 class StateStore
 {
@@ -26,6 +48,7 @@ class StateStore
     //!@{
     //! Type aliases
     using SPConstGeo = std::shared_ptr<const GeoParams>;
+    using VecSegment = DeviceArena::VecSegment;
     //!@}
 
     //! Construction arguments
@@ -33,7 +56,9 @@ class StateStore
     {
         size_type     num_tracks;
         SPConstGeo    geo;
-        unsigned long host_seed = 12345u;
+        unsigned long host_seed       = 12345u;
+        size_type     max_secondaries = 0;    //!< Secondary storage capacity
+        bool          use_arena       = true; //!< Use a single allocation
     };
 
   public:
@@ -41,17 +66,74 @@ class StateStore
     explicit StateStore(const Input& inp);
 
     //! Get the total number of tracks
-    size_type size() const { return particle_states_.size(); }
+    size_type size() const { return num_tracks_; }
 
     // Get a view to the managed data
     StatePointers device_pointers();
 
+    //// SECONDARIES ////
+
+    //! Maximum number of secondaries that can be allocated
+    size_type max_secondaries() const { return max_secondaries_; }
+
+    // Get a view to the secondary allocator storage
+    SecondaryAllocatorPointers secondary_pointers();
+
+    // Reset the number of allocated secondaries to zero
+    void clear_secondaries();
+
+    //// MEMORY ////
+
+    //! Whether the state is carved out of a single arena
+    bool uses_arena() const { return arena_.is_allocated(); }
+
+    // Total bytes in the track-state arena
+    size_type size_bytes() const;
+
+    // Per-component breakdown of the track-state arena
+    const VecSegment& memory_breakdown() const;
+
+    // Copy the complete track state to host
+    void copy_to_host(Span<Byte> bytes) const;
+
+    // Restore the complete track state from host
+    void copy_to_device(Span<const Byte> bytes);
+
   private:
-    ParticleStateStore        particle_states_;
-    GeoStateStore             geo_states_;
-    SimStateStore             sim_states_;
-    RngStateStore             rng_states_;
-    DeviceVector<Interaction> interactions_;
+    using SecondarySize = SecondaryAllocatorPointers::size_type;
+
+    // Separately allocated track states
+    struct ComponentStores
+    {
+        ParticleStateStore        particle;
+        GeoStateStore             geo;
+        SimStateStore             sim;
+        RngStateStore             rng;
+        DeviceVector<Interaction> interactions;
+    };
+
+    size_type num_tracks_;
+    size_type max_secondaries_;
+    int       max_depth_;
+
+    // Arena-backed states
+    detail::VGNavStateStore vgstate_;
+    detail::VGNavStateStore vgnext_;
+    DeviceArena             arena_;
+
+    DeviceArena::SegmentId<ParticleTrackState> particle_;
+    DeviceArena::SegmentId<Real3>              pos_;
+    DeviceArena::SegmentId<Real3>              dir_;
+    DeviceArena::SegmentId<real_type>          next_step_;
+    DeviceArena::SegmentId<SimTrackState>      sim_;
+    DeviceArena::SegmentId<RngState>           rng_;
+    DeviceArena::SegmentId<Interaction>        interactions_;
+    DeviceArena::SegmentId<SecondaryRecord>    secondaries_;
+    DeviceArena::SegmentId<SecondarySize>      secondary_size_;
+
+    // Separately allocated states
+    std::unique_ptr<ComponentStores> components_;
+    SecondaryAllocatorStore          secondary_store_;
 };
 
 //---------------------------------------------------------------------------//
@@ -7,6 +7,10 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cstdint>
+#include "celeritas_config.h"
+#include "base/ArrayUtils.hh"
+#include "base/BitMaskPointers.hh"
 #include "base/Types.hh"
 #include "geometry/GeoStatePointers.hh"
 #include "physics/base/ParticleStatePointers.hh"
@@ -28,17 +32,81 @@ struct TrackInitializer
     ParticleTrackState  particle;
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Compact storage for a track initializer.
+ *
+ * The direction is encoded with \c pack_direction and the energy is stored in
+ * single precision, as is the track time; the position keeps full precision so
+ * that the geometry state can be located reliably. Initializers always
+ * describe live tracks, so the \c alive flag is implied. This reduces the
+ * record from 88 to 56 bytes.
+ */
+struct PackedTrackInitializer
+{
+    TrackId::value_type       track_id;
+    TrackId::value_type       parent_id;
+    EventId::value_type       event_id;
+    ParticleDefId::value_type def_id;
+    Real3                     pos;
+    std::uint32_t             dir;
+    float                     energy;
+    float                     time;
+
+    //! Default construct (uninitialized, like TrackInitializer)
+    PackedTrackInitializer() = default;
+
+    //! Encode a track initializer
+    explicit CELER_FUNCTION PackedTrackInitializer(const TrackInitializer& init)
+        : track_id(init.sim.track_id.unchecked_get())
+        , parent_id(init.sim.parent_id.unchecked_get())
+        , event_id(init.sim.event_id.unchecked_get())
+        , def_id(init.particle.def_id.unchecked_get())
+        , pos(init.geo.pos)
+        , dir(pack_direction(init.geo.dir))
+        , energy(static_cast<float>(init.particle.energy.value()))
+        , time(static_cast<float>(init.sim.time))
+    {
+        REQUIRE(init.sim.alive);
+    }
+
+    //! Decode to a track initializer
+    explicit CELER_FUNCTION operator TrackInitializer() const
+    {
+        TrackInitializer result;
+        result.sim.track_id    = TrackId{track_id};
+        result.sim.parent_id   = TrackId{parent_id};
+        result.sim.event_id    = EventId{event_id};
+        result.sim.alive       = true;
+        result.sim.time        = time;
+        result.geo.pos         = pos;
+        result.geo.dir         = unpack_direction(dir);
+        result.particle.def_id = ParticleDefId{def_id};
+        result.particle.energy = units::MevEnergy{energy};
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+//! Storage type for the track initializer stack
+#if CELERITAS_COMPACT_INITIALIZERS
+using TrackInitializerRecord = PackedTrackInitializer;
+#else
+using TrackInitializerRecord = TrackInitializer;
+#endif
+
 //---------------------------------------------------------------------------//
 /*!
  * View to the data used to initialize new tracks.
  */
 struct TrackInitializerPointers
 {
-    Span<TrackInitializer>    initializers;
-    Span<size_type>           parent;
-    Span<size_type>           vacancies;
-    Span<size_type>           secondary_counts;
-    Span<TrackId::value_type> track_counter;
+    Span<TrackInitializerRecord> initializers;
+    Span<index_type>             parent;
+    Span<index_type>             vacancies;
+    BitMaskPointers              alive;
+    Span<index_type>             secondary_counts;
+    Span<TrackId::value_type>    track_counter;
 
     //! Whether the data are assigned
     explicit CELER_FUNCTION operator bool() const
@@ -8,6 +8,9 @@
 #include "TrackInitializerStore.hh"
 
 #include <numeric>
+#include "base/BitMaskAlgorithms.hh"
+#include "base/IndexCast.hh"
+#include "base/Memory.hh"
 #include "detail/InitializeTracks.hh"
 
 namespace celeritas
@@ -16,13 +19,18 @@ namespace celeritas
 /*!
  * Construct with the number of tracks and the maximum number of elements to
  * allocate on device.
+ *
+ * Indices into the track and initializer vectors are stored as \c index_type,
+ * so both sizes are checked against its range.
  */
 TrackInitializerStore::TrackInitializerStore(size_type            num_tracks,
                                              size_type            capacity,
                                              std::vector<Primary> primaries)
-    : initializers_(capacity)
+    : initializers_(checked_index_cast(capacity))
     , parent_(capacity)
-    , vacancies_(num_tracks)
+    , vacancies_(checked_index_cast(num_tracks))
+    , num_tracks_(num_tracks)
+    , alive_(BitMaskPointers::num_words(num_tracks))
     , secondary_counts_(num_tracks)
     , primaries_(primaries)
 {
@@ -30,8 +38,11 @@ TrackInitializerStore::TrackInitializerStore(size_type            num_tracks,
     initializers_.resize(0);
     parent_.resize(0);
 
+    // Clear the alive flags, including the unused bits of the last word
+    device_memset_zero(alive_.device_pointers());
+
     // Initialize vacancies to mark all track slots as initially empty
-    std::vector<size_type> host_vacancies(vacancies_.size());
+    std::vector<index_type> host_vacancies(vacancies_.size());
     std::iota(host_vacancies.begin(), host_vacancies.end(), 0);
     vacancies_.copy_to_device(make_span(host_vacancies));
 
@@ -62,6 +73,7 @@ TrackInitializerPointers TrackInitializerStore::device_pointers()
     result.initializers     = initializers_.device_pointers();
     result.parent           = parent_.device_pointers();
     result.vacancies        = vacancies_.device_pointers();
+    result.alive            = {alive_.device_pointers(), num_tracks_};
     result.secondary_counts = secondary_counts_.device_pointers();
     result.track_counter    = track_counter_.device_pointers();
 
@@ -168,9 +180,10 @@ void TrackInitializerStore::extend_from_secondaries(StateStore& states,
                          params.device_pointers(),
                          this->device_pointers());
 
-    // Remove all elements in the vacancy vector that were flagged as active
-    // tracks, leaving the (sorted) indices of the empty slots
-    size_type num_vac = detail::remove_if_alive(vacancies_.device_pointers());
+    // Compact the indices of the slots not flagged as active into the
+    // (sorted) vector of vacancies
+    size_type num_vac = device_collect_unset(
+        this->device_pointers().alive, vacancies_.device_pointers());
     vacancies_.resize(num_vac);
 
     // Sum the total number secondaries produced in all interactions
@@ -24,7 +24,8 @@ class TrackInitializerStore
 {
   public:
     // Construct with the number of tracks, the maximum number of track
-    // initializers to store on device, and the primary particles
+    // initializers to store on device, and the primary particles (both sizes
+    // must fit in index_type)
     explicit TrackInitializerStore(size_type            num_tracks,
                                    size_type            capacity,
                                    std::vector<Primary> primaries);
@@ -52,16 +53,20 @@ class TrackInitializerStore
 
   private:
     // Track initializers created from primaries or secondaries
-    DeviceVector<TrackInitializer> initializers_;
+    DeviceVector<TrackInitializerRecord> initializers_;
 
     // Thread ID of the secondary's parent
-    DeviceVector<size_type> parent_;
+    DeviceVector<index_type> parent_;
 
     // Index of empty slots in track vector
-    DeviceVector<size_type> vacancies_;
+    DeviceVector<index_type> vacancies_;
+
+    // Packed flags marking occupied slots in the track vector
+    size_type                                num_tracks_;
+    DeviceVector<BitMaskPointers::word_type> alive_;
 
     // Number of surviving secondaries produced in each interaction
-    DeviceVector<size_type> secondary_counts_;
+    DeviceVector<index_type> secondary_counts_;
 
     // Track ID counter for each event
     DeviceVector<TrackId::value_type> track_counter_;
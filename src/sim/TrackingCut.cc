@@ -0,0 +1,45 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackingCut.cc
+//---------------------------------------------------------------------------//
+#include "TrackingCut.hh"
+
+#include "base/Assert.hh"
+#include "base/Range.hh"
+#include "TrackingCutApplier.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Kill host-resident tracks that fail a tracking cut.
+ *
+ * The interaction of each killed track records the cut, and its remaining
+ * energy is added to the local energy deposition. Dead track slots are
+ * skipped.
+ */
+void apply_tracking_cuts(const ParticleParamsPointers&   particles,
+                         const TrackingCutPointers&      cuts,
+                         const TrackingCutStatePointers& states,
+                         const TrackingCutTallyPointers& tally)
+{
+    REQUIRE(states);
+
+    TrackingCutApplier apply_cuts(cuts, tally);
+    for (auto slot : range<ThreadId::value_type>(states.size()))
+    {
+        SimTrackView sim(states.sim, ThreadId{slot});
+        if (!sim.alive())
+            continue;
+
+        ParticleTrackView particle(particles, states.particle, ThreadId{slot});
+        apply_cuts(
+            particle, sim, states.volume[slot], states.interactions[slot]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
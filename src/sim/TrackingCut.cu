@@ -0,0 +1,70 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackingCut.cu
+//---------------------------------------------------------------------------//
+#include "TrackingCut.hh"
+
+#include "base/Assert.hh"
+#include "base/KernelParamCalculator.cuda.hh"
+#include "TrackingCutApplier.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// KERNELS
+//---------------------------------------------------------------------------//
+/*!
+ * Kill a live track that fails a tracking cut and deposit its energy.
+ */
+__global__ void
+apply_tracking_cuts_kernel(const ParticleParamsPointers   particles,
+                           const TrackingCutPointers      cuts,
+                           const TrackingCutStatePointers states,
+                           const TrackingCutTallyPointers tally)
+{
+    auto tid = KernelParamCalculator::thread_id();
+    if (tid.get() < states.size())
+    {
+        SimTrackView sim(states.sim, tid);
+        if (!sim.alive())
+            return;
+
+        TrackingCutApplier apply_cuts(cuts, tally);
+        ParticleTrackView  particle(particles, states.particle, tid);
+        apply_cuts(particle,
+                   sim,
+                   states.volume[tid.get()],
+                   states.interactions[tid.get()]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+// KERNEL INTERFACE
+//---------------------------------------------------------------------------//
+/*!
+ * Kill device-resident tracks that fail a tracking cut.
+ */
+void device_apply_tracking_cuts(const ParticleParamsPointers&   particles,
+                                const TrackingCutPointers&      cuts,
+                                const TrackingCutStatePointers& states,
+                                const TrackingCutTallyPointers& tally)
+{
+    REQUIRE(states);
+
+    KernelParamCalculator calc_launch_params;
+    auto                  lparams = calc_launch_params(states.size());
+    apply_tracking_cuts_kernel<<<lparams.grid_size, lparams.block_size>>>(
+        particles, cuts, states, tally);
+    CELER_CUDA_CHECK_ERROR();
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,30 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackingCut.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "physics/base/ParticleParamsPointers.hh"
+#include "TrackingCutPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// Kill host-resident tracks that fail a tracking cut
+void apply_tracking_cuts(const ParticleParamsPointers&   particles,
+                         const TrackingCutPointers&      cuts,
+                         const TrackingCutStatePointers& states,
+                         const TrackingCutTallyPointers& tally);
+
+//---------------------------------------------------------------------------//
+// Kill device-resident tracks that fail a tracking cut
+void device_apply_tracking_cuts(const ParticleParamsPointers&   particles,
+                                const TrackingCutPointers&      cuts,
+                                const TrackingCutStatePointers& states,
+                                const TrackingCutTallyPointers& tally);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,24 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackingCut.nocuda.cc
+//---------------------------------------------------------------------------//
+#include "TrackingCut.hh"
+
+#include "base/Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+void device_apply_tracking_cuts(const ParticleParamsPointers&,
+                                const TrackingCutPointers&,
+                                const TrackingCutStatePointers&,
+                                const TrackingCutTallyPointers&)
+{
+    CHECK_UNREACHABLE;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,71 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackingCutApplier.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "geometry/Types.hh"
+#include "physics/base/Interaction.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "physics/base/Units.hh"
+#include "SimTrackView.hh"
+#include "TrackingCutPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Kill a track that fails a tracking cut, depositing its energy locally.
+ *
+ * This is applied at the end of a step to every live track. A killed track
+ * has its kinetic energy zeroed and is marked dead, and it is tallied under
+ * the first rule that applies. The track's interaction records the cut as
+ * its action (see \c cutoff_action ) so that later kernels can tell tracks
+ * killed by a cut from absorbed ones, and the remaining energy is added to
+ * its local energy deposition.
+ *
+ * \code
+    TrackingCutApplier apply_cuts(cut_pointers, tally_pointers);
+    bool killed = apply_cuts(particle, sim, geo.volume_id(), interaction);
+   \endcode
+ */
+class TrackingCutApplier
+{
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
+  public:
+    // Construct from cuts and tallies
+    inline CELER_FUNCTION
+    TrackingCutApplier(const TrackingCutPointers&      cuts,
+                       const TrackingCutTallyPointers& tally);
+
+    // Find the first rule that kills the track, or size_ if none
+    inline CELER_FUNCTION TrackingCutRule
+    find_rule(const ParticleTrackView& particle,
+              const SimTrackView&      sim,
+              VolumeId                 volume) const;
+
+    // Kill the track if a rule applies and record it in the interaction
+    inline CELER_FUNCTION bool operator()(ParticleTrackView& particle,
+                                          SimTrackView&      sim,
+                                          VolumeId           volume,
+                                          Interaction&       interaction);
+
+  private:
+    const TrackingCutPointers&      cuts_;
+    const TrackingCutTallyPointers& tally_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "TrackingCutApplier.i.hh"
@@ -0,0 +1,96 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackingCutApplier.i.hh
+//---------------------------------------------------------------------------//
+
+#include "base/Assert.hh"
+#include "base/Atomics.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from cuts and tallies.
+ */
+CELER_FUNCTION
+TrackingCutApplier::TrackingCutApplier(const TrackingCutPointers&      cuts,
+                                       const TrackingCutTallyPointers& tally)
+    : cuts_(cuts), tally_(tally)
+{
+    REQUIRE(cuts_);
+    REQUIRE(tally_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the first rule that kills the track.
+ *
+ * Tracks outside the geometry (with no volume) are never killed by the region
+ * rule.
+ */
+CELER_FUNCTION TrackingCutRule
+TrackingCutApplier::find_rule(const ParticleTrackView& particle,
+                              const SimTrackView&      sim,
+                              VolumeId                 volume) const
+{
+    REQUIRE(particle.def_id() < cuts_.min_energy.size());
+    REQUIRE(!volume || volume < cuts_.kill_volume.size());
+
+    if (particle.energy().value() < cuts_.min_energy[particle.def_id().get()])
+    {
+        return TrackingCutRule::energy;
+    }
+    if (sim.time() > cuts_.max_time)
+    {
+        return TrackingCutRule::time;
+    }
+    if (volume && cuts_.kill_volume[volume.get()])
+    {
+        return TrackingCutRule::region;
+    }
+    return TrackingCutRule::size_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Kill the track if a rule applies and record it in the interaction.
+ *
+ * The remaining kinetic energy is deposited locally and tallied along with the
+ * track under the rule that killed it. The interaction's action is set to the
+ * corresponding cutoff and its exiting energy to zero; any secondaries it
+ * produced are kept. Nothing is changed if the track survives.
+ *
+ * \return Whether the track was killed
+ */
+CELER_FUNCTION bool TrackingCutApplier::operator()(ParticleTrackView& particle,
+                                                   SimTrackView&      sim,
+                                                   VolumeId           volume,
+                                                   Interaction& interaction)
+{
+    REQUIRE(sim.alive());
+
+    TrackingCutRule rule = this->find_rule(particle, sim, volume);
+    if (rule == TrackingCutRule::size_)
+    {
+        return false;
+    }
+
+    const MevEnergy deposited = particle.energy();
+    particle.energy(zero_quantity());
+    sim.alive() = false;
+
+    interaction.action            = cutoff_action(rule);
+    interaction.energy            = zero_quantity();
+    interaction.energy_deposition = MevEnergy{
+        interaction.energy_deposition.value() + deposited.value()};
+
+    atomic_add(&tally_.num_tracks[int(rule)], ull_int(1));
+    atomic_add(&tally_.energy[int(rule)], deposited.value());
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,98 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackingCutParams.cc
+//---------------------------------------------------------------------------//
+#include "TrackingCutParams.hh"
+
+#include "base/Assert.hh"
+#include "base/Range.hh"
+#include "comm/Device.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from particle types, regions, and the kill policy.
+ *
+ * Every particle and region named in the input must exist.
+ */
+TrackingCutParams::TrackingCutParams(const ParticleParams& particles,
+                                     const RegionParams&   regions,
+                                     const Input&          inp)
+    : max_time_(inp.max_time)
+{
+    REQUIRE(particles.size() > 0);
+    REQUIRE(inp.max_time > 0);
+
+    host_min_energy_.assign(particles.size(), 0);
+    for (const EnergyCut& cut : inp.energy_cuts)
+    {
+        REQUIRE(cut.energy >= zero_quantity());
+        ParticleDefId id = particles.find(cut.pdg);
+        INSIST(id,
+               "Particle with PDG number " << cut.pdg.get()
+                                           << " has no particle definition");
+        host_min_energy_[id.get()] = cut.energy.value();
+    }
+
+    const RegionParamsPointers region_ptrs = regions.host_pointers();
+    Span<const RegionId>       volume_regions = region_ptrs.volume_regions;
+    host_kill_volume_.assign(volume_regions.size(), 0);
+    for (const std::string& label : inp.kill_regions)
+    {
+        RegionId id = regions.find(label);
+        INSIST(id, "Kill region '" << label << "' does not exist");
+        for (auto vol : range(volume_regions.size()))
+        {
+            if (volume_regions[vol] == id)
+            {
+                host_kill_volume_[vol] = 1;
+            }
+        }
+    }
+
+    if (celeritas::is_device_enabled())
+    {
+        device_min_energy_ = DeviceVector<real_type>(host_min_energy_.size());
+        device_min_energy_.copy_to_device(make_span(host_min_energy_));
+        device_kill_volume_ = DeviceVector<char>(host_kill_volume_.size());
+        device_kill_volume_.copy_to_device(make_span(host_kill_volume_));
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access cuts on the host.
+ */
+TrackingCutPointers TrackingCutParams::host_pointers() const
+{
+    TrackingCutPointers result;
+    result.min_energy  = make_span(host_min_energy_);
+    result.max_time    = max_time_;
+    result.kill_volume = make_span(host_kill_volume_);
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access cuts on the device.
+ */
+TrackingCutPointers TrackingCutParams::device_pointers() const
+{
+    REQUIRE(!device_min_energy_.empty());
+    TrackingCutPointers result;
+    result.min_energy  = device_min_energy_.device_pointers();
+    result.max_time    = max_time_;
+    result.kill_volume = device_kill_volume_.device_pointers();
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
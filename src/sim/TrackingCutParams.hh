@@ -0,0 +1,84 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackingCutParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <limits>
+#include <string>
+#include <vector>
+#include "base/DeviceVector.hh"
+#include "base/Types.hh"
+#include "physics/base/PDGNumber.hh"
+#include "physics/base/ParticleParams.hh"
+#include "physics/base/RegionParams.hh"
+#include "physics/base/Units.hh"
+#include "TrackingCutPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Policy for killing tracks that no longer contribute to the result.
+ *
+ * Low-energy and late tracks, and tracks that enter regions that aren't
+ * scored (e.g. a shield or the world volume), are killed and their remaining
+ * kinetic energy is deposited locally. The rules are:
+ * - an energy threshold for each particle type,
+ * - a global time window starting at the beginning of the event, and
+ * - a list of kill regions from the \c RegionParams.
+ *
+ * By default no particle has a threshold, the time window is infinite, and no
+ * region kills tracks. The time window is only meaningful if the track's time
+ * is advanced along each step (see \c SimTrackView::advance_time ).
+ */
+class TrackingCutParams
+{
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
+    //! Energy threshold for a particle type
+    struct EnergyCut
+    {
+        PDGNumber pdg;
+        MevEnergy energy;
+    };
+
+    //! Input data to construct this class
+    struct Input
+    {
+        std::vector<EnergyCut>   energy_cuts;
+        std::vector<std::string> kill_regions;
+        //! End of the time window [s]
+        real_type max_time = std::numeric_limits<real_type>::infinity();
+    };
+
+  public:
+    // Construct from particle types, regions, and the kill policy
+    TrackingCutParams(const ParticleParams& particles,
+                      const RegionParams&   regions,
+                      const Input&          inp);
+
+    // Access cuts on the host
+    TrackingCutPointers host_pointers() const;
+
+    // Access cuts on the device
+    TrackingCutPointers device_pointers() const;
+
+  private:
+    real_type              max_time_;
+    std::vector<real_type> host_min_energy_;
+    std::vector<char>      host_kill_volume_;
+
+    DeviceVector<real_type> device_min_energy_;
+    DeviceVector<char>      device_kill_volume_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
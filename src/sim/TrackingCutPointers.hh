@@ -0,0 +1,123 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackingCutPointers.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Assert.hh"
+#include "base/Macros.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "geometry/Types.hh"
+#include "physics/base/Interaction.hh"
+#include "physics/base/ParticleStatePointers.hh"
+#include "SimStatePointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Rules for killing a track and depositing its energy locally.
+ *
+ * Rules are checked in this order, and a track is tallied under the first
+ * rule that applies.
+ */
+enum class TrackingCutRule
+{
+    energy, //!< Kinetic energy below the particle's threshold
+    time,   //!< Time outside the global time window
+    region, //!< Track is in a kill region
+    size_
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Action recorded for a track killed by the given rule.
+ */
+inline CELER_FUNCTION Action cutoff_action(TrackingCutRule rule)
+{
+    REQUIRE(rule != TrackingCutRule::size_);
+    switch (rule)
+    {
+        case TrackingCutRule::energy:
+            return Action::cutoff_energy;
+        case TrackingCutRule::time:
+            return Action::cutoff_time;
+        default:
+            return Action::cutoff_region;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tracking cuts, all particles and volumes.
+ *
+ * Kill regions are resolved to a flag for each geometry volume. Particles
+ * without an energy threshold have a zero minimum energy.
+ *
+ * \sa TrackingCutParams (owns the pointed-to data)
+ * \sa TrackingCutApplier (applies the cuts to a single track)
+ */
+struct TrackingCutPointers
+{
+    Span<const real_type> min_energy;   //!< Energy threshold [particle][MeV]
+    real_type             max_time = 0; //!< End of the time window [s]
+    Span<const char>      kill_volume;  //!< Kill flag [volume]
+
+    //! Check whether the interface is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !min_energy.empty() && max_time > 0 && !kill_volume.empty();
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Track states that tracking cuts are applied to.
+ *
+ * The current volume of each track is supplied by the geometry; the energy of
+ * a killed track is added to the local energy deposition of its interaction.
+ */
+struct TrackingCutStatePointers
+{
+    ParticleStatePointers particle;
+    SimStatePointers      sim;
+    Span<const VolumeId>  volume;
+    Span<Interaction>     interactions;
+
+    //! Whether the data are assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return particle && sim.size() == particle.size()
+               && volume.size() == particle.size()
+               && interactions.size() == particle.size();
+    }
+
+    //! Number of tracks
+    CELER_FUNCTION size_type size() const { return particle.size(); }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of tracks killed and energy deposited by each tracking cut rule.
+ *
+ * \sa TrackingCutTallyStore (owns the pointed-to data)
+ */
+struct TrackingCutTallyPointers
+{
+    Span<ull_int>   num_tracks; //!< Killed tracks [rule]
+    Span<real_type> energy;     //!< Deposited energy [rule][MeV]
+
+    //! Check whether the interface is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return num_tracks.size() == size_type(TrackingCutRule::size_)
+               && energy.size() == num_tracks.size();
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
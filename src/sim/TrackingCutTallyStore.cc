@@ -0,0 +1,108 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackingCutTallyStore.cc
+//---------------------------------------------------------------------------//
+#include "TrackingCutTallyStore.hh"
+
+#include <algorithm>
+#include "base/Assert.hh"
+#include "base/Memory.hh"
+#include "base/Range.hh"
+#include "comm/Device.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+constexpr size_type TrackingCutTallyStore::num_rules;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with zeroed tallies.
+ */
+TrackingCutTallyStore::TrackingCutTallyStore()
+    : host_num_tracks_(num_rules), host_energy_(num_rules)
+{
+    if (celeritas::is_device_enabled())
+    {
+        device_num_tracks_ = DeviceVector<ull_int>(num_rules);
+        device_energy_     = DeviceVector<real_type>(num_rules);
+    }
+    this->clear();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reset the tallies to zero.
+ *
+ * This launches a kernel if the device is enabled.
+ */
+void TrackingCutTallyStore::clear()
+{
+    std::fill(host_num_tracks_.begin(), host_num_tracks_.end(), 0);
+    std::fill(host_energy_.begin(), host_energy_.end(), 0);
+    if (!device_num_tracks_.empty())
+    {
+        device_memset_zero(device_num_tracks_.device_pointers());
+        device_memset_zero(device_energy_.device_pointers());
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Combine host and device tallies.
+ *
+ * This should not be called while a kernel is applying cuts.
+ */
+auto TrackingCutTallyStore::summary() const -> Summary
+{
+    std::vector<ull_int>   num_tracks(num_rules, 0);
+    std::vector<real_type> energy(num_rules, 0);
+    if (!device_num_tracks_.empty())
+    {
+        device_num_tracks_.copy_to_host(make_span(num_tracks));
+        device_energy_.copy_to_host(make_span(energy));
+    }
+
+    Summary result;
+    for (auto i : range(num_rules))
+    {
+        result.num_tracks[i] = num_tracks[i] + host_num_tracks_[i];
+        result.energy[i]     = energy[i] + host_energy_[i];
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access tallies on the host.
+ */
+TrackingCutTallyPointers TrackingCutTallyStore::host_pointers()
+{
+    TrackingCutTallyPointers result;
+    result.num_tracks = make_span(host_num_tracks_);
+    result.energy     = make_span(host_energy_);
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access tallies on the device.
+ */
+TrackingCutTallyPointers TrackingCutTallyStore::device_pointers()
+{
+    REQUIRE(!device_num_tracks_.empty());
+    TrackingCutTallyPointers result;
+    result.num_tracks = device_num_tracks_.device_pointers();
+    result.energy     = device_energy_.device_pointers();
+
+    ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
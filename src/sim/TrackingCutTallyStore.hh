@@ -0,0 +1,61 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackingCutTallyStore.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+#include "base/Array.hh"
+#include "base/DeviceVector.hh"
+#include "base/Types.hh"
+#include "TrackingCutPointers.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Manage the counters of tracks and energy removed by tracking cuts.
+ *
+ * Host and device tracks are tallied separately; the summary combines them.
+ */
+class TrackingCutTallyStore
+{
+  public:
+    //! Number of tracking cut rules
+    static constexpr size_type num_rules = size_type(TrackingCutRule::size_);
+
+    //! Combined tallies, indexed by rule
+    struct Summary
+    {
+        Array<ull_int, num_rules>   num_tracks; //!< Killed tracks
+        Array<real_type, num_rules> energy;     //!< Deposited energy [MeV]
+    };
+
+  public:
+    // Construct with zeroed tallies
+    TrackingCutTallyStore();
+
+    // Reset the tallies to zero
+    void clear();
+
+    // Combine host and device tallies (performs device->host copy!)
+    Summary summary() const;
+
+    // Access tallies on the host
+    TrackingCutTallyPointers host_pointers();
+
+    // Access tallies on the device
+    TrackingCutTallyPointers device_pointers();
+
+  private:
+    std::vector<ull_int>    host_num_tracks_;
+    std::vector<real_type>  host_energy_;
+    DeviceVector<ull_int>   device_num_tracks_;
+    DeviceVector<real_type> device_energy_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
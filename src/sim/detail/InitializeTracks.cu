@@ -9,10 +9,10 @@
 
 #include <thrust/device_ptr.h>
 #include <thrust/reduce.h>
-#include <thrust/remove.h>
 #include <thrust/scan.h>
 #include <vector>
 #include "base/Atomics.hh"
+#include "base/BitMaskView.hh"
 #include "base/DeviceVector.hh"
 #include "base/KernelParamCalculator.cuda.hh"
 #include "geometry/GeoTrackView.hh"
@@ -23,16 +23,6 @@ namespace
 {
 using namespace celeritas;
 using celeritas::detail::flag_id;
-//---------------------------------------------------------------------------//
-// HELPER CLASSES
-//---------------------------------------------------------------------------//
-struct IsEqual
-{
-    size_type value;
-
-    CELER_FUNCTION bool operator()(size_type x) const { return x == value; }
-};
-
 //---------------------------------------------------------------------------//
 // KERNELS
 //---------------------------------------------------------------------------//
@@ -53,8 +43,8 @@ __global__ void init_tracks_kernel(const StatePointers            states,
         // initializers are pushed to the back of the vector, these will be the
         // most recently added and therefore the ones that still might have a
         // parent they can copy the geometry state from.
-        const TrackInitializer& init
-            = inits.initializers[inits.initializers.size() - thread_id - 1];
+        const TrackInitializer init(
+            inits.initializers[inits.initializers.size() - thread_id - 1]);
 
         // Index of the empty slot to create the new track in
         ThreadId slot_id(
@@ -97,7 +87,7 @@ __global__ void init_tracks_kernel(const StatePointers            states,
 
 //---------------------------------------------------------------------------//
 /*!
- * Find empty slots in the track vector and count the number of secondaries
+ * Flag occupied slots in the track vector and count the number of secondaries
  * that survived cutoffs for each interaction. If the track is dead and
  * produced secondaries, fill the empty track slot with one of the secondaries.
  */
@@ -108,6 +98,8 @@ __global__ void locate_alive_kernel(const StatePointers            states,
     auto thread_id = KernelParamCalculator::thread_id();
     if (thread_id < states.size())
     {
+        BitMaskView alive(inits.alive);
+
         // Secondary to copy to the parent's track slot if the parent has died
         size_type secondary_id = flag_id();
 
@@ -130,7 +122,7 @@ __global__ void locate_alive_kernel(const StatePointers            states,
         if (sim.alive())
         {
             // The track is alive: mark this track slot as active
-            inits.vacancies[thread_id.get()] = flag_id();
+            alive.set(thread_id.get());
         }
         else if (secondary_id != flag_id())
         {
@@ -145,10 +137,15 @@ __global__ void locate_alive_kernel(const StatePointers            states,
                 = atomic_add(&inits.track_counter[sim.event_id().get()], 1u);
 
             // Initialize the simulation state
-            sim = {TrackId{track_id}, sim.track_id(), sim.event_id(), true};
+            sim = {TrackId{track_id},
+                   sim.track_id(),
+                   sim.event_id(),
+                   true,
+                   sim.time()};
 
             // Initialize the particle state from the secondary
-            Secondary&        secondary = result.secondaries[secondary_id];
+            SecondaryRecord&  record = result.secondaries[secondary_id];
+            const Secondary   secondary(record);
             ParticleTrackView particle(
                 params.particle, states.particle, thread_id);
             particle = {secondary.def_id, secondary.energy};
@@ -159,14 +156,15 @@ __global__ void locate_alive_kernel(const StatePointers            states,
 
             // Mark the secondary as processed and the track as active
             --inits.secondary_counts[thread_id.get()];
-            secondary                        = Secondary{};
-            inits.vacancies[thread_id.get()] = flag_id();
+            record = SecondaryRecord(Secondary{});
+            alive.set(thread_id.get());
         }
         else
         {
-            // The track is dead and did not produce secondaries: store the
-            // index so it can be used later to initialize a new track
-            inits.vacancies[thread_id.get()] = thread_id.get();
+            // The track is dead and did not produce secondaries: leave the
+            // slot unflagged so it can be used later to initialize a new
+            // track
+            alive.reset(thread_id.get());
         }
     }
 }
@@ -176,24 +174,27 @@ __global__ void locate_alive_kernel(const StatePointers            states,
  * Create track initializers on device from primary particles.
  */
 __global__ void
-process_primaries_kernel(const Span<const Primary>    primaries,
-                         const Span<TrackInitializer> initializers)
+process_primaries_kernel(const Span<const Primary>          primaries,
+                         const Span<TrackInitializerRecord> initializers)
 {
     auto thread_id = KernelParamCalculator::thread_id();
     if (thread_id < primaries.size())
     {
-        TrackInitializer& init    = initializers[thread_id.get()];
-        const Primary&    primary = primaries[thread_id.get()];
+        TrackInitializer init;
+        const Primary&   primary = primaries[thread_id.get()];
 
         // Construct a track initializer from a primary particle
         init.sim.track_id    = primary.track_id;
         init.sim.parent_id   = TrackId{};
         init.sim.event_id    = primary.event_id;
         init.sim.alive       = true;
+        init.sim.time        = 0;
         init.geo.pos         = primary.position;
         init.geo.dir         = primary.direction;
         init.particle.def_id = primary.def_id;
         init.particle.energy = primary.energy;
+
+        initializers[thread_id.get()] = TrackInitializerRecord(init);
     }
 }
 
@@ -216,13 +217,15 @@ __global__ void process_secondaries_kernel(const StatePointers states,
         size_type offset_id = inits.secondary_counts[thread_id.get()];
 
         Interaction& result = states.interactions[thread_id.get()];
-        for (const auto& secondary : result.secondaries)
+        for (const auto& secondary_record : result.secondaries)
         {
-            if (secondary)
+            if (secondary_record)
             {
+                const Secondary secondary(secondary_record);
+
                 // The secondary survived cutoffs: convert to a track
                 CHECK(offset_id < inits.initializers.size());
-                TrackInitializer& init = inits.initializers[offset_id];
+                TrackInitializerRecord& record = inits.initializers[offset_id];
 
                 // Store the thread ID of the secondary's parent
                 CHECK(offset_id < inits.parent.size());
@@ -236,14 +239,17 @@ __global__ void process_secondaries_kernel(const StatePointers states,
                     &inits.track_counter[sim.event_id().get()], 1u);
 
                 // Construct a track initializer from a secondary
+                TrackInitializer init;
                 init.sim.track_id    = TrackId{track_id};
                 init.sim.parent_id   = sim.track_id();
                 init.sim.event_id    = sim.event_id();
                 init.sim.alive       = true;
+                init.sim.time        = sim.time();
                 init.geo.pos         = geo.pos();
                 init.geo.dir         = secondary.direction;
                 init.particle.def_id = secondary.def_id;
                 init.particle.energy = secondary.energy;
+                record               = TrackInitializerRecord(init);
             }
         }
         // Clear the secondaries from the interaction
@@ -342,30 +348,11 @@ void process_secondaries(const StatePointers&     states,
     CELER_CUDA_CALL(cudaDeviceSynchronize());
 }
 
-//---------------------------------------------------------------------------//
-/*!
- * Remove all elements in the vacancy vector that were flagged as active
- * tracks.
- */
-size_type remove_if_alive(Span<size_type> vacancies)
-{
-    thrust::device_ptr<size_type> end = thrust::remove_if(
-        thrust::device_pointer_cast(vacancies.data()),
-        thrust::device_pointer_cast(vacancies.data() + vacancies.size()),
-        IsEqual{flag_id()});
-
-    CELER_CUDA_CALL(cudaDeviceSynchronize());
-
-    // New size of the vacancy vector
-    size_type result = thrust::raw_pointer_cast(end) - vacancies.data();
-    return result;
-}
-
 //---------------------------------------------------------------------------//
 /*!
  * Sum the total number of surviving secondaries.
  */
-size_type reduce_counts(Span<size_type> counts)
+size_type reduce_counts(Span<index_type> counts)
 {
     size_type result = thrust::reduce(
         thrust::device_pointer_cast(counts.data()),
@@ -385,13 +372,13 @@ size_type reduce_counts(Span<size_type> counts)
  * array elements, i.e., \f$ y_i = \sum_{j=0}^{i-1} x_j \f$,
  * where \f$ y_0 = 0 \f$, and stores the result in the input array.
  */
-void exclusive_scan_counts(Span<size_type> counts)
+void exclusive_scan_counts(Span<index_type> counts)
 {
     thrust::exclusive_scan(
         thrust::device_pointer_cast(counts.data()),
         thrust::device_pointer_cast(counts.data()) + counts.size(),
         counts.data(),
-        size_type(0));
+        index_type(0));
 
     CELER_CUDA_CALL(cudaDeviceSynchronize());
 }
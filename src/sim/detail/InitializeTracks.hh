@@ -49,17 +49,13 @@ void process_secondaries(const StatePointers&     states,
                          const ParamPointers&     params,
                          TrackInitializerPointers inits);
 
-//---------------------------------------------------------------------------//
-// Remove all elements in the vacancy vector that were flagged as alive
-size_type remove_if_alive(Span<size_type> vacancies);
-
 //---------------------------------------------------------------------------//
 // Sum the total number of surviving secondaries.
-size_type reduce_counts(Span<size_type> counts);
+size_type reduce_counts(Span<index_type> counts);
 
 //---------------------------------------------------------------------------//
 // Calculate the exclusive prefix sum of the number of surviving secondaries
-void exclusive_scan_counts(Span<size_type> counts);
+void exclusive_scan_counts(Span<index_type> counts);
 
 //---------------------------------------------------------------------------//
 } // namespace detail
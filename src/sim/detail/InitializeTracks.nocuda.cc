@@ -40,17 +40,12 @@ void process_secondaries(const StatePointers&,
     CHECK_UNREACHABLE;
 }
 
-size_type remove_if_alive(Span<size_type>)
+size_type reduce_counts(Span<index_type>)
 {
     CHECK_UNREACHABLE;
 }
 
-size_type reduce_counts(Span<size_type>)
-{
-    CHECK_UNREACHABLE;
-}
-
-void exclusive_scan_counts(Span<size_type>)
+void exclusive_scan_counts(Span<index_type>)
 {
     CHECK_UNREACHABLE;
 }
@@ -30,3 +30,43 @@ TEST(AlgorithmsTest, ipow)
     EXPECT_EQ(1e4, celeritas::ipow<4>(10.0));
     EXPECT_TRUE((std::is_same<int, decltype(celeritas::ipow<4>(5))>::value));
 }
+
+TEST(AlgorithmsTest, bits)
+{
+    EXPECT_EQ(0, celeritas::popcount(0u));
+    EXPECT_EQ(1, celeritas::popcount(8u));
+    EXPECT_EQ(32, celeritas::popcount(~0u));
+    EXPECT_EQ(0, celeritas::countr_zero(1u));
+    EXPECT_EQ(3, celeritas::countr_zero(0x18u));
+    EXPECT_EQ(31, celeritas::countr_zero(0x80000000u));
+}
+
+TEST(AlgorithmsTest, lower_bound)
+{
+    const double values[] = {1.0, 2.0, 2.0, 4.0};
+    auto         find     = [&values](double v) {
+        return celeritas::lower_bound(std::begin(values), std::end(values), v)
+               - std::begin(values);
+    };
+    EXPECT_EQ(0, find(0.5));
+    EXPECT_EQ(0, find(1.0));
+    EXPECT_EQ(1, find(1.5));
+    EXPECT_EQ(1, find(2.0));
+    EXPECT_EQ(3, find(4.0));
+    EXPECT_EQ(4, find(5.0));
+}
+
+TEST(AlgorithmsTest, upper_bound)
+{
+    const double values[] = {1.0, 2.0, 2.0, 4.0};
+    auto         find     = [&values](double v) {
+        return celeritas::upper_bound(std::begin(values), std::end(values), v)
+               - std::begin(values);
+    };
+    EXPECT_EQ(0, find(0.5));
+    EXPECT_EQ(1, find(1.0));
+    EXPECT_EQ(1, find(1.5));
+    EXPECT_EQ(3, find(2.0));
+    EXPECT_EQ(4, find(4.0));
+    EXPECT_EQ(4, find(5.0));
+}
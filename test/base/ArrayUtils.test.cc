@@ -112,3 +112,50 @@ TEST(ArrayUtilsTest, rotate)
     vec      = celeritas::rotate(scatter, {0.0, 0.0, 1.0});
     EXPECT_VEC_SOFT_EQ(expected, vec);
 }
+
+TEST(ArrayUtilsTest, pack_direction)
+{
+    using celeritas::pack_direction;
+    using celeritas::unpack_direction;
+
+    // Angle between two unit vectors, accurate for small angles
+    auto angle_between = [](const Real3& a, const Real3& b) {
+        Real3 diff = {a[X] - b[X], a[Y] - b[Y], a[Z] - b[Z]};
+        return 2 * std::asin(celeritas::norm(diff) / 2);
+    };
+
+    // Cartesian axes and octahedron edges survive the round trip closely
+    const Real3 special[] = {{1, 0, 0},
+                             {-1, 0, 0},
+                             {0, 1, 0},
+                             {0, -1, 0},
+                             {0, 0, 1},
+                             {0, 0, -1},
+                             {0.6, 0.8, 0},
+                             {-0.6, 0, -0.8}};
+    for (const Real3& dir : special)
+    {
+        Real3 actual = unpack_direction(pack_direction(dir));
+        EXPECT_VEC_CLOSE(dir, actual, 1e-4, 1e-4);
+        EXPECT_SOFT_EQ(1.0, celeritas::norm(actual));
+    }
+
+    // Bound the quantization error over the whole sphere
+    const int num_theta = 181;
+    const int num_phi   = 360;
+    double    max_error = 0;
+    for (int i = 0; i < num_theta; ++i)
+    {
+        double costheta = -1 + 2.0 * i / (num_theta - 1);
+        for (int j = 0; j < num_phi; ++j)
+        {
+            double phi = 2 * celeritas::constants::pi * (j + 0.5) / num_phi;
+            Real3  dir = celeritas::from_spherical(costheta, phi);
+            Real3  actual = unpack_direction(pack_direction(dir));
+            EXPECT_SOFT_EQ(1.0, celeritas::norm(actual));
+            max_error = std::fmax(max_error, angle_between(dir, actual));
+        }
+    }
+    EXPECT_LT(max_error, 1e-4);
+    EXPECT_GT(max_error, 1e-6);
+}
@@ -0,0 +1,156 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BitMask.test.cc
+//---------------------------------------------------------------------------//
+#include "base/BitMaskView.hh"
+
+#include <vector>
+#include "base/BitMaskAlgorithms.hh"
+#include "base/DeviceVector.hh"
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class BitMaskTest : public celeritas::Test
+{
+  protected:
+    using word_type = BitMaskPointers::word_type;
+
+    void SetUp() override
+    {
+        words.assign(BitMaskPointers::num_words(70), 0);
+        ptrs.words = make_span(words);
+        ptrs.size  = 70;
+    }
+
+    std::vector<word_type> words;
+    BitMaskPointers        ptrs;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(BitMaskTest, host)
+{
+    EXPECT_EQ(32, BitMaskPointers::bits_per_word());
+    EXPECT_EQ(3, words.size());
+    ASSERT_TRUE(ptrs);
+
+    BitMaskView mask(ptrs);
+    EXPECT_EQ(70, mask.size());
+    EXPECT_EQ(0, mask.count());
+    EXPECT_EQ(70, mask.find_next(0));
+
+    for (size_type i : {0, 5, 31, 32, 63, 69})
+    {
+        mask.set(i);
+    }
+    mask.set(5);
+    EXPECT_EQ(6, mask.count());
+    EXPECT_TRUE(mask.test(31));
+    EXPECT_FALSE(mask.test(30));
+
+    // Prefix counts
+    EXPECT_EQ(0, mask.rank(0));
+    EXPECT_EQ(1, mask.rank(1));
+    EXPECT_EQ(2, mask.rank(31));
+    EXPECT_EQ(3, mask.rank(32));
+    EXPECT_EQ(4, mask.rank(33));
+    EXPECT_EQ(5, mask.rank(69));
+    EXPECT_EQ(6, mask.rank(70));
+
+    // Search
+    std::vector<size_type> found;
+    for (size_type i = mask.find_next(0); i != mask.size();
+         i           = mask.find_next(i + 1))
+    {
+        found.push_back(i);
+    }
+    const size_type expected_found[] = {0, 5, 31, 32, 63, 69};
+    EXPECT_VEC_EQ(expected_found, found);
+
+    mask.reset(32);
+    mask.reset(33);
+    EXPECT_EQ(5, mask.count());
+    EXPECT_EQ(63, mask.find_next(32));
+
+    // Trailing bits must remain unset
+    EXPECT_EQ(0u, words.back() & ~((1u << 6) - 1));
+}
+
+TEST_F(BitMaskTest, device)
+{
+#if !CELERITAS_USE_CUDA
+    cout << "CUDA is disabled; skipping device test." << endl;
+    return;
+#endif
+    BitMaskView host_mask(ptrs);
+    for (size_type i : {0, 5, 31, 32, 63, 69})
+    {
+        host_mask.set(i);
+    }
+
+    DeviceVector<word_type> device_words(words.size());
+    device_words.copy_to_device(make_span(words));
+    BitMaskPointers device_ptrs{device_words.device_pointers(), ptrs.size};
+
+    EXPECT_EQ(6, device_count_set(device_ptrs));
+
+    DeviceVector<index_type> offsets(words.size());
+    device_prefix_count(device_ptrs, offsets.device_pointers());
+    std::vector<index_type> host_offsets(words.size());
+    offsets.copy_to_host(make_span(host_offsets));
+    const index_type expected_offsets[] = {0, 3, 5};
+    EXPECT_VEC_EQ(expected_offsets, host_offsets);
+
+    DeviceVector<index_type> indices(ptrs.size);
+    size_type num_unset
+        = device_collect_unset(device_ptrs, indices.device_pointers());
+    EXPECT_EQ(64, num_unset);
+    std::vector<index_type> host_indices(ptrs.size);
+    indices.copy_to_host(make_span(host_indices));
+    host_indices.resize(num_unset);
+
+    std::vector<index_type> expected_indices;
+    for (size_type i = 0; i != ptrs.size; ++i)
+    {
+        if (!host_mask.test(i))
+            expected_indices.push_back(i);
+    }
+    EXPECT_VEC_EQ(expected_indices, host_indices);
+}
+
+TEST_F(BitMaskTest, device_padding)
+{
+#if !CELERITAS_USE_CUDA
+    cout << "CUDA is disabled; skipping device test." << endl;
+    return;
+#endif
+    // Unused bits of the last word are garbage, as in uninitialized memory
+    BitMaskView host_mask(ptrs);
+    host_mask.set(3);
+    words.back() |= ~((word_type(1) << 6) - 1);
+
+    DeviceVector<word_type> device_words(words.size());
+    device_words.copy_to_device(make_span(words));
+    BitMaskPointers device_ptrs{device_words.device_pointers(), ptrs.size};
+
+    // Only the flags in range are collected
+    DeviceVector<index_type> indices(ptrs.size);
+    size_type num_unset
+        = device_collect_unset(device_ptrs, indices.device_pointers());
+    EXPECT_EQ(69, num_unset);
+    std::vector<index_type> host_indices(ptrs.size);
+    indices.copy_to_host(make_span(host_indices));
+    EXPECT_EQ(2, host_indices[2]);
+    EXPECT_EQ(4, host_indices[3]);
+    EXPECT_EQ(69, host_indices[68]);
+}
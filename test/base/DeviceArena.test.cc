@@ -0,0 +1,99 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file DeviceArena.test.cc
+//---------------------------------------------------------------------------//
+#include "base/DeviceArena.hh"
+
+#include <vector>
+#include "base/Array.hh"
+#include "celeritas_test.hh"
+
+using celeritas::Byte;
+using celeritas::DeviceArena;
+using celeritas::Real3;
+using celeritas::size_type;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class DeviceArenaTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override {}
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(DeviceArenaTest, all)
+{
+    DeviceArena arena;
+    EXPECT_EQ(0, arena.size_bytes());
+    EXPECT_FALSE(arena.is_allocated());
+
+    auto pos_id   = arena.reserve<Real3>("pos", 10);
+    auto flag_id  = arena.reserve<char>("flag", 3);
+    auto count_id = arena.reserve<int>("count", 1000);
+    EXPECT_EQ(0, pos_id.get());
+    EXPECT_EQ(1, flag_id.get());
+    EXPECT_EQ(2, count_id.get());
+
+    // Check layout
+    const auto& segments = arena.segments();
+    ASSERT_EQ(3, segments.size());
+    EXPECT_EQ("pos", segments[0].label);
+    EXPECT_EQ(0, segments[0].offset);
+    EXPECT_EQ(240, segments[0].size);
+    EXPECT_EQ("flag", segments[1].label);
+    EXPECT_EQ(256, segments[1].offset);
+    EXPECT_EQ(3, segments[1].size);
+    EXPECT_EQ("count", segments[2].label);
+    EXPECT_EQ(512, segments[2].offset);
+    EXPECT_EQ(4000, segments[2].size);
+    EXPECT_EQ(4512, arena.size_bytes());
+
+    for (const auto& seg : segments)
+    {
+        EXPECT_EQ(0, seg.offset % DeviceArena::alignment());
+    }
+
+#if !CELERITAS_USE_CUDA
+    // Can't allocate
+    EXPECT_THROW(arena.allocate(), celeritas::DebugError);
+    cout << "CUDA is disabled; skipping remainder of test." << endl;
+    return;
+#endif
+
+    arena.allocate();
+    EXPECT_TRUE(arena.is_allocated());
+    EXPECT_EQ(10, arena.device_pointers(pos_id).size());
+    EXPECT_EQ(3, arena.device_pointers(flag_id).size());
+    EXPECT_EQ(1000, arena.device_pointers(count_id).size());
+    EXPECT_EQ(reinterpret_cast<Byte*>(arena.device_pointers(pos_id).data())
+                  + 512,
+              reinterpret_cast<Byte*>(arena.device_pointers(count_id).data()));
+
+    // Zero the whole arena and copy it back in a single transfer
+    arena.clear();
+    std::vector<Byte> host(arena.size_bytes(), Byte(1));
+    arena.copy_to_host(celeritas::make_span(host));
+    EXPECT_EQ(Byte(0), host.front());
+    EXPECT_EQ(Byte(0), host.back());
+
+    // Round-trip a checkpoint
+    host.back() = Byte(123);
+    arena.copy_to_device(celeritas::make_span(host));
+    std::vector<Byte> restored(arena.size_bytes());
+    arena.copy_to_host(celeritas::make_span(restored));
+    EXPECT_EQ(Byte(123), restored.back());
+
+#if CELERITAS_DEBUG
+    // Can't reserve after allocating
+    EXPECT_THROW(arena.reserve<int>("late", 1), celeritas::DebugError);
+#endif
+}
@@ -0,0 +1,84 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file IndexCast.test.cc
+//---------------------------------------------------------------------------//
+#include "base/IndexCast.hh"
+
+#include <limits>
+#include "celeritas_test.hh"
+
+using celeritas::checked_index_cast;
+using celeritas::index_type;
+using celeritas::size_type;
+using celeritas::ull_int;
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(IndexCastTest, configured)
+{
+#if CELERITAS_COMPACT_INDEX
+    EXPECT_EQ(4, sizeof(index_type));
+#else
+    EXPECT_EQ(sizeof(size_type), sizeof(index_type));
+#endif
+    EXPECT_EQ(index_type(1234), checked_index_cast(size_type(1234)));
+}
+
+//---------------------------------------------------------------------------//
+// Test fixture
+//---------------------------------------------------------------------------//
+//! Exercise both possible definitions of index_type regardless of config
+template<class T>
+class IndexWidthTest : public celeritas::Test
+{
+  protected:
+    using index_type = T;
+    using Limits_t   = std::numeric_limits<index_type>;
+};
+
+using IndexTypes = ::testing::Types<unsigned int, size_type>;
+TYPED_TEST_SUITE(IndexWidthTest, IndexTypes, );
+
+TYPED_TEST(IndexWidthTest, in_range)
+{
+    using index_type = typename TestFixture::index_type;
+    using Limits_t   = typename TestFixture::Limits_t;
+    const ull_int max_value = Limits_t::max();
+
+    EXPECT_EQ(0u, checked_index_cast<index_type>(size_type(0)));
+    EXPECT_EQ(12345u, checked_index_cast<index_type>(12345u));
+    EXPECT_EQ(Limits_t::max(),
+              checked_index_cast<index_type>(size_type(max_value)));
+    EXPECT_EQ(Limits_t::max(), checked_index_cast<index_type>(max_value));
+    EXPECT_EQ(Limits_t::max(),
+              checked_index_cast<index_type>(Limits_t::max()));
+}
+
+TYPED_TEST(IndexWidthTest, out_of_range)
+{
+    using index_type = typename TestFixture::index_type;
+    using Limits_t   = typename TestFixture::Limits_t;
+
+    if (sizeof(index_type) < sizeof(ull_int))
+    {
+        const ull_int too_big = ull_int(Limits_t::max()) + 1;
+        EXPECT_THROW(checked_index_cast<index_type>(too_big),
+                     celeritas::RuntimeError);
+        if (sizeof(index_type) < sizeof(size_type))
+        {
+            EXPECT_THROW(checked_index_cast<index_type>(size_type(too_big)),
+                         celeritas::RuntimeError);
+        }
+    }
+    else
+    {
+        // Widest index type can represent every size
+        const ull_int max_value = std::numeric_limits<ull_int>::max();
+        EXPECT_EQ(max_value, checked_index_cast<index_type>(max_value));
+    }
+}
@@ -0,0 +1,211 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ParamsImage.test.cc
+//---------------------------------------------------------------------------//
+#include "base/ParamsImage.hh"
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "base/SpanRemapper.hh"
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+struct Leaf
+{
+    Span<const double> values;
+    int                tag;
+};
+
+struct Root
+{
+    Span<const Leaf> leaves;
+    Span<const int>  empty;
+    int              num_leaves;
+};
+
+class ParamsImageTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override
+    {
+        values = {1, 2, 3, 4, 5, 6};
+
+        ParamsImage result(ParamsImage::padded_size<Root>(1)
+                           + ParamsImage::padded_size<Leaf>(2)
+                           + ParamsImage::padded_size<double>(values.size()));
+        Root& root  = result.allocate<Root>(1).front();
+        auto  data  = result.insert(make_span(values));
+        auto leaves = result.allocate<Leaf>(2);
+
+        leaves[0].values = data.subspan(0, 2);
+        leaves[0].tag    = 10;
+        leaves[1].values = data.subspan(2);
+        leaves[1].tag    = 20;
+        for (Leaf& leaf : leaves)
+        {
+            result.add_relocation(leaf.values);
+        }
+
+        root.leaves     = leaves;
+        root.num_leaves = 2;
+        result.add_relocation(root.leaves);
+        result.add_relocation(root.empty);
+
+        image = std::move(result);
+    }
+
+    std::vector<double> values;
+    ParamsImage         image;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(ParamsImageTest, construction)
+{
+    EXPECT_EQ(0, ParamsImage::padded_size<char>(0));
+    EXPECT_EQ(16, ParamsImage::padded_size<char>(1));
+    EXPECT_EQ(48, ParamsImage::padded_size<double>(6));
+
+    EXPECT_EQ(image.capacity(), image.size());
+    // Empty span is not relocated
+    EXPECT_EQ(3, image.num_relocations());
+
+    Root root = image.root<Root>();
+    ASSERT_EQ(2, root.leaves.size());
+    EXPECT_EQ(2, root.num_leaves);
+    EXPECT_EQ(nullptr, root.empty.data());
+    EXPECT_EQ(10, root.leaves[0].tag);
+    EXPECT_VEC_EQ((std::vector<double>{1, 2}), root.leaves[0].values);
+    EXPECT_VEC_EQ((std::vector<double>{3, 4, 5, 6}), root.leaves[1].values);
+}
+
+TEST_F(ParamsImageTest, move)
+{
+    EXPECT_FALSE(std::is_copy_constructible<ParamsImage>::value);
+    EXPECT_FALSE(std::is_copy_assignable<ParamsImage>::value);
+
+    const Byte* orig_data = image.data().data();
+    size_type   orig_size = image.size();
+
+    // Stored pointers still refer to the moved buffer
+    ParamsImage moved(std::move(image));
+    EXPECT_EQ(orig_data, moved.data().data());
+    EXPECT_EQ(orig_size, moved.size());
+    EXPECT_EQ(0, image.size());
+    EXPECT_EQ(0, image.capacity());
+    EXPECT_EQ(0, image.num_relocations());
+
+    Root root = moved.root<Root>();
+    EXPECT_EQ(static_cast<const void*>(orig_data
+                                       + ParamsImage::padded_size<Root>(1)
+                                       + ParamsImage::padded_size<double>(6)),
+              static_cast<const void*>(root.leaves.data()));
+    EXPECT_VEC_EQ((std::vector<double>{3, 4, 5, 6}), root.leaves[1].values);
+
+    image = std::move(moved);
+    EXPECT_EQ(orig_data, image.data().data());
+    EXPECT_EQ(3, image.num_relocations());
+    EXPECT_EQ(0, moved.size());
+    EXPECT_EQ(20, image.root<Root>().leaves[1].tag);
+}
+
+TEST_F(ParamsImageTest, relocated)
+{
+    // Relocate into a new host buffer (as for shared memory)
+    std::vector<Byte> dst(image.size());
+    {
+        std::vector<Byte> temp = image.relocated(dst.data());
+        ASSERT_EQ(dst.size(), temp.size());
+        std::copy(temp.begin(), temp.end(), dst.begin());
+    }
+
+    // Original image still points to itself
+    EXPECT_EQ(static_cast<const void*>(image.data().data()
+                                       + ParamsImage::padded_size<Root>(1)
+                                       + ParamsImage::padded_size<double>(6)),
+              static_cast<const void*>(image.root<Root>().leaves.data()));
+
+    Root        root   = image.root<Root>(dst.data());
+    const Byte* leaves = reinterpret_cast<const Byte*>(root.leaves.data());
+    EXPECT_TRUE(leaves >= dst.data() && leaves < dst.data() + dst.size());
+    EXPECT_EQ(20, root.leaves[1].tag);
+    EXPECT_VEC_EQ((std::vector<double>{3, 4, 5, 6}), root.leaves[1].values);
+}
+
+TEST_F(ParamsImageTest, serialize)
+{
+    std::stringstream ss;
+    image.write(ss);
+    ParamsImage loaded = ParamsImage::read(ss);
+    EXPECT_EQ(image.size(), loaded.size());
+    EXPECT_EQ(image.num_relocations(), loaded.num_relocations());
+
+    Root root = loaded.root<Root>();
+    ASSERT_EQ(2, root.leaves.size());
+    EXPECT_EQ(20, root.leaves[1].tag);
+    EXPECT_VEC_EQ((std::vector<double>{1, 2}), root.leaves[0].values);
+    EXPECT_VEC_EQ((std::vector<double>{3, 4, 5, 6}), root.leaves[1].values);
+
+    // Serialized form is independent of the host address
+    std::stringstream ss2;
+    loaded.write(ss2);
+    EXPECT_EQ(ss.str(), ss2.str());
+}
+
+TEST_F(ParamsImageTest, read_corrupt)
+{
+    std::stringstream ss;
+    image.write(ss);
+    const std::string good = ss.str();
+
+    // Overwrite the 64-bit word at the given byte offset and try to read
+    auto read_modified = [&good](size_type pos, std::uint64_t value) {
+        std::string bad = good;
+        std::memcpy(&bad[pos], &value, sizeof(value));
+        std::istringstream is(bad);
+        return ParamsImage::read(is);
+    };
+
+    // Header claims more relocations than fit in the image
+    EXPECT_THROW(read_modified(8, std::uint64_t(1) << 60),
+                 celeritas::RuntimeError);
+    // Relocation offset past the end of the image
+    EXPECT_THROW(read_modified(16, image.size()), celeritas::RuntimeError);
+    // Stored pointer offset past the end of the image
+    const size_type first_reloc = 16 + 8 * image.num_relocations();
+    std::uint64_t   reloc_offset;
+    std::memcpy(&reloc_offset, &good[16], sizeof(reloc_offset));
+    EXPECT_THROW(read_modified(first_reloc + reloc_offset, image.size()),
+                 celeritas::RuntimeError);
+}
+
+TEST_F(ParamsImageTest, device)
+{
+#if !CELERITAS_USE_CUDA
+    EXPECT_THROW(image.copy_to_device(), celeritas::DebugError);
+    cout << "CUDA is disabled; skipping remainder of test." << endl;
+    return;
+#endif
+    DeviceAllocation device_image = image.copy_to_device();
+    EXPECT_EQ(image.size(), device_image.size());
+    Root root = image.root<Root>(device_image.device_pointers().data());
+    EXPECT_EQ(static_cast<const void*>(device_image.device_pointers().data()
+                                       + ParamsImage::padded_size<Root>(1)
+                                       + ParamsImage::padded_size<double>(6)),
+              static_cast<const void*>(root.leaves.data()));
+}
@@ -0,0 +1,108 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LivermoreParamsBuilder.test.cc
+//---------------------------------------------------------------------------//
+#include "io/LivermoreParamsBuilder.hh"
+
+#include "celeritas_test.hh"
+#include "base/Constants.hh"
+#include "base/Range.hh"
+#include "physics/material/MaterialParams.hh"
+
+using celeritas::ElementDefId;
+using celeritas::LivermoreParams;
+using celeritas::LivermoreParamsBuilder;
+using celeritas::LivermoreParamsReader;
+using celeritas::MaterialParams;
+using celeritas::MatterState;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class LivermoreParamsBuilderTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override
+    {
+        data_path_ = this->test_data_path("physics/em", "");
+    }
+
+    //! Materials with one element each, all with distinct atomic masses
+    MaterialParams::Input make_materials(std::vector<int> atomic_numbers)
+    {
+        using celeritas::units::AmuMass;
+        MaterialParams::Input inp;
+        for (int z : atomic_numbers)
+        {
+            inp.elements.push_back({z,
+                                    AmuMass{39.0983 + inp.elements.size()},
+                                    "Z" + std::to_string(z)});
+        }
+        for (auto i : celeritas::range<unsigned int>(atomic_numbers.size()))
+        {
+            inp.materials.push_back(
+                {1e-5 * celeritas::constants::na_avogadro,
+                 293.,
+                 MatterState::solid,
+                 {{ElementDefId{i}, 1.0}},
+                 "mat" + std::to_string(i)});
+        }
+        return inp;
+    }
+
+    std::string data_path_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(LivermoreParamsBuilderTest, duplicates)
+{
+    // Two distinct elements (different isotopes) share an atomic number
+    MaterialParams materials(this->make_materials({19, 19}));
+
+    LivermoreParamsReader  read_element(data_path_.c_str());
+    LivermoreParamsBuilder build_livermore(read_element);
+    LivermoreParams::Input inp = build_livermore(materials);
+    ASSERT_EQ(2, inp.elements.size());
+
+    const auto expected = read_element(19);
+    for (const auto& el : inp.elements)
+    {
+        EXPECT_EQ(expected.thresh_low.value(), el.thresh_low.value());
+        EXPECT_EQ(expected.thresh_high.value(), el.thresh_high.value());
+        ASSERT_EQ(expected.shells.size(), el.shells.size());
+        EXPECT_VEC_EQ(expected.shells.back().xs, el.shells.back().xs);
+        EXPECT_VEC_EQ(expected.xs_high.y, el.xs_high.y);
+    }
+
+    // Result can be used to construct the params
+    LivermoreParams livermore(inp);
+    EXPECT_EQ(2, livermore.host_pointers().elements.size());
+}
+
+TEST_F(LivermoreParamsBuilderTest, serial)
+{
+    MaterialParams materials(this->make_materials({19, 19, 19}));
+
+    LivermoreParamsBuilder build_livermore(
+        LivermoreParamsReader(data_path_.c_str()));
+    build_livermore.num_threads(1);
+    LivermoreParams::Input inp = build_livermore(materials);
+    EXPECT_EQ(3, inp.elements.size());
+}
+
+TEST_F(LivermoreParamsBuilderTest, missing)
+{
+    // There is no calcium data in the test directory
+    MaterialParams materials(this->make_materials({19, 20}));
+
+    LivermoreParamsBuilder build_livermore(
+        LivermoreParamsReader(data_path_.c_str()));
+    EXPECT_THROW(build_livermore(materials), celeritas::RuntimeError);
+}
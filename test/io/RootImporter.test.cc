@@ -251,3 +251,95 @@ TEST_F(RootImporterTest, import_material_params)
         EXPECT_SOFT_EQ(material.elements[i].fraction, fraction[i]);
     }
 }
+
+//---------------------------------------------------------------------------//
+TEST_F(RootImporterTest, remap_duplicate_materials)
+{
+    // Two copies of water and one of hydrogen gas, whose hydrogen is defined
+    // again under another name
+    GdmlGeometryMap geometry;
+    geometry.add_element(0, {"H", 1, 1.008, 0, 0});
+    geometry.add_element(1, {"O", 8, 15.999, 0, 0});
+    geometry.add_element(2, {"H_gas", 1, 1.008, 0, 0});
+
+    ImportMaterial water{};
+    water.name                   = "water";
+    water.state                  = ImportMaterialState::liquid;
+    water.temperature            = 293;
+    water.number_density         = 1e23;
+    water.elements_num_fractions = {{0, 2.0 / 3}, {1, 1.0 / 3}};
+    ImportMaterial water_copy    = water;
+    water_copy.name              = "water_copy";
+    ImportMaterial hydrogen{};
+    hydrogen.name                   = "hydrogen";
+    hydrogen.state                  = ImportMaterialState::gas;
+    hydrogen.temperature            = 100;
+    hydrogen.number_density         = 1e20;
+    hydrogen.elements_num_fractions = {{2, 1.0}};
+    geometry.add_material(0, water);
+    geometry.add_material(1, water_copy);
+    geometry.add_material(2, hydrogen);
+
+    for (vol_id vol : {0, 1, 2})
+    {
+        geometry.add_volume(vol, {"volume", "solid"});
+        geometry.link_volume_material(vol, vol);
+    }
+
+    // Physics table with one vector per imported material
+    ImportPhysicsTable table;
+    table.table_type = ImportTableType::lambda;
+    for (real_type y : {1.0, 2.0, 3.0})
+    {
+        table.physics_vectors.push_back(
+            {ImportPhysicsVectorType::log, {1.0}, {y}});
+    }
+    std::vector<ImportProcess> processes(1);
+    processes[0].tables.push_back(table);
+
+    // Materials constructed in the imported order
+    MaterialParams::Input input;
+    input.elements = {{1, units::AmuMass{1.008}, "H"},
+                      {8, units::AmuMass{15.999}, "O"},
+                      {1, units::AmuMass{1.008}, "H_gas"}};
+    for (const auto& mat_key : geometry.matid_to_material_map())
+    {
+        const ImportMaterial& mat = mat_key.second;
+        MaterialParams::MaterialInput mat_input;
+        mat_input.name           = mat.name;
+        mat_input.temperature    = mat.temperature;
+        mat_input.number_density = mat.number_density;
+        mat_input.matter_state   = MatterState::unspecified;
+        for (const auto& el_key : mat.elements_num_fractions)
+        {
+            mat_input.elements_fractions.push_back(
+                {ElementDefId{el_key.first}, el_key.second});
+        }
+        input.materials.push_back(mat_input);
+    }
+    MaterialParams materials(input);
+    ASSERT_EQ(2, materials.num_elements());
+    ASSERT_EQ(2, materials.num_materials());
+
+    // Both hydrogen definitions resolve to the same stored element
+    EXPECT_EQ(ElementDefId{0}, materials.find_element("H"));
+    EXPECT_EQ(ElementDefId{0}, materials.find_element("H_gas"));
+    EXPECT_EQ("H", materials.id_to_label(ElementDefId{0}));
+
+    remap_material_ids(materials, &geometry, &processes);
+
+    // Volumes point at the stored material IDs
+    EXPECT_EQ(0, geometry.get_matid(0));
+    EXPECT_EQ(0, geometry.get_matid(1));
+    EXPECT_EQ(1, geometry.get_matid(2));
+    ASSERT_EQ(2, geometry.matid_to_material_map().size());
+    EXPECT_EQ("water", geometry.get_material(0).name);
+    EXPECT_EQ("hydrogen", geometry.get_material(1).name);
+    EXPECT_EQ(materials.find("hydrogen").get(), geometry.get_matid(2));
+
+    // Physics vectors are indexed by stored material ID
+    const auto& vectors = processes[0].tables[0].physics_vectors;
+    ASSERT_EQ(2, vectors.size());
+    EXPECT_SOFT_EQ(1.0, vectors[0].y[0]);
+    EXPECT_SOFT_EQ(3.0, vectors[1].y[0]);
+}
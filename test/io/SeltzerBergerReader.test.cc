@@ -0,0 +1,43 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SeltzerBergerReader.test.cc
+//---------------------------------------------------------------------------//
+#include "io/SeltzerBergerReader.hh"
+
+#include <fstream>
+#include "celeritas_test.hh"
+
+using celeritas::SeltzerBergerReader;
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(SeltzerBergerReaderTest, read)
+{
+    // Write a small table in the layout of the Geant4 data files
+    {
+        std::ofstream out("br13");
+        out << "0 3 2\n"
+               "1e-12 0.5 1\n"
+               "-6.9 0\n"
+               "7.1 6.2 2.5\n"
+               "7.9 6.8 3.3\n";
+    }
+
+    SeltzerBergerReader read_element(".");
+    const auto          result = read_element(13);
+
+    const double expected_x[]          = {1e-12, 0.5, 1};
+    const double expected_log_energy[] = {-6.9, 0};
+    const double expected_value[]      = {7.1, 6.2, 2.5, 7.9, 6.8, 3.3};
+    EXPECT_VEC_SOFT_EQ(expected_x, result.x);
+    EXPECT_VEC_SOFT_EQ(expected_log_energy, result.log_energy);
+    EXPECT_VEC_SOFT_EQ(expected_value, result.value);
+
+    // There is no file for hydrogen
+    EXPECT_THROW(read_element(1), celeritas::RuntimeError);
+}
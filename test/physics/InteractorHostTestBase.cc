@@ -10,7 +10,7 @@
 #include "base/ArrayUtils.hh"
 #include "physics/base/SecondaryAllocatorView.hh"
 #include "physics/base/Interaction.hh"
-#include "physics/base/Secondary.hh"
+#include "physics/base/PackedSecondary.hh"
 #include "physics/base/ParticleTrackView.hh"
 #include "physics/material/MaterialTrackView.hh"
 #include "gtest/detail/Macros.hh"
@@ -163,8 +163,9 @@ void InteractorHostTestBase::check_conservation(const Interaction& interaction)
     }
 
     // Subtract contributions from exiting secondaries
-    for (const Secondary& s : interaction.secondaries)
+    for (const SecondaryRecord& record : interaction.secondaries)
     {
+        const Secondary s(record);
         local_state.def_id = s.def_id;
         local_state.energy = s.energy;
         ParticleTrackView secondary_track(
@@ -176,13 +177,21 @@ void InteractorHostTestBase::check_conservation(const Interaction& interaction)
     // Compare against incident particle
     {
         ParticleTrackView parent_track(pp_pointers_, ps_pointers_, ThreadId{0});
-        EXPECT_SOFT_EQ(parent_track.energy().value(), exit_energy);
-
+        EXPECT_SOFT_NEAR(
+            parent_track.energy().value(), exit_energy, secondary_tol());
+
+        const real_type p = parent_track.momentum().value();
+#if CELERITAS_COMPACT_INITIALIZERS
+        // Quantized secondary directions give an error proportional to p
+        const real_type momentum_tol = p * 1e-7;
+#else
+        const real_type momentum_tol = 1e-12;
+#endif
         Real3 delta_momentum = exit_momentum;
-        axpy(-parent_track.momentum().value(), inc_direction_, &delta_momentum);
+        axpy(-p, inc_direction_, &delta_momentum);
         EXPECT_SOFT_NEAR(0.0,
                          dot_product(delta_momentum, delta_momentum),
-                         parent_track.momentum().value() * 1e-12)
+                         p * momentum_tol)
             << "Incident: " << inc_direction_
             << " with p = " << parent_track.momentum().value()
             << "* MeV/c; exiting p = " << exit_momentum;
@@ -10,6 +10,7 @@
 #include <memory>
 #include <random>
 #include <vector>
+#include "celeritas_config.h"
 #include "base/Array.hh"
 #include "base/ArrayIO.hh"
 #include "base/Span.hh"
@@ -17,7 +18,7 @@
 #include "base/Types.hh"
 #include "physics/base/ParticleParams.hh"
 #include "physics/base/ParticleStatePointers.hh"
-#include "physics/base/Secondary.hh"
+#include "physics/base/PackedSecondary.hh"
 #include "physics/base/Units.hh"
 #include "physics/material/MaterialParams.hh"
 #include "physics/material/MaterialStatePointers.hh"
@@ -34,7 +35,6 @@ class StackAllocatorView;
 class ParticleTrackView;
 class MaterialTrackView;
 struct Interaction;
-struct Secondary;
 } // namespace celeritas
 
 namespace celeritas_test
@@ -65,10 +65,12 @@ class InteractorHostTestBase : public celeritas::Test
     using ParticleTrackView      = celeritas::ParticleTrackView;
     using Real3                  = celeritas::Real3;
     using Secondary              = celeritas::Secondary;
-    using SecondaryAllocatorView = celeritas::StackAllocatorView<Secondary>;
-    using constSpanSecondaries   = celeritas::Span<const Secondary>;
+    using SecondaryRecord        = celeritas::SecondaryRecord;
+    using SecondaryAllocatorView
+        = celeritas::StackAllocatorView<SecondaryRecord>;
+    using constSpanSecondaries   = celeritas::Span<const SecondaryRecord>;
 
-    using HostSecondaryStore = HostStackAllocatorStore<Secondary>;
+    using HostSecondaryStore = HostStackAllocatorStore<SecondaryRecord>;
     //!@}
 
   public:
@@ -123,6 +125,16 @@ class InteractorHostTestBase : public celeritas::Test
     }
     //!@}
 
+    //! Relative tolerance for energies and directions stored in secondaries
+    static constexpr real_type secondary_tol()
+    {
+#if CELERITAS_COMPACT_INITIALIZERS
+        return 1e-3;
+#else
+        return 1e-12;
+#endif
+    }
+
     //!@{
     //! Random number generator
     RandomEngine& rng() { return rng_; }
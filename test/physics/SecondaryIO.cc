@@ -28,5 +28,14 @@ std::ostream& operator<<(std::ostream& os, const Secondary& s)
     return os;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Write a host-side PackedSecondary to a stream for debugging.
+ */
+std::ostream& operator<<(std::ostream& os, const PackedSecondary& s)
+{
+    return os << "Packed" << static_cast<Secondary>(s);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
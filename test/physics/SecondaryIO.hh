@@ -8,7 +8,7 @@
 #pragma once
 
 #include <iosfwd>
-#include "physics/base/Secondary.hh"
+#include "physics/base/PackedSecondary.hh"
 
 namespace celeritas
 {
@@ -16,5 +16,8 @@ namespace celeritas
 // Write a host-side Secondary to a stream for debugging.
 std::ostream& operator<<(std::ostream& os, const Secondary& s);
 
+// Write a host-side PackedSecondary to a stream for debugging.
+std::ostream& operator<<(std::ostream& os, const PackedSecondary& s);
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -0,0 +1,179 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file Cut.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/base/CutParams.hh"
+#include "physics/base/CutView.hh"
+
+#include <memory>
+#include "celeritas_test.hh"
+#include "base/Constants.hh"
+#include "base/Range.hh"
+
+using namespace celeritas;
+using celeritas::units::AmuMass;
+using celeritas::units::MevEnergy;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class CutTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override
+    {
+        constexpr auto zero   = zero_quantity();
+        constexpr auto stable = ParticleDef::stable_decay_constant();
+
+        particles = std::make_shared<ParticleParams>(ParticleParams::Input{
+            {"electron",
+             pdg::electron(),
+             units::MevMass{0.5109989461},
+             units::ElementaryCharge{-1},
+             stable},
+            {"gamma", pdg::gamma(), zero, zero, stable},
+            {"proton",
+             pdg::proton(),
+             units::MevMass{938.27208816},
+             units::ElementaryCharge{1},
+             stable},
+            {"positron",
+             pdg::positron(),
+             units::MevMass{0.5109989461},
+             units::ElementaryCharge{1},
+             stable}});
+
+        // Number densities from the NIST material densities
+        auto number_density = [](real_type density, real_type amu_mass) {
+            return density / (amu_mass * constants::atomic_mass);
+        };
+        MaterialParams::Input inp;
+        inp.elements  = {{1, AmuMass{1.008}, "H"},
+                        {8, AmuMass{15.999}, "O"},
+                        {13, AmuMass{26.9815385}, "Al"},
+                        {82, AmuMass{207.2}, "Pb"}};
+        inp.materials = {
+            {3 * number_density(1.0, 18.015),
+             293.0,
+             MatterState::liquid,
+             {{ElementDefId{0}, 2. / 3}, {ElementDefId{1}, 1. / 3}},
+             "water"},
+            {number_density(2.699, 26.9815385),
+             293.0,
+             MatterState::solid,
+             {{ElementDefId{2}, 1.0}},
+             "Al"},
+            {number_density(11.35, 207.2),
+             293.0,
+             MatterState::solid,
+             {{ElementDefId{3}, 1.0}},
+             "Pb"},
+            {0, 0, MatterState::unspecified, {}, "hard vacuum"},
+        };
+        materials = std::make_shared<MaterialParams>(std::move(inp));
+    }
+
+    std::shared_ptr<ParticleParams> particles;
+    std::shared_ptr<MaterialParams> materials;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(CutTest, default_cuts)
+{
+    CutParams cuts(*particles, *materials, CutParams::Input{});
+    auto      data = cuts.host_pointers();
+    EXPECT_EQ(4, data.num_particles);
+    ASSERT_EQ(4 * 4, data.energy.size());
+
+    const ParticleDefId electron = particles->find(pdg::electron());
+    const ParticleDefId gamma    = particles->find(pdg::gamma());
+    const ParticleDefId proton   = particles->find(pdg::proton());
+    const ParticleDefId positron = particles->find(pdg::positron());
+
+    std::vector<real_type> energies;
+    for (auto mat_idx : range(materials->num_materials()))
+    {
+        CutView view(data, MaterialDefId(mat_idx));
+        for (ParticleDefId pid : {gamma, electron, positron})
+        {
+            energies.push_back(view.energy(pid).value());
+            EXPECT_SOFT_EQ(0.07, view.range(pid));
+        }
+        EXPECT_EQ(0, view.energy(proton).value());
+        EXPECT_EQ(0, view.range(proton));
+    }
+
+    const double expected_energies[] = {0.00251944368999953,
+                                        0.276265024276672,
+                                        0.270751237197752,
+                                        0.00585564265699862,
+                                        0.460395204472304,
+                                        0.442201161837935,
+                                        0.0945861383105694,
+                                        1.0038644857808,
+                                        0.95132127129134,
+                                        0.00099,
+                                        0.00099,
+                                        0.00099};
+    EXPECT_VEC_SOFT_EQ(expected_energies, energies);
+}
+
+TEST_F(CutTest, geant4_reference)
+{
+    CutParams::Input inp;
+    inp.gamma    = 1 * units::millimeter;
+    inp.electron = 1 * units::millimeter;
+    inp.positron = 1 * units::millimeter;
+
+    CutParams cuts(*particles, *materials, inp);
+    const ParticleDefId electron = particles->find(pdg::electron());
+    const ParticleDefId gamma    = particles->find(pdg::gamma());
+    const ParticleDefId positron = particles->find(pdg::positron());
+
+    std::vector<real_type> energies;
+    for (auto mat_id : {MaterialDefId{0}, MaterialDefId{2}})
+    {
+        CutView view(cuts.host_pointers(), mat_id);
+        for (ParticleDefId pid : {gamma, electron, positron})
+        {
+            energies.push_back(view.energy(pid).value());
+        }
+    }
+
+    // Thresholds printed by Geant4 10 for G4_WATER and G4_Pb
+    const double expected_energies[] = {
+        2.94056e-3, 0.351877, 0.342545, 0.101843, 1.36749, 1.27862};
+    EXPECT_VEC_NEAR(expected_energies, energies, 1e-5);
+}
+
+TEST_F(CutTest, custom_cuts)
+{
+    CutParams::Input inp;
+    inp.gamma    = 1 * units::centimeter;
+    inp.electron = 1e-3 * units::millimeter;
+    inp.positron = 10 * units::meter;
+
+    CutParams cuts(*particles, *materials, inp);
+    CutView   water(cuts.host_pointers(), MaterialDefId{0});
+
+    const ParticleDefId electron = particles->find(pdg::electron());
+    const ParticleDefId gamma    = particles->find(pdg::gamma());
+    const ParticleDefId positron = particles->find(pdg::positron());
+    EXPECT_SOFT_EQ(1, water.range(gamma));
+    EXPECT_SOFT_EQ(1e-4, water.range(electron));
+    EXPECT_SOFT_EQ(1000, water.range(positron));
+
+    // Larger cuts give higher thresholds, bounded by the energy grid
+    EXPECT_SOFT_EQ(0.007739122255315996, water.energy(gamma).value());
+    EXPECT_SOFT_EQ(CutParams::min_energy().value(),
+                   water.energy(electron).value());
+    EXPECT_SOFT_EQ(CutParams::max_energy().value(),
+                   water.energy(positron).value());
+}
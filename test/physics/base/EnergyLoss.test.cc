@@ -0,0 +1,335 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EnergyLoss.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/base/EnergyLossParams.hh"
+#include "physics/base/EnergyLossCalculator.hh"
+#include "physics/base/IntegralXsCalculator.hh"
+#include "physics/base/InverseRangeCalculator.hh"
+#include "physics/base/PostStepEnergyCalculator.hh"
+#include "physics/base/RangeCalculator.hh"
+#include "physics/base/RangeStepLimiter.hh"
+#include "physics/material/MaterialTrackView.hh"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include "celeritas_test.hh"
+#include "base/Range.hh"
+#include "base/Span.hh"
+#include "base/Units.hh"
+
+using namespace celeritas;
+using celeritas::units::AmuMass;
+using celeritas::units::MevEnergy;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class EnergyLossTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override
+    {
+        MaterialParams::Input mat_inp;
+        mat_inp.elements  = {{13, AmuMass{26.9815385}, "Al"}};
+        mat_inp.materials = {
+            {6.0221e22,
+             293.0,
+             MatterState::solid,
+             {{ElementDefId{0}, 1.0}},
+             "Al"},
+            {0, 0, MatterState::unspecified, {}, "hard vacuum"},
+        };
+        materials = std::make_shared<MaterialParams>(std::move(mat_inp));
+
+        // Tracks in aluminum, vacuum, and aluminum at twice the density
+        const MaterialTrackInitializer mat_init[]
+            = {{aluminum, 1}, {vacuum, 1}, {aluminum, 2}};
+        mat_params = materials->host_pointers();
+        mat_state.resize(3);
+        mat_scratch.resize(mat_state.size()
+                           * materials->max_element_components());
+        mat_states.state           = make_span(mat_state);
+        mat_states.element_scratch = make_span(mat_scratch);
+        for (auto i : range(3))
+        {
+            this->material_track(ThreadId(i)) = mat_init[i];
+        }
+
+        // Stopping power proportional to velocity: the range is sqrt(E)/c
+        inp.log_energy = {201, std::log(1e-3), std::log(1e5) / 200};
+        const UniformGrid loge_grid(inp.log_energy);
+        auto build_dedx = [&loge_grid](real_type c) {
+            std::vector<real_type> dedx;
+            for (auto i : range(loge_grid.size()))
+            {
+                dedx.push_back(2 * c * std::sqrt(std::exp(loge_grid[i])));
+            }
+            // No loss in vacuum
+            dedx.resize(2 * loge_grid.size(), 0);
+            return dedx;
+        };
+        inp.particles = {{electron, build_dedx(1), {}},
+                         {positron, build_dedx(2), {}}};
+    }
+
+    //! Analytic range [cm]
+    real_type calc_exact_range(real_type c, real_type energy) const
+    {
+        return std::sqrt(energy) / c;
+    }
+
+    //! Material view of the track in the given state
+    MaterialTrackView material_track(ThreadId tid) const
+    {
+        return MaterialTrackView(mat_params, mat_states, tid);
+    }
+
+    const ParticleDefId electron{0};
+    const ParticleDefId gamma{1};
+    const ParticleDefId positron{2};
+    const MaterialDefId aluminum{0};
+    const MaterialDefId vacuum{1};
+    const ThreadId      in_aluminum{0};
+    const ThreadId      in_vacuum{1};
+    const ThreadId      in_dense_aluminum{2};
+
+    std::shared_ptr<MaterialParams> materials;
+    EnergyLossParams::Input         inp;
+    MaterialParamsPointers          mat_params;
+    std::vector<MaterialTrackState> mat_state;
+    std::vector<real_type>          mat_scratch;
+    MaterialStatePointers           mat_states;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(EnergyLossTest, params)
+{
+    EnergyLossParams params(*materials, inp);
+    auto             data = params.host_pointers();
+
+    ASSERT_EQ(3, data.particle_tables.size());
+    EXPECT_EQ(EnergyLossTableId{0}, data.particle_tables[electron.get()]);
+    EXPECT_FALSE(data.particle_tables[gamma.get()]);
+    EXPECT_EQ(EnergyLossTableId{1}, data.particle_tables[positron.get()]);
+    EXPECT_EQ(2, data.num_materials);
+    EXPECT_EQ(2 * 2 * 201, data.range.size());
+    EXPECT_SOFT_EQ(0.2, data.max_step_over_range);
+    EXPECT_SOFT_EQ(0.1, data.min_step);
+
+    // Vacuum has infinite range
+    const real_type inf    = std::numeric_limits<real_type>::infinity();
+    size_type       offset = data.row_offset(positron, vacuum);
+    EXPECT_EQ(inf, data.range[offset]);
+    EXPECT_EQ(inf, data.range[offset + 200]);
+}
+
+TEST_F(EnergyLossTest, calculators)
+{
+    EnergyLossParams params(*materials, inp);
+    auto             data = params.host_pointers();
+
+    for (real_type c : {1, 2})
+    {
+        ParticleDefId     pid      = (c == 1 ? electron : positron);
+        MaterialTrackView material = this->material_track(in_aluminum);
+
+        EnergyLossCalculator   calc_dedx(data, pid, material);
+        RangeCalculator        calc_range(data, pid, material);
+        InverseRangeCalculator calc_energy(data, pid, material);
+
+        for (real_type e : {1e-4, 1e-3, 2.5e-3, 0.1, 1.0, 12.3, 99.9})
+        {
+            EXPECT_SOFT_NEAR(
+                2 * c * std::sqrt(e), calc_dedx(MevEnergy{e}), 1e-4)
+                << "at E=" << e;
+            real_type range = calc_range(MevEnergy{e});
+            EXPECT_SOFT_NEAR(calc_exact_range(c, e), range, 1e-4)
+                << "at E=" << e;
+            EXPECT_SOFT_NEAR(e, calc_energy(range).value(), 1e-4)
+                << "at E=" << e;
+        }
+
+        // Clamp above the grid
+        EXPECT_SOFT_EQ(calc_dedx(MevEnergy{100}), calc_dedx(MevEnergy{1e3}));
+        EXPECT_SOFT_EQ(100, calc_energy(1e3).value());
+        EXPECT_SOFT_EQ(0, calc_energy(0).value());
+    }
+}
+
+TEST_F(EnergyLossTest, density_scale)
+{
+    EnergyLossParams params(*materials, inp);
+    auto             data = params.host_pointers();
+
+    MaterialTrackView material = this->material_track(in_aluminum);
+    MaterialTrackView dense    = this->material_track(in_dense_aluminum);
+
+    EnergyLossCalculator   calc_dedx(data, electron, material);
+    RangeCalculator        calc_range(data, electron, material);
+    EnergyLossCalculator   calc_dense_dedx(data, electron, dense);
+    RangeCalculator        calc_dense_range(data, electron, dense);
+    InverseRangeCalculator calc_dense_energy(data, electron, dense);
+    for (real_type e : {1e-4, 0.1, 12.3})
+    {
+        // Stopping power is proportional to the density, range inversely
+        EXPECT_SOFT_EQ(2 * calc_dedx(MevEnergy{e}),
+                       calc_dense_dedx(MevEnergy{e}));
+        real_type range = calc_dense_range(MevEnergy{e});
+        EXPECT_SOFT_EQ(calc_range(MevEnergy{e}) / 2, range);
+        EXPECT_SOFT_NEAR(e, calc_dense_energy(range).value(), 1e-4);
+    }
+
+    // Large steps in the dense material: half the range is a quarter energy
+    PostStepEnergyCalculator calc_energy(data, electron, dense);
+    const MevEnergy          energy{4.0};
+    const real_type          range = calc_dense_range(energy);
+    EXPECT_SOFT_NEAR(1.0, calc_energy(energy, range, range / 2).value(), 1e-4);
+}
+
+TEST_F(EnergyLossTest, step_limit)
+{
+    inp.min_step = 1e-2;
+    EnergyLossParams params(*materials, inp);
+    RangeStepLimiter calc_limit(params.host_pointers());
+
+    // Short ranges are not limited
+    EXPECT_SOFT_EQ(0, calc_limit(0));
+    EXPECT_SOFT_EQ(5e-3, calc_limit(5e-3));
+    EXPECT_SOFT_EQ(1e-2, calc_limit(1e-2));
+
+    // Approaches the range fraction at long ranges
+    EXPECT_SOFT_EQ(0.2 * 0.02 + 0.01 * 0.8 * 1.5, calc_limit(0.02));
+    EXPECT_SOFT_EQ(0.2 * 10 + 0.01 * 0.8 * 1.999, calc_limit(10));
+    for (real_type r : {0.011, 0.1, 1.0, 10.0})
+    {
+        EXPECT_LT(calc_limit(r), r);
+    }
+}
+
+TEST_F(EnergyLossTest, post_step_energy)
+{
+    EnergyLossParams params(*materials, inp);
+    auto             data = params.host_pointers();
+
+    MaterialTrackView        material = this->material_track(in_aluminum);
+    EnergyLossCalculator     calc_dedx(data, electron, material);
+    RangeCalculator          calc_range(data, electron, material);
+    PostStepEnergyCalculator calc_energy(data, electron, material);
+
+    const MevEnergy energy{4.0};
+    const real_type range = calc_range(energy);
+
+    // Small steps lose energy linearly
+    real_type step = 1e-4;
+    EXPECT_SOFT_EQ(4.0 - step * calc_dedx(energy),
+                   calc_energy(energy, range, step).value());
+
+    // Large steps use the inverse range: half the range is a quarter energy
+    EXPECT_SOFT_NEAR(1.0, calc_energy(energy, range, range / 2).value(), 1e-4);
+    EXPECT_SOFT_NEAR(
+        4.0 * 0.81, calc_energy(energy, range, 0.1 * range).value(), 1e-3);
+
+    // The particle stops after traveling its range
+    EXPECT_EQ(0, calc_energy(energy, range, range).value());
+    EXPECT_EQ(0, calc_energy(energy, range, 2 * range).value());
+
+    // There is no step limit or energy loss in vacuum
+    MaterialTrackView        in_vac = this->material_track(in_vacuum);
+    RangeCalculator          calc_vacuum_range(data, electron, in_vac);
+    PostStepEnergyCalculator calc_vacuum_energy(data, electron, in_vac);
+    const real_type          vacuum_range = calc_vacuum_range(energy);
+    for (real_type e : {1e-4, 0.5, 1e3})
+    {
+        EXPECT_EQ(vacuum_range, calc_vacuum_range(MevEnergy{e}));
+    }
+    EXPECT_EQ(std::numeric_limits<real_type>::infinity(), vacuum_range);
+    EXPECT_EQ(vacuum_range, RangeStepLimiter(data)(vacuum_range));
+    EXPECT_EQ(4.0, calc_vacuum_energy(energy, vacuum_range, 1e10).value());
+}
+
+TEST_F(EnergyLossTest, integral_xs)
+{
+    // Cross section peaked at 1 MeV for electrons in aluminum only
+    auto calc_exact_xs = [](real_type e) { return 1 / (e + 1 / e); };
+    {
+        const UniformGrid      loge_grid(inp.log_energy);
+        std::vector<real_type> xs;
+        for (auto i : range(loge_grid.size()))
+        {
+            xs.push_back(calc_exact_xs(std::exp(loge_grid[i])));
+        }
+        xs.resize(2 * loge_grid.size(), 0);
+        inp.particles[0].xs = std::move(xs);
+    }
+    EnergyLossParams params(*materials, inp);
+    auto             data = params.host_pointers();
+    EXPECT_SOFT_EQ(0.8, data.min_energy_fraction);
+
+    MaterialTrackView    material = this->material_track(in_aluminum);
+    IntegralXsCalculator calc_xs(data, electron, material);
+    for (real_type e : {1e-2, 0.5, 1.0, 2.0, 30.0})
+    {
+        // Interpolated cross section
+        EXPECT_SOFT_NEAR(calc_exact_xs(e), calc_xs(MevEnergy{e}), 1e-3);
+
+        // Bound holds over the step energies and is reasonably tight
+        real_type exact_max = 0;
+        for (auto i : range(101))
+        {
+            real_type post_energy = e * (1 - 0.2 * i / 100.0);
+            exact_max = std::max(exact_max, calc_xs(MevEnergy{post_energy}));
+        }
+        real_type xs_max = calc_xs.max_xs(MevEnergy{e});
+        EXPECT_LE(exact_max, xs_max) << "at E=" << e;
+        EXPECT_SOFT_NEAR(exact_max, xs_max, 0.1) << "at E=" << e;
+    }
+
+    // Decreasing cross section: bound is the value at the low end
+    const UniformGrid loge_grid(inp.log_energy);
+    const size_type   bin = loge_grid.find(std::log(30.0));
+    EXPECT_SOFT_NEAR(calc_exact_xs(0.8 * std::exp(loge_grid[bin])),
+                     calc_xs.max_xs(MevEnergy{30}),
+                     1e-3);
+
+    // Clamp outside the grid
+    EXPECT_SOFT_EQ(calc_xs(MevEnergy{1e-3}), calc_xs(MevEnergy{1e-4}));
+    EXPECT_SOFT_EQ(calc_xs(MevEnergy{100}), calc_xs(MevEnergy{1e3}));
+    EXPECT_SOFT_EQ(calc_xs(MevEnergy{80}), calc_xs.max_xs(MevEnergy{1e3}));
+
+    // Particles without discrete processes and vacuum don't interact
+    IntegralXsCalculator calc_positron_xs(data, positron, material);
+    IntegralXsCalculator calc_vacuum_xs(
+        data, electron, this->material_track(in_vacuum));
+    EXPECT_EQ(0, calc_positron_xs.max_xs(MevEnergy{1}));
+    EXPECT_EQ(0, calc_vacuum_xs.max_xs(MevEnergy{1}));
+
+    // Cross section and bound are proportional to the density
+    IntegralXsCalculator calc_dense_xs(
+        data, electron, this->material_track(in_dense_aluminum));
+    EXPECT_SOFT_EQ(2 * calc_xs(MevEnergy{0.5}), calc_dense_xs(MevEnergy{0.5}));
+    EXPECT_SOFT_EQ(2 * calc_xs.max_xs(MevEnergy{0.5}),
+                   calc_dense_xs.max_xs(MevEnergy{0.5}));
+
+    // Acceptance rate is the ratio of the post-step cross section to the bound
+    std::mt19937    rng;
+    const real_type xs_max       = calc_xs.max_xs(MevEnergy{10});
+    const int       num_samples  = 10000;
+    int             num_accepted = 0;
+    for (int i = 0; i < num_samples; ++i)
+    {
+        num_accepted += calc_xs.accept(MevEnergy{9}, xs_max, rng);
+    }
+    EXPECT_SOFT_NEAR(calc_xs(MevEnergy{9}) / xs_max,
+                     real_type(num_accepted) / num_samples,
+                     0.02);
+}
@@ -0,0 +1,289 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file InteractionDriver.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/base/InteractionDriver.hh"
+
+#include <memory>
+#include <random>
+#include <vector>
+#include "celeritas_test.hh"
+#include "base/Range.hh"
+#include "base/Units.hh"
+#include "io/LivermoreParamsReader.hh"
+#include "physics/base/ModelDispatcher.hh"
+#include "physics/base/ParticleParams.hh"
+#include "physics/em/BetheHeitlerLauncher.hh"
+#include "physics/em/LivermoreParams.hh"
+#include "physics/em/PhotoelectricLauncher.hh"
+#include "physics/em/detail/EPlusGGLauncher.hh"
+#include "physics/em/detail/KleinNishinaLauncher.hh"
+#include "physics/material/MaterialParams.hh"
+#include "../../base/HostStackAllocatorStore.hh"
+
+using namespace celeritas;
+using celeritas::detail::EPlusGGLauncher;
+using celeritas::detail::KleinNishinaLauncher;
+using celeritas::units::MevEnergy;
+using celeritas_test::HostStackAllocatorStore;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class InteractionDriverTest : public celeritas::Test
+{
+  protected:
+    using Dispatcher = ModelDispatcher<KleinNishinaLauncher, EPlusGGLauncher>;
+
+    void SetUp() override
+    {
+        using namespace celeritas::units;
+        constexpr auto zero   = zero_quantity();
+        constexpr auto stable = ParticleDef::stable_decay_constant();
+
+        particles = std::make_shared<ParticleParams>(ParticleParams::Input{
+            {"electron",
+             pdg::electron(),
+             MevMass{0.5109989461},
+             ElementaryCharge{-1},
+             stable},
+            {"gamma", pdg::gamma(), zero, zero, stable},
+            {"positron",
+             pdg::positron(),
+             MevMass{0.5109989461},
+             ElementaryCharge{1},
+             stable}});
+        electron = particles->find(pdg::electron());
+        gamma    = particles->find(pdg::gamma());
+        positron = particles->find(pdg::positron());
+
+        MaterialParams::Input mat_inp;
+        mat_inp.elements  = {{19, AmuMass{39.0983}, "K"},
+                            {1, AmuMass{1.008}, "H"}};
+        mat_inp.materials = {{1e-5 * constants::na_avogadro,
+                              100.0,
+                              MatterState::gas,
+                              {{ElementDefId{1}, 1.0}},
+                              "H2"},
+                             {1e-5 * constants::na_avogadro,
+                              293.0,
+                              MatterState::solid,
+                              {{ElementDefId{0}, 1.0}},
+                              "K"}};
+        materials = std::make_shared<MaterialParams>(std::move(mat_inp));
+
+        kn.model_id          = ModelId{0};
+        kn.inv_electron_mass = 1 / 0.5109989461;
+        kn.electron_id       = electron;
+        kn.gamma_id          = gamma;
+
+        epgg.model_id      = ModelId{1};
+        epgg.electron_mass = 0.5109989461;
+        epgg.positron_id   = positron;
+        epgg.gamma_id      = gamma;
+
+        // Livermore data is only available for potassium, so only tracks in
+        // the potassium material can use the photoelectric model
+        LivermoreParams::Input li;
+        LivermoreParamsReader  read_element_data(
+            this->test_data_path("physics/em", "").c_str());
+        li.elements.push_back(read_element_data(19));
+        livermore = std::make_shared<LivermoreParams>(std::move(li));
+
+        pe.model                    = ModelId{2};
+        pe.shared.inv_electron_mass = 1 / 0.5109989461;
+        pe.shared.electron_id       = electron;
+        pe.shared.gamma_id          = gamma;
+        pe.data                     = livermore->host_pointers();
+
+        bh.model                    = ModelId{3};
+        bh.shared.inv_electron_mass = 1 / 0.5109989461;
+        bh.shared.electron_id       = electron;
+        bh.shared.positron_id       = positron;
+        bh.shared.gamma_id          = gamma;
+
+        secondaries.resize(16);
+    }
+
+    //! Add a track that selected the given model
+    void add_track(ParticleDefId def_id,
+                   real_type     energy,
+                   ModelId       model,
+                   MaterialDefId mat = MaterialDefId{0})
+    {
+        ParticleTrackState particle;
+        particle.def_id = def_id;
+        particle.energy = MevEnergy{energy};
+        particle_states.push_back(particle);
+
+        mat_states.push_back({mat, 1});
+        mat_scratch.resize(mat_states.size()
+                           * materials->max_element_components());
+
+        PhysicsTrackState physics;
+        physics.model_id = model;
+        physics_states.push_back(physics);
+
+        directions.push_back({0, 0, 1});
+        rng_states.push_back({});
+        results.push_back(Interaction::from_failure());
+    }
+
+    //! Get pointers to the interaction inputs and outputs
+    ModelInteractPointers pointers()
+    {
+        ModelInteractPointers result;
+        result.params.particle                 = particles->host_pointers();
+        result.params.material                 = materials->host_pointers();
+        result.states.particle.vars            = make_span(particle_states);
+        result.states.material.state           = make_span(mat_states);
+        result.states.material.element_scratch = make_span(mat_scratch);
+        result.states.physics.state            = make_span(physics_states);
+        result.states.direction                = make_span(directions);
+        result.states.rng.rng                  = make_span(rng_states);
+        result.secondaries                     = secondaries.host_pointers();
+        result.result                          = make_span(results);
+        return result;
+    }
+
+    std::shared_ptr<ParticleParams> particles;
+    std::shared_ptr<MaterialParams> materials;
+    ParticleDefId                   electron;
+    ParticleDefId                   gamma;
+    ParticleDefId                   positron;
+    detail::KleinNishinaPointers    kn;
+    detail::EPlusGGPointers         epgg;
+    std::shared_ptr<LivermoreParams> livermore;
+    PhotoelectricLauncher            pe;
+    BetheHeitlerLauncher             bh;
+
+    std::vector<ParticleTrackState>    particle_states;
+    std::vector<MaterialTrackState>    mat_states;
+    std::vector<real_type>             mat_scratch;
+    std::vector<PhysicsTrackState>     physics_states;
+    std::vector<Real3>                 directions;
+    std::vector<RngState>              rng_states;
+    std::vector<Interaction>           results;
+    HostStackAllocatorStore<SecondaryRecord> secondaries;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(InteractionDriverTest, host)
+{
+    add_track(gamma, 1.0, kn.model_id);
+    add_track(positron, 2.0, epgg.model_id);
+    add_track(gamma, 1.0, ModelId{});  // No interaction
+    add_track(gamma, 10.0, ModelId{3}); // Model not in the list
+    add_track(gamma, 10.0, kn.model_id);
+
+    Dispatcher   dispatch(KleinNishinaLauncher{kn}, EPlusGGLauncher{epgg});
+    std::mt19937 rng;
+    host_interact(dispatch, this->pointers(), rng);
+
+    // Compton scattering emits an electron
+    for (auto i : {0, 4})
+    {
+        const Interaction& result = results[i];
+        EXPECT_EQ(Action::scattered, result.action) << "at " << i;
+        EXPECT_GT(particle_states[i].energy.value(), result.energy.value());
+        ASSERT_EQ(1, result.secondaries.size());
+        EXPECT_EQ(electron, Secondary(result.secondaries.front()).def_id);
+    }
+
+    // Annihilation emits two photons
+    EXPECT_EQ(Action::absorbed, results[1].action);
+    ASSERT_EQ(2, results[1].secondaries.size());
+    EXPECT_EQ(gamma, Secondary(results[1].secondaries[0]).def_id);
+    EXPECT_EQ(gamma, Secondary(results[1].secondaries[1]).def_id);
+
+    // Other tracks are untouched
+    EXPECT_EQ(Action::failed, results[2].action);
+    EXPECT_EQ(Action::failed, results[3].action);
+    EXPECT_EQ(4, secondaries.get().size());
+}
+
+TEST_F(InteractionDriverTest, all_models)
+{
+    const MaterialDefId potassium{1};
+    add_track(gamma, 1.0, kn.model_id, potassium);
+    add_track(positron, 2.0, epgg.model_id, potassium);
+    add_track(gamma, 1e-3, pe.model, potassium);
+    add_track(gamma, 100.0, bh.model, potassium);
+
+    ModelDispatcher<KleinNishinaLauncher,
+                    EPlusGGLauncher,
+                    PhotoelectricLauncher,
+                    BetheHeitlerLauncher>
+                 dispatch({kn}, {epgg}, pe, bh);
+    std::mt19937 rng;
+    host_interact(dispatch, this->pointers(), rng);
+
+    EXPECT_EQ(Action::scattered, results[0].action);
+    EXPECT_EQ(Action::absorbed, results[1].action);
+
+    // Photoelectric effect absorbs the gamma and emits at most an electron
+    EXPECT_EQ(Action::absorbed, results[2].action);
+    ASSERT_GE(1, results[2].secondaries.size());
+    if (!results[2].secondaries.empty())
+    {
+        EXPECT_EQ(electron, Secondary(results[2].secondaries.front()).def_id);
+    }
+
+    // Pair production emits an electron and a positron
+    EXPECT_EQ(Action::absorbed, results[3].action);
+    ASSERT_EQ(2, results[3].secondaries.size());
+    EXPECT_EQ(electron, Secondary(results[3].secondaries[0]).def_id);
+    EXPECT_EQ(positron, Secondary(results[3].secondaries[1]).def_id);
+}
+
+TEST_F(InteractionDriverTest, partitioned)
+{
+    for (auto i : range(4))
+    {
+        add_track(gamma, 1.0 + i, kn.model_id);
+    }
+
+    // Only the listed track slots interact
+    const index_type      tracks[] = {3, 1};
+    ModelInteractPointers ptrs     = this->pointers();
+    ptrs.tracks                    = make_span(tracks);
+    ptrs.partitioned               = true;
+
+    std::mt19937 rng;
+    host_interact(ModelDispatcher<KleinNishinaLauncher>({kn}), ptrs, rng);
+
+    std::vector<int> scattered;
+    for (const Interaction& result : results)
+    {
+        scattered.push_back(result.action == Action::scattered);
+    }
+    const int expected_scattered[] = {0, 1, 0, 1};
+    EXPECT_VEC_EQ(expected_scattered, scattered);
+    EXPECT_EQ(2, secondaries.get().size());
+}
+
+TEST_F(InteractionDriverTest, empty_partition)
+{
+    for (auto i : range(2))
+    {
+        add_track(gamma, 1.0 + i, kn.model_id);
+    }
+
+    // A model that no track selected launches nothing
+    ModelInteractPointers ptrs = this->pointers();
+    ptrs.partitioned           = true;
+    EXPECT_EQ(0, ptrs.num_threads());
+
+    std::mt19937 rng;
+    host_interact(ModelDispatcher<KleinNishinaLauncher>({kn}), ptrs, rng);
+    EXPECT_EQ(Action::failed, results[0].action);
+    EXPECT_EQ(Action::failed, results[1].action);
+    EXPECT_EQ(0, secondaries.get().size());
+}
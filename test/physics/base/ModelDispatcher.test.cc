@@ -0,0 +1,115 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ModelDispatcher.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/base/ModelDispatcher.hh"
+
+#include <random>
+#include "celeritas_test.hh"
+
+using celeritas::Interaction;
+using celeritas::ModelDispatcher;
+using celeritas::ModelId;
+using celeritas::units::MevEnergy;
+
+namespace
+{
+//---------------------------------------------------------------------------//
+// Mock per-track data
+struct MockTrack
+{
+    double energy;
+    int    num_calls = 0;
+};
+
+// Scale the track energy by a model-specific factor
+struct ScaleLauncher
+{
+    ModelId id;
+    double  factor;
+
+    ModelId model_id() const { return id; }
+
+    template<class Track, class Engine>
+    Interaction operator()(Track& track, Engine&) const
+    {
+        ++track.num_calls;
+        Interaction result;
+        result.action = celeritas::Action::scattered;
+        result.energy = MevEnergy{track.energy * factor};
+        return result;
+    }
+};
+
+// Kill the track
+struct AbsorbLauncher
+{
+    ModelId id;
+
+    ModelId model_id() const { return id; }
+
+    template<class Track, class Engine>
+    Interaction operator()(Track& track, Engine&) const
+    {
+        ++track.num_calls;
+        return Interaction::from_absorption();
+    }
+};
+} // namespace
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(ModelDispatcherTest, empty)
+{
+    ModelDispatcher<> dispatch;
+    EXPECT_EQ(0, dispatch.size());
+
+    MockTrack    track{1.0};
+    std::mt19937 rng;
+    Interaction  result = Interaction::from_failure();
+    EXPECT_FALSE(dispatch(ModelId{0}, track, rng, &result));
+    EXPECT_EQ(celeritas::Action::failed, result.action);
+}
+
+TEST(ModelDispatcherTest, dispatch)
+{
+    using Dispatcher
+        = ModelDispatcher<ScaleLauncher, AbsorbLauncher, ScaleLauncher>;
+    Dispatcher dispatch(
+        {ModelId{2}, 0.5}, AbsorbLauncher{ModelId{0}}, {ModelId{3}, 0.25});
+    EXPECT_EQ(3, dispatch.size());
+
+    std::mt19937 rng;
+    Interaction  result;
+
+    // First launcher
+    MockTrack track{1.0};
+    EXPECT_TRUE(dispatch(ModelId{2}, track, rng, &result));
+    EXPECT_EQ(celeritas::Action::scattered, result.action);
+    EXPECT_SOFT_EQ(0.5, result.energy.value());
+    EXPECT_EQ(1, track.num_calls);
+
+    // Middle launcher
+    track = MockTrack{1.0};
+    EXPECT_TRUE(dispatch(ModelId{0}, track, rng, &result));
+    EXPECT_EQ(celeritas::Action::absorbed, result.action);
+    EXPECT_EQ(1, track.num_calls);
+
+    // Last launcher
+    track = MockTrack{2.0};
+    EXPECT_TRUE(dispatch(ModelId{3}, track, rng, &result));
+    EXPECT_SOFT_EQ(0.5, result.energy.value());
+    EXPECT_EQ(1, track.num_calls);
+
+    // Model not in the list: result is unchanged
+    track  = MockTrack{2.0};
+    result = Interaction::from_failure();
+    EXPECT_FALSE(dispatch(ModelId{1}, track, rng, &result));
+    EXPECT_EQ(celeritas::Action::failed, result.action);
+    EXPECT_EQ(0, track.num_calls);
+}
@@ -0,0 +1,115 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ModelPartition.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/base/ModelPartition.hh"
+
+#include <vector>
+#include "celeritas_config.h"
+#include "celeritas_test.hh"
+#include "base/DeviceVector.hh"
+#include "physics/base/ModelPartitionStore.hh"
+
+using namespace celeritas;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class ModelPartitionTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // Model selected by each track slot; -1 is "no interaction"
+        const int model_ids[] = {2, 0, -1, 1, 2, 0, 0, -1, 2, 1};
+        for (int id : model_ids)
+        {
+            PhysicsTrackState state;
+            if (id >= 0)
+            {
+                state.model_id = ModelId(id);
+            }
+            states.push_back(state);
+        }
+    }
+
+    size_type                      num_models = 4;
+
+    std::vector<PhysicsTrackState> states;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(ModelPartitionTest, host)
+{
+    PhysicsStatePointers state_ptrs;
+    state_ptrs.state = make_span(states);
+
+    std::vector<index_type> track_order(states.size());
+    std::vector<index_type> offsets(num_models + 1);
+    ModelPartitionPointers  partition;
+    partition.track_order = make_span(track_order);
+    partition.offsets     = make_span(offsets);
+    EXPECT_EQ(num_models, partition.num_models());
+
+    partition_by_model(state_ptrs, partition);
+
+    // Tracks are stably sorted by model, with unassigned tracks at the end
+    const index_type expected_order[] = {1, 5, 6, 3, 9, 0, 4, 8, 2, 7};
+    EXPECT_VEC_EQ(expected_order, track_order);
+    const index_type expected_offsets[] = {0, 3, 5, 8, 8};
+    EXPECT_VEC_EQ(expected_offsets, offsets);
+
+    // Every track in a model's range selected that model
+    for (size_type m = 0; m != num_models; ++m)
+    {
+        for (auto i = offsets[m]; i != offsets[m + 1]; ++i)
+        {
+            EXPECT_EQ(ModelId(m), states[track_order[i]].model_id);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(ModelPartitionTest, device)
+{
+#if !CELERITAS_USE_CUDA
+    cout << "CUDA is disabled; skipping device partition test" << endl;
+    return;
+#endif
+    DeviceVector<PhysicsTrackState> device_states(states.size());
+    device_states.copy_to_device(make_span(states));
+    PhysicsStatePointers state_ptrs;
+    state_ptrs.state = device_states.device_pointers();
+
+    ModelPartitionStore partition(states.size(), num_models);
+    EXPECT_EQ(states.size(), partition.num_tracks());
+    EXPECT_EQ(num_models, partition.num_models());
+
+    partition.partition(state_ptrs);
+    EXPECT_EQ(3, partition.num_tracks(ModelId{0}));
+    EXPECT_EQ(2, partition.num_tracks(ModelId{1}));
+    EXPECT_EQ(3, partition.num_tracks(ModelId{2}));
+    EXPECT_EQ(0, partition.num_tracks(ModelId{3}));
+
+    // Each model's tracks are a contiguous subrange of the sorted slots
+    auto all_tracks = partition.device_pointers().track_order;
+    EXPECT_EQ(all_tracks.data(), partition.device_tracks(ModelId{0}).data());
+    EXPECT_EQ(all_tracks.data() + 3,
+              partition.device_tracks(ModelId{1}).data());
+    EXPECT_EQ(all_tracks.data() + 5,
+              partition.device_tracks(ModelId{2}).data());
+    EXPECT_EQ(3, partition.device_tracks(ModelId{2}).size());
+    EXPECT_TRUE(partition.device_tracks(ModelId{3}).empty());
+
+    // Tracks are stably sorted by model, with unassigned tracks at the end
+    const index_type expected_order[] = {1, 5, 6, 3, 9, 0, 4, 8, 2, 7};
+    EXPECT_VEC_EQ(expected_order, partition.host_track_order());
+}
@@ -0,0 +1,52 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file PackedSecondary.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/base/PackedSecondary.hh"
+
+#include "celeritas_test.hh"
+
+using celeritas::PackedSecondary;
+using celeritas::ParticleDefId;
+using celeritas::Real3;
+using celeritas::Secondary;
+using celeritas::units::MevEnergy;
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(PackedSecondaryTest, size)
+{
+    EXPECT_EQ(12, sizeof(PackedSecondary));
+    EXPECT_LE(2 * sizeof(PackedSecondary), sizeof(Secondary));
+}
+
+TEST(PackedSecondaryTest, invalid)
+{
+    PackedSecondary packed;
+    EXPECT_FALSE(packed);
+    EXPECT_FALSE(static_cast<Secondary>(packed));
+
+    packed = PackedSecondary(Secondary{});
+    EXPECT_FALSE(packed);
+}
+
+TEST(PackedSecondaryTest, round_trip)
+{
+    Secondary secondary;
+    secondary.def_id    = ParticleDefId{3};
+    secondary.energy    = MevEnergy{0.123456789};
+    secondary.direction = {0.36, -0.48, -0.8};
+
+    PackedSecondary packed(secondary);
+    EXPECT_TRUE(packed);
+
+    Secondary result(packed);
+    EXPECT_EQ(ParticleDefId{3}, result.def_id);
+    EXPECT_SOFT_NEAR(0.123456789, result.energy.value(), 1e-7);
+    EXPECT_VEC_CLOSE(secondary.direction, result.direction, 1e-4, 1e-4);
+}
@@ -0,0 +1,146 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file Region.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/base/RegionParams.hh"
+#include "physics/base/RegionView.hh"
+
+#include "celeritas_test.hh"
+#include "base/Range.hh"
+#include "physics/base/CutParams.hh"
+#include "physics/base/CutView.hh"
+
+using namespace celeritas;
+using celeritas::units::AmuMass;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class RegionTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // Volumes: world, two tracker layers, calorimeter absorber, gap
+        inp.num_volumes = 5;
+        inp.num_models  = 3;
+
+        RegionParams::RegionInput tracker;
+        tracker.label      = "tracker";
+        tracker.volumes    = {VolumeId{1}, VolumeId{2}};
+        tracker.cuts.gamma = tracker.cuts.electron = tracker.cuts.positron
+            = 0.01 * units::millimeter;
+
+        RegionParams::RegionInput calorimeter;
+        calorimeter.label   = "calorimeter";
+        calorimeter.volumes = {VolumeId{3}};
+        calorimeter.cuts.gamma = calorimeter.cuts.electron
+            = calorimeter.cuts.positron = 1 * units::centimeter;
+        calorimeter.disabled_models = {ModelId{1}};
+
+        inp.regions = {tracker, calorimeter};
+    }
+
+    RegionParams::Input inp;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(RegionTest, params)
+{
+    RegionParams regions(inp);
+    EXPECT_EQ(3, regions.num_regions());
+    EXPECT_EQ(RegionId{0}, RegionParams::default_region());
+    EXPECT_EQ(RegionId{0}, regions.find("default"));
+    EXPECT_EQ(RegionId{1}, regions.find("tracker"));
+    EXPECT_EQ(RegionId{2}, regions.find("calorimeter"));
+    EXPECT_EQ(RegionId{}, regions.find("nonexistent"));
+    EXPECT_EQ("calorimeter", regions.id_to_label(RegionId{2}));
+    EXPECT_SOFT_EQ(0.07, regions.cuts(RegionId{0}).electron);
+    EXPECT_SOFT_EQ(1.0, regions.cuts(RegionId{2}).gamma);
+
+    // Volume-to-region lookup and model enablement
+    const auto       data = regions.host_pointers();
+    std::vector<int> region_ids;
+    std::vector<int> enabled;
+    for (auto i : range(inp.num_volumes))
+    {
+        RegionView region(data, VolumeId(i));
+        region_ids.push_back(region.region_id().get());
+        for (auto m : range(inp.num_models))
+        {
+            enabled.push_back(region.is_enabled(ModelId(m)));
+        }
+    }
+    const int expected_region_ids[] = {0, 1, 1, 2, 0};
+    EXPECT_VEC_EQ(expected_region_ids, region_ids);
+    const int expected_enabled[]
+        = {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1};
+    EXPECT_VEC_EQ(expected_enabled, enabled);
+}
+
+TEST_F(RegionTest, overlapping)
+{
+    inp.regions[1].volumes.push_back(VolumeId{2});
+    EXPECT_THROW(RegionParams{inp}, celeritas::RuntimeError);
+}
+
+TEST_F(RegionTest, cuts)
+{
+    ParticleParams particles(
+        {{"electron",
+          pdg::electron(),
+          units::MevMass{0.5109989461},
+          units::ElementaryCharge{-1},
+          ParticleDef::stable_decay_constant()},
+         {"gamma",
+          pdg::gamma(),
+          zero_quantity(),
+          zero_quantity(),
+          ParticleDef::stable_decay_constant()}});
+    MaterialParams materials(
+        {{{82, AmuMass{207.2}, "Pb"}},
+         {{3.2989e22, 293.0, MatterState::solid, {{ElementDefId{0}, 1}}, "Pb"},
+          {0, 0, MatterState::unspecified, {}, "vacuum"}}});
+
+    RegionParams regions(inp);
+    CutParams    cuts(particles, materials, regions);
+    const auto   data = cuts.host_pointers();
+    EXPECT_EQ(3, data.num_regions());
+
+    // The default region has the same cuts as without regions
+    CutParams  single(particles, materials, CutParams::Input{});
+    const auto single_data = single.host_pointers();
+
+    const ParticleDefId electron = particles.find(pdg::electron());
+    const ParticleDefId gamma    = particles.find(pdg::gamma());
+    const MaterialDefId lead{0};
+
+    std::vector<real_type> energies;
+    for (ParticleDefId pid : {electron, gamma})
+    {
+        EXPECT_SOFT_EQ(CutView(single_data, lead).energy(pid).value(),
+                       CutView(data, lead).energy(pid).value());
+        for (auto r : range(regions.num_regions()))
+        {
+            energies.push_back(
+                CutView(data, RegionId(r), lead).energy(pid).value());
+        }
+        EXPECT_SOFT_EQ(CutParams::min_energy().value(),
+                       CutView(data, RegionId{2}, MaterialDefId{1})
+                           .energy(pid)
+                           .value());
+    }
+
+    // Fine tracker cuts and coarse calorimeter cuts
+    EXPECT_LT(energies[1], energies[0]);
+    EXPECT_GT(energies[2], energies[0]);
+    EXPECT_LT(energies[4], energies[3]);
+    EXPECT_GT(energies[5], energies[3]);
+}
@@ -90,7 +90,7 @@ class BetheHeitlerInteractorTest : public celeritas_test::InteractorHostTestBase
         // Check secondaries
         ASSERT_EQ(2, interaction.secondaries.size());
         // Electron
-        const auto& electron = interaction.secondaries.front();
+        const Secondary electron(interaction.secondaries.front());
         EXPECT_TRUE(electron);
         EXPECT_EQ(pointers_.electron_id, electron.def_id);
         EXPECT_GT(this->particle_track().energy().value(),
@@ -98,7 +98,7 @@ class BetheHeitlerInteractorTest : public celeritas_test::InteractorHostTestBase
         EXPECT_LT(0, electron.energy.value());
         EXPECT_SOFT_EQ(1.0, celeritas::norm(electron.direction));
         // Positron
-        const auto& positron = interaction.secondaries.back();
+        const Secondary positron(interaction.secondaries.back());
         EXPECT_TRUE(positron);
         EXPECT_EQ(pointers_.positron_id, positron.def_id);
         EXPECT_GT(this->particle_track().energy().value(),
@@ -151,11 +151,12 @@ TEST_F(BetheHeitlerInteractorTest, basic)
                   this->secondary_allocator().get().data()
                       + result.secondaries.size() * i);
 
+        const Secondary electron(result.secondaries[0]);
+        const Secondary positron(result.secondaries[1]);
         angle.push_back(
-            celeritas::dot_product(result.secondaries.front().direction,
-                                   result.secondaries.back().direction));
-        energy1.push_back(result.secondaries[0].energy.value());
-        energy2.push_back(result.secondaries[1].energy.value());
+            celeritas::dot_product(electron.direction, positron.direction));
+        energy1.push_back(electron.energy.value());
+        energy2.push_back(positron.energy.value());
     }
 
     EXPECT_EQ(2 * num_samples, this->secondary_allocator().get().size());
@@ -170,9 +171,9 @@ TEST_F(BetheHeitlerInteractorTest, basic)
                                      0.998111731270319,
                                      0.636300552842406};
 
-    EXPECT_VEC_SOFT_EQ(expected_energy1, energy1);
-    EXPECT_VEC_SOFT_EQ(expected_energy2, energy2);
-    EXPECT_VEC_SOFT_EQ(expected_angle, angle);
+    EXPECT_VEC_NEAR(expected_energy1, energy1, this->secondary_tol());
+    EXPECT_VEC_NEAR(expected_energy2, energy2, this->secondary_tol());
+    EXPECT_VEC_NEAR(expected_angle, angle, this->secondary_tol());
 
     // Next sample should fail because we're out of secondary buffer space
     {
@@ -7,10 +7,19 @@
 //---------------------------------------------------------------------------//
 #include "physics/em/BremRelInteractor.hh"
 
+#include <cmath>
+#include <memory>
 #include "celeritas_test.hh"
+#include "base/Algorithms.hh"
 #include "base/ArrayUtils.hh"
+#include "base/Constants.hh"
 #include "base/Range.hh"
 #include "physics/base/Units.hh"
+#include "physics/em/BremRelDXsCalculator.hh"
+#include "physics/em/BremRelMicroXsCalculator.hh"
+#include "physics/em/BremRelParams.hh"
+#include "physics/em/detail/BremRelTableView.hh"
+#include "physics/material/ElementView.hh"
 #include "physics/material/MaterialTrackView.hh"
 #include "../InteractorHostTestBase.hh"
 #include "../InteractionIO.hh"
@@ -34,7 +43,6 @@ class BremRelInteractorTest : public celeritas_test::InteractorHostTestBase
         constexpr auto zero   = celeritas::zero_quantity();
         constexpr auto stable = ParticleDef::stable_decay_constant();
 
-        // XXX Update these based on particles needed by interactor
         Base::set_particle_params(
             {{"electron",
               pdg::electron(),
@@ -46,8 +54,8 @@ class BremRelInteractorTest : public celeritas_test::InteractorHostTestBase
         pointers_.electron_id = params.find(pdg::electron());
         pointers_.gamma_id    = params.find(pdg::gamma());
 
-        // Set default particle to incident XXX MeV photon
-        this->set_inc_particle(pdg::gamma(), MevEnergy{10});
+        // Set default particle to incident 10 GeV electron
+        this->set_inc_particle(pdg::electron(), MevEnergy{1e4});
         this->set_inc_direction({0, 0, 1});
 
         // Create test materials
@@ -71,6 +79,13 @@ class BremRelInteractorTest : public celeritas_test::InteractorHostTestBase
             },
         });
         this->set_material("NaI");
+
+        // Five points per decade from 1 GeV to 1 TeV
+        BremRelParams::Input inp;
+        inp.log_energy = {16, std::log(1e3), std::log(10.0) / 5};
+        brem_          = std::make_shared<BremRelParams>(
+            this->material_params(), inp);
+        data_ = brem_->host_pointers();
     }
 
     void sanity_check(const Interaction& interaction) const
@@ -80,28 +95,383 @@ class BremRelInteractorTest : public celeritas_test::InteractorHostTestBase
         // Check change to parent track
         EXPECT_GT(this->particle_track().energy().value(),
                   interaction.energy.value());
-        EXPECT_LT(0, interaction.energy.value());
+        EXPECT_LE(0, interaction.energy.value());
         EXPECT_SOFT_EQ(1.0, celeritas::norm(interaction.direction));
         EXPECT_EQ(celeritas::Action::scattered, interaction.action);
 
-        // XXX Check secondaries
+        // Check secondaries
+        ASSERT_EQ(1, interaction.secondaries.size());
+        const Secondary gamma(interaction.secondaries.front());
+        EXPECT_TRUE(gamma);
+        EXPECT_EQ(pointers_.gamma_id, gamma.def_id);
+        EXPECT_LE(gamma_cut_.value() * (1 - 1e-12), gamma.energy.value());
+        EXPECT_SOFT_EQ(1.0, celeritas::norm(gamma.direction));
+
+        // Energy is conserved; the nucleus absorbs the recoil momentum
+        EXPECT_SOFT_NEAR(this->particle_track().energy().value(),
+                         interaction.energy.value() + gamma.energy.value(),
+                         this->secondary_tol());
+    }
+
+    //! Element view
+    ElementView element(ElementDefId el) const
+    {
+        return ElementView(this->material_params().host_pointers(), el);
+    }
 
-        // Check conservation between primary and secondaries
-        this->check_conservation(interaction);
+    //! Integral of k dsigma/dk over ln(k) from k_lo to k_hi
+    real_type integrate(ElementDefId el,
+                        real_type    energy,
+                        real_type    k_lo,
+                        real_type    k_hi) const
+    {
+        BremRelDXsCalculator calc_dxs(this->element(el), MevEnergy{energy});
+        const int            n = 4000;
+        const real_type      h = std::log(k_hi / k_lo) / n;
+        real_type            result = 0;
+        for (auto i : range(n + 1))
+        {
+            const real_type k = std::fmin(k_lo * std::exp(i * h), k_hi);
+            const int weight = (i == 0 || i == n) ? 1 : (i % 2 == 1 ? 4 : 2);
+            result += weight * calc_dxs(MevEnergy{k});
+        }
+        return result * h / 3;
     }
 
   protected:
-    celeritas::BremRelInteractorPointers pointers_;
+    BremRelInteractorPointers      pointers_;
+    std::shared_ptr<BremRelParams> brem_;
+    BremRelParamsPointers          data_;
+    MevEnergy                      gamma_cut_{1.0};
 };
 
 //---------------------------------------------------------------------------//
 // TESTS
 //---------------------------------------------------------------------------//
 
+TEST_F(BremRelInteractorTest, dxs)
+{
+    using constants::alpha_fine_structure;
+    using constants::re_electron;
+
+    // Complete screening at very high energy (Tsai eq. 3.83)
+    const ElementView iodine = this->element(ElementDefId{2});
+    const real_type   z      = iodine.atomic_number();
+    const real_type   lrad = std::log(184.15) - iodine.log_z() / 3;
+    const real_type   lrad_prime = std::log(1194.0) - 2 * iodine.log_z() / 3;
+    const real_type   big_l      = z * z * (lrad - iodine.coulomb_correction())
+                            + z * lrad_prime;
+    const real_type prefactor = 4 * alpha_fine_structure * re_electron
+                                * re_electron;
+
+    const real_type      energy = 1e8;
+    BremRelDXsCalculator calc_dxs(iodine, MevEnergy{energy});
+    for (real_type y : {1e-6, 0.1, 0.5, 0.9})
+    {
+        const real_type expected
+            = prefactor
+              * ((4. / 3 - 4. / 3 * y + y * y) * big_l
+                 + (1 - y) / 12 * (z * z + z));
+        EXPECT_SOFT_NEAR(expected, calc_dxs(MevEnergy{y * energy}), 1e-4)
+            << "at y=" << y;
+    }
+
+    // Energy-weighted integral is the inverse radiation length, plus the
+    // small non-logarithmic term
+    const real_type atom_mass = unit_cast(iodine.atomic_mass());
+    EXPECT_SOFT_NEAR(iodine.mass_radiation_coeff() * atom_mass
+                         * (1 + (z * z + z) / (24 * big_l)),
+                     this->integrate(ElementDefId{2}, energy, 1e-6, energy)
+                         / energy,
+                     1e-3);
+
+    // Screening is incomplete at lower energy, which reduces the soft
+    // photon cross section
+    BremRelDXsCalculator calc_low(iodine, MevEnergy{1e3});
+    EXPECT_LT(calc_low(MevEnergy{500}), calc_dxs(MevEnergy{0.5 * energy}));
+    EXPECT_LE(0, calc_low(MevEnergy{1e3}));
+}
+
+TEST_F(BremRelInteractorTest, params)
+{
+    EXPECT_EQ(3, data_.num_elements());
+    EXPECT_EQ(64, data_.log_x.size);
+    EXPECT_SOFT_EQ(std::log(1e-4), data_.log_x.front);
+
+    // Tabulated integrals match direct integration
+    for (auto el : {ElementDefId{0}, ElementDefId{2}})
+    {
+        for (auto e : {0, 10, 15})
+        {
+            const real_type energy
+                = std::exp(data_.log_energy.front + e * data_.log_energy.delta);
+            const real_type* cdf = data_.cdf.data()
+                                   + data_.row(el, e) * data_.log_x.size;
+            EXPECT_EQ(0, cdf[0]);
+            for (auto j : {20, 40, 63})
+            {
+                const real_type x = std::exp(data_.log_x.front
+                                             + j * data_.log_x.delta);
+                EXPECT_SOFT_NEAR(
+                    this->integrate(el, energy, 1e-4 * energy, x * energy),
+                    cdf[j],
+                    1e-6);
+            }
+        }
+    }
+}
+
+TEST_F(BremRelInteractorTest, table_sampling)
+{
+    RandomEngine& rng_engine = this->rng();
+
+    // Cuts below the grid, on a grid point, inside a bin, and in the last bin
+    const real_type delta = data_.log_x.delta;
+    for (real_type log_x_cut : {std::log(1e-6),
+                                data_.log_x.front + 10 * delta,
+                                data_.log_x.front + 40.3 * delta,
+                                -0.5 * delta})
+    {
+        detail::BremRelTableView table(data_, data_.row(ElementDefId{2}, 5));
+        const real_type          lower = table.integral(log_x_cut);
+
+        const int           num_samples = 20000;
+        const real_type     edges[]     = {0.1, 0.3, 0.6, 0.9};
+        std::vector<double> above(4, 0.0);
+        for (int i = 0; i < num_samples; ++i)
+        {
+            const real_type log_x = table.sample(log_x_cut, rng_engine);
+            ASSERT_LE(log_x_cut, log_x);
+            ASSERT_GE(0, log_x);
+            for (auto j : range(4))
+            {
+                if (log_x > log_x_cut + edges[j] * -log_x_cut)
+                {
+                    above[j] += 1.0 / num_samples;
+                }
+            }
+        }
+        for (auto j : range(4))
+        {
+            const real_type log_x = log_x_cut + edges[j] * -log_x_cut;
+            EXPECT_NEAR((table.total() - table.integral(log_x))
+                            / (table.total() - lower),
+                        above[j],
+                        0.01)
+                << "with ln x_cut=" << log_x_cut << " at ln x=" << log_x;
+        }
+    }
+}
+
+TEST_F(BremRelInteractorTest, seltzer_berger)
+{
+    // Constant scaled cross section [mb] for every element
+    const real_type             chi = 5;
+    BremRelParams::ElementInput sb;
+    sb.x          = {1e-12, 0.5, 1};
+    sb.log_energy = {std::log(1e-3), std::log(1e4)};
+    sb.value.assign(6, chi);
+
+    // Five points per decade from 1 MeV to 1 TeV
+    BremRelParams::Input inp;
+    inp.log_energy = {31, 0, std::log(10.0) / 5};
+    inp.seltzer_berger.assign(3, sb);
+    BremRelParams               brem(this->material_params(), inp);
+    const BremRelParamsPointers data = brem.host_pointers();
+
+    // Below 1 GeV the integrand chi Z^2 / beta^2 is constant in ln x
+    const real_type mass = 0.5109989461;
+    for (auto e : {0, 5, 10})
+    {
+        const real_type energy  = std::exp(e * inp.log_energy.delta);
+        const real_type beta_sq = energy * (energy + 2 * mass)
+                                  / ipow<2>(energy + mass);
+        const real_type dxs     = chi * 1e-27 * 53 * 53 / beta_sq;
+        detail::BremRelTableView table(data, data.row(ElementDefId{2}, e));
+        EXPECT_SOFT_EQ(-dxs * data.log_x.front, table.total());
+        EXPECT_SOFT_EQ(dxs * (std::log(0.01) - data.log_x.front),
+                       table.integral(std::log(0.01)));
+    }
+
+    // Above 1 GeV the relativistic cross section is used
+    {
+        detail::BremRelTableView expected(data_,
+                                          data_.row(ElementDefId{2}, 5));
+        detail::BremRelTableView actual(data, data.row(ElementDefId{2}, 20));
+        EXPECT_SOFT_EQ(expected.total(), actual.total());
+    }
+
+    // Photons from a 10 MeV electron are uniform in ln k above the cut
+    const int num_samples = 10000;
+    this->resize_secondaries(num_samples);
+    this->set_inc_particle(pdg::electron(), MevEnergy{10});
+    BremRelInteractor interact(pointers_,
+                               data,
+                               ElementDefId{2},
+                               gamma_cut_,
+                               this->particle_track(),
+                               this->direction(),
+                               this->secondary_allocator());
+    RandomEngine&     rng_engine = this->rng();
+
+    double above = 0;
+    for (int i = 0; i < num_samples; ++i)
+    {
+        Interaction result = interact(rng_engine);
+        this->sanity_check(result);
+        if (Secondary(result.secondaries.front()).energy.value() > 3)
+        {
+            above += 1.0 / num_samples;
+        }
+    }
+    EXPECT_NEAR(std::log(10 / 3.) / std::log(10.), above, 0.01);
+}
+
+TEST_F(BremRelInteractorTest, micro_xs)
+{
+    std::vector<real_type> xs;
+    std::vector<real_type> expected;
+    for (real_type cut : {1e-3, 1.0, 1e3, 1e4})
+    {
+        BremRelMicroXsCalculator calc_xs(
+            pointers_, data_, MevEnergy{cut}, this->particle_track());
+        xs.push_back(calc_xs(ElementDefId{2}));
+        expected.push_back(
+            cut < 1e4 ? this->integrate(ElementDefId{2}, 1e4, cut, 1e4) : 0);
+    }
+    // Below x_min the integral is extrapolated from the first grid point
+    EXPECT_SOFT_NEAR(expected[0], xs[0], 1e-4);
+    EXPECT_SOFT_NEAR(expected[1], xs[1], 1e-6);
+    EXPECT_SOFT_NEAR(expected[2], xs[2], 1e-6);
+    EXPECT_EQ(0, xs[3]);
+
+    // Lowering the cut increases the cross section logarithmically
+    EXPECT_GT(xs[0], xs[1]);
+    EXPECT_GT(xs[1], xs[2]);
+}
+
 TEST_F(BremRelInteractorTest, basic)
 {
-    // Temporary test of harness material track view
-    MaterialTrackView& mat_track = this->material_track();
-    EXPECT_EQ(2, mat_track.element_scratch().size());
-    EXPECT_EQ(MaterialDefId{1}, mat_track.def_id());
+    const int num_samples = 4;
+    this->resize_secondaries(num_samples);
+
+    BremRelInteractor interact(pointers_,
+                               data_,
+                               ElementDefId{2},
+                               gamma_cut_,
+                               this->particle_track(),
+                               this->direction(),
+                               this->secondary_allocator());
+    RandomEngine&     rng_engine = this->rng();
+
+    std::vector<double> gamma_energy;
+    for (int i = 0; i < num_samples; ++i)
+    {
+        Interaction result = interact(rng_engine);
+        SCOPED_TRACE(result);
+        this->sanity_check(result);
+
+        EXPECT_EQ(result.secondaries.data(),
+                  this->secondary_allocator().get().data() + i);
+        gamma_energy.push_back(
+            Secondary(result.secondaries[0]).energy.value());
+    }
+    EXPECT_EQ(num_samples, this->secondary_allocator().get().size());
+
+    // Note: these are "gold" values based on the host RNG.
+    const double expected_gamma_energy[] = {
+        7808.75927782363, 8388.59564726346, 1541.90880253815, 16.8440936476469};
+    EXPECT_VEC_NEAR(expected_gamma_energy, gamma_energy, this->secondary_tol());
+
+    // Next sample should fail because we're out of secondary buffer space
+    {
+        Interaction result = interact(rng_engine);
+        EXPECT_EQ(0, result.secondaries.size());
+        EXPECT_EQ(celeritas::Action::failed, result.action);
+    }
+}
+
+TEST_F(BremRelInteractorTest, spectrum)
+{
+    const int num_samples = 20000;
+    this->resize_secondaries(num_samples);
+
+    // Emission off sodium, between grid points
+    const real_type energy = 3e4;
+    this->set_inc_particle(pdg::electron(), MevEnergy{energy});
+    BremRelInteractor interact(pointers_,
+                               data_,
+                               ElementDefId{1},
+                               gamma_cut_,
+                               this->particle_track(),
+                               this->direction(),
+                               this->secondary_allocator());
+    RandomEngine&     rng_engine = this->rng();
+
+    const double        edges[] = {1e-3, 1e-2, 0.1, 0.5};
+    std::vector<double> above(std::end(edges) - std::begin(edges), 0.0);
+    double              avg_gamma_angle = 0;
+    for (int i = 0; i < num_samples; ++i)
+    {
+        Interaction result = interact(rng_engine);
+        const Secondary gamma(result.secondaries.front());
+        for (auto j : range(above.size()))
+        {
+            if (gamma.energy.value() > edges[j] * energy)
+            {
+                above[j] += 1.0 / num_samples;
+            }
+        }
+        avg_gamma_angle += std::acos(gamma.direction[2]) / num_samples;
+    }
+
+    const real_type total
+        = this->integrate(ElementDefId{1}, energy, gamma_cut_.value(), energy);
+    for (auto j : range(above.size()))
+    {
+        EXPECT_NEAR(
+            this->integrate(ElementDefId{1}, energy, edges[j] * energy, energy)
+                / total,
+            above[j],
+            0.01)
+            << "at x=" << edges[j];
+    }
+
+    // Photons are emitted within a cone of order m/E
+    const real_type mass_per_energy = 0.5109989461 / energy;
+    EXPECT_LT(0.5 * mass_per_energy, avg_gamma_angle);
+    EXPECT_GT(5 * mass_per_energy, avg_gamma_angle);
+}
+
+TEST_F(BremRelInteractorTest, stress_test)
+{
+    RandomEngine& rng_engine = this->rng();
+
+    for (double inc_e : {1e3, 2.5e3, 1e5, 1e6})
+    {
+        this->set_inc_particle(pdg::electron(), MevEnergy{inc_e});
+        for (const Real3& inc_dir :
+             {Real3{0, 0, 1}, Real3{1, 0, 0}, Real3{1e-9, 0, 1}, Real3{1, 1, 1}})
+        {
+            SCOPED_TRACE("Incident direction: " + to_string(inc_dir));
+            this->set_inc_direction(inc_dir);
+            for (auto el : {ElementDefId{0}, ElementDefId{1}, ElementDefId{2}})
+            {
+                this->resize_secondaries(16);
+                BremRelInteractor interact(pointers_,
+                                           data_,
+                                           el,
+                                           gamma_cut_,
+                                           this->particle_track(),
+                                           this->direction(),
+                                           this->secondary_allocator());
+                for (int i = 0; i < 16; ++i)
+                {
+                    Interaction result = interact(rng_engine);
+                    SCOPED_TRACE(result);
+                    this->sanity_check(result);
+                }
+            }
+        }
+    }
 }
@@ -68,7 +68,7 @@ class EPlusGGInteractorTest : public celeritas_test::InteractorHostTestBase
         // Check secondaries (two photons)
         ASSERT_EQ(2, interaction.secondaries.size());
 
-        const auto& gamma1 = interaction.secondaries.front();
+        const Secondary gamma1(interaction.secondaries.front());
         EXPECT_TRUE(gamma1);
         EXPECT_EQ(pointers_.gamma_id, gamma1.def_id);
 
@@ -78,7 +78,7 @@ class EPlusGGInteractorTest : public celeritas_test::InteractorHostTestBase
         EXPECT_LT(0, gamma1.energy.value());
         EXPECT_SOFT_EQ(1.0, celeritas::norm(gamma1.direction));
 
-        const auto& gamma2 = interaction.secondaries.back();
+        const Secondary gamma2(interaction.secondaries.back());
         EXPECT_TRUE(gamma2);
         EXPECT_EQ(pointers_.gamma_id, gamma2.def_id);
         EXPECT_GT(this->particle_track().energy().value()
@@ -125,11 +125,12 @@ TEST_F(EPlusGGInteractorTest, basic)
                   this->secondary_allocator().get().data()
                       + result.secondaries.size() * i);
 
+        const Secondary gamma1(result.secondaries[0]);
+        const Secondary gamma2(result.secondaries[1]);
         angle.push_back(
-            celeritas::dot_product(result.secondaries.front().direction,
-                                   result.secondaries.back().direction));
-        energy1.push_back(result.secondaries[0].energy.value());
-        energy2.push_back(result.secondaries[1].energy.value());
+            celeritas::dot_product(gamma1.direction, gamma2.direction));
+        energy1.push_back(gamma1.energy.value());
+        energy2.push_back(gamma2.energy.value());
     }
 
     EXPECT_EQ(2 * num_samples, this->secondary_allocator().get().size());
@@ -146,9 +147,9 @@ TEST_F(EPlusGGInteractorTest, basic)
                                      0.911748167069523,
                                      0.859684696937321};
 
-    EXPECT_VEC_SOFT_EQ(expected_energy1, energy1);
-    EXPECT_VEC_SOFT_EQ(expected_energy2, energy2);
-    EXPECT_VEC_SOFT_EQ(expected_angle, angle);
+    EXPECT_VEC_NEAR(expected_energy1, energy1, this->secondary_tol());
+    EXPECT_VEC_NEAR(expected_energy2, energy2, this->secondary_tol());
+    EXPECT_VEC_NEAR(expected_angle, angle, this->secondary_tol());
 
     // Next sample should fail because we're out of secondary buffer space
     {
@@ -181,14 +182,19 @@ TEST_F(EPlusGGInteractorTest, at_rest)
         this->sanity_check(result);
 
         ASSERT_EQ(2, result.secondaries.size());
-        EXPECT_SOFT_EQ(-1,
-                       celeritas::dot_product(result.secondaries[0].direction,
-                                              result.secondaries[1].direction));
-
-        EXPECT_SOFT_EQ(pointers_.electron_mass,
-                       result.secondaries[0].energy.value());
-        EXPECT_SOFT_EQ(pointers_.electron_mass,
-                       result.secondaries[1].energy.value());
+        const Secondary gamma1(result.secondaries[0]);
+        const Secondary gamma2(result.secondaries[1]);
+        EXPECT_SOFT_NEAR(
+            -1,
+            celeritas::dot_product(gamma1.direction, gamma2.direction),
+            this->secondary_tol());
+
+        EXPECT_SOFT_NEAR(pointers_.electron_mass,
+                         gamma1.energy.value(),
+                         this->secondary_tol());
+        EXPECT_SOFT_NEAR(pointers_.electron_mass,
+                         gamma2.energy.value(),
+                         this->secondary_tol());
     }
 }
 
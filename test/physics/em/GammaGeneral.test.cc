@@ -0,0 +1,157 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file GammaGeneral.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/em/GammaGeneralParams.hh"
+#include "physics/em/GammaGeneralCalculator.hh"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include "celeritas_test.hh"
+#include "base/Range.hh"
+#include "base/Span.hh"
+#include "physics/material/MaterialTrackView.hh"
+
+using namespace celeritas;
+using celeritas::units::AmuMass;
+using celeritas::units::MevEnergy;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class GammaGeneralTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override
+    {
+        MaterialParams::Input mat_inp;
+        mat_inp.elements  = {{13, AmuMass{26.9815385}, "Al"}};
+        mat_inp.materials = {
+            {6.0221e22,
+             293.0,
+             MatterState::solid,
+             {{ElementDefId{0}, 1.0}},
+             "Al"},
+            {0, 0, MatterState::unspecified, {}, "hard vacuum"},
+        };
+        materials = std::make_shared<MaterialParams>(std::move(mat_inp));
+
+        // Tracks in aluminum, vacuum, and aluminum at twice the density
+        const MaterialTrackInitializer mat_init[]
+            = {{aluminum, 1}, {vacuum, 1}, {aluminum, 2}};
+        mat_params = materials->host_pointers();
+        mat_state.resize(3);
+        mat_scratch.resize(mat_state.size()
+                           * materials->max_element_components());
+        mat_states.state           = make_span(mat_state);
+        mat_states.element_scratch = make_span(mat_scratch);
+        for (auto i : range(3))
+        {
+            this->material_track(ThreadId(i)) = mat_init[i];
+        }
+
+        // Grid points at 1, 10, and 100 MeV; no interactions in vacuum
+        inp.log_energy = {3, 0, std::log(10.0)};
+        inp.channels   = {{ModelId{10}, {1, 1, 1, 0, 0, 0}},
+                        {ModelId{11}, {1, 3, 9, 0, 0, 0}}};
+    }
+
+    //! Material view of the track in the given state
+    MaterialTrackView material_track(ThreadId tid) const
+    {
+        return MaterialTrackView(mat_params, mat_states, tid);
+    }
+
+    const MaterialDefId aluminum{0};
+    const MaterialDefId vacuum{1};
+    const ThreadId      in_aluminum{0};
+    const ThreadId      in_vacuum{1};
+    const ThreadId      in_dense_aluminum{2};
+
+    std::shared_ptr<MaterialParams> materials;
+    GammaGeneralParams::Input       inp;
+    MaterialParamsPointers          mat_params;
+    std::vector<MaterialTrackState> mat_state;
+    std::vector<real_type>          mat_scratch;
+    MaterialStatePointers           mat_states;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(GammaGeneralTest, params)
+{
+    GammaGeneralParams         gg(*materials, inp);
+    GammaGeneralParamsPointers ptrs = gg.host_pointers();
+    EXPECT_EQ(2, ptrs.num_channels());
+    EXPECT_EQ(2, ptrs.num_materials);
+
+    const real_type expected_total_xs[] = {2, 4, 10, 0, 0, 0};
+    const real_type expected_cdf[]
+        = {0.5, 1, 0.25, 1, 0.1, 1, 1, 1, 1, 1, 1, 1};
+    EXPECT_VEC_SOFT_EQ(expected_total_xs, ptrs.total_xs);
+    EXPECT_VEC_SOFT_EQ(expected_cdf, ptrs.cdf);
+}
+
+TEST_F(GammaGeneralTest, calculator)
+{
+    GammaGeneralParams         gg(*materials, inp);
+    GammaGeneralParamsPointers ptrs = gg.host_pointers();
+
+    // Grid points and interpolation in log energy
+    MaterialTrackView      material = this->material_track(in_aluminum);
+    std::vector<real_type> xs;
+    for (real_type energy : {0.5, 1.0, 5.5, 10.0, 100.0, 1000.0})
+    {
+        GammaGeneralCalculator calc(ptrs, material, MevEnergy{energy});
+        xs.push_back(calc.macro_xs());
+    }
+    const real_type expected_xs[] = {2, 2, 3.48072537898849, 4, 10, 10};
+    EXPECT_VEC_SOFT_EQ(expected_xs, xs);
+
+    // Cumulative fraction of the first channel at 5.5 MeV is 0.3149
+    GammaGeneralCalculator calc(ptrs, material, MevEnergy{5.5});
+    EXPECT_EQ(ModelId{10}, calc.select(0));
+    EXPECT_EQ(ModelId{10}, calc.select(0.31));
+    EXPECT_EQ(ModelId{11}, calc.select(0.32));
+    EXPECT_EQ(ModelId{11}, calc.select(0.999));
+
+    // Vacuum never interacts
+    GammaGeneralCalculator calc_vacuum(
+        ptrs, this->material_track(in_vacuum), MevEnergy{5.5});
+    EXPECT_SOFT_EQ(0, calc_vacuum.macro_xs());
+    EXPECT_EQ(ModelId{10}, calc_vacuum.select(0.5));
+
+    // Cross section is proportional to the density but the fractions aren't
+    GammaGeneralCalculator calc_dense(
+        ptrs, this->material_track(in_dense_aluminum), MevEnergy{5.5});
+    EXPECT_SOFT_EQ(2 * calc.macro_xs(), calc_dense.macro_xs());
+    EXPECT_EQ(ModelId{10}, calc_dense.select(0.31));
+    EXPECT_EQ(ModelId{11}, calc_dense.select(0.32));
+}
+
+TEST_F(GammaGeneralTest, sampling)
+{
+    GammaGeneralParams         gg(*materials, inp);
+    GammaGeneralParamsPointers ptrs = gg.host_pointers();
+    GammaGeneralCalculator     sample_model(
+        ptrs, this->material_track(in_aluminum), MevEnergy{10});
+
+    std::mt19937 rng;
+    int          num_first   = 0;
+    const int    num_samples = 10000;
+    for (int i = 0; i < num_samples; ++i)
+    {
+        if (sample_model(rng) == ModelId{10})
+        {
+            ++num_first;
+        }
+    }
+    EXPECT_SOFT_NEAR(0.25, real_type(num_first) / num_samples, 0.05);
+}
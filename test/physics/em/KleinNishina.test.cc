@@ -67,7 +67,7 @@ class KleinNishinaInteractorTest : public celeritas_test::InteractorHostTestBase
 
         // Check secondaries
         ASSERT_EQ(1, interaction.secondaries.size());
-        const auto& electron = interaction.secondaries.front();
+        const Secondary electron(interaction.secondaries.front());
         EXPECT_TRUE(electron);
         EXPECT_EQ(pointers_.electron_id, electron.def_id);
         EXPECT_GT(this->particle_track().energy().value(),
@@ -116,9 +116,10 @@ TEST_F(KleinNishinaInteractorTest, ten_mev)
         energy.push_back(result.energy.value());
         costheta.push_back(
             celeritas::dot_product(result.direction, this->direction()));
-        energy_electron.push_back(result.secondaries.front().energy.value());
-        costheta_electron.push_back(celeritas::dot_product(
-            result.secondaries.front().direction, this->direction()));
+        const Secondary electron(result.secondaries.front());
+        energy_electron.push_back(electron.energy.value());
+        costheta_electron.push_back(
+            celeritas::dot_product(electron.direction, this->direction()));
     }
 
     EXPECT_EQ(4, this->secondary_allocator().get().size());
@@ -134,8 +135,10 @@ TEST_F(KleinNishinaInteractorTest, ten_mev)
         = {0.998962567429, 0.9941635460938, 0.3895748042313, 0.9986216572142};
     EXPECT_VEC_SOFT_EQ(expected_energy, energy);
     EXPECT_VEC_SOFT_EQ(expected_costheta, costheta);
-    EXPECT_VEC_SOFT_EQ(expected_energy_electron, energy_electron);
-    EXPECT_VEC_SOFT_EQ(expected_costheta_electron, costheta_electron);
+    EXPECT_VEC_NEAR(
+        expected_energy_electron, energy_electron, this->secondary_tol());
+    EXPECT_VEC_NEAR(
+        expected_costheta_electron, costheta_electron, this->secondary_tol());
     // PRINT_EXPECTED(energy_electron);
 
     // Next sample should fail because we're out of secondary buffer space
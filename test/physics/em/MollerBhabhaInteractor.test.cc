@@ -9,12 +9,15 @@
 
 #include "celeritas_test.hh"
 #include "base/ArrayUtils.hh"
+#include "base/Constants.hh"
 #include "base/Range.hh"
 #include "physics/base/Units.hh"
+#include "physics/em/MollerBhabhaMicroXsCalculator.hh"
 #include "../InteractorHostTestBase.hh"
 #include "../InteractionIO.hh"
 
 using celeritas::MollerBhabhaInteractor;
+using celeritas::MollerBhabhaMicroXsCalculator;
 namespace pdg = celeritas::pdg;
 
 //---------------------------------------------------------------------------//
@@ -30,23 +33,24 @@ class MollerBhabhaInteractorTest : public celeritas_test::InteractorHostTestBase
     {
         using celeritas::ParticleDef;
         using namespace celeritas::units;
-        constexpr auto zero   = celeritas::zero_quantity();
         constexpr auto stable = ParticleDef::stable_decay_constant();
 
-        // XXX Update these based on particles needed by interactor
-        Base::set_particle_params(
-            {{"electron",
-              pdg::electron(),
-              MevMass{0.5109989461},
-              ElementaryCharge{-1},
-              stable},
-             {"gamma", pdg::gamma(), zero, zero, stable}});
+        Base::set_particle_params({{"electron",
+                                    pdg::electron(),
+                                    MevMass{0.5109989461},
+                                    ElementaryCharge{-1},
+                                    stable},
+                                   {"positron",
+                                    pdg::positron(),
+                                    MevMass{0.5109989461},
+                                    ElementaryCharge{1},
+                                    stable}});
         const auto& params    = this->particle_params();
         pointers_.electron_id = params.find(pdg::electron());
-        pointers_.gamma_id    = params.find(pdg::gamma());
+        pointers_.positron_id = params.find(pdg::positron());
 
-        // Set default particle to incident XXX MeV photon
-        this->set_inc_particle(pdg::gamma(), MevEnergy{10});
+        // Set default particle to incident 10 MeV electron
+        this->set_inc_particle(pdg::electron(), MevEnergy{10});
         this->set_inc_direction({0, 0, 1});
     }
 
@@ -55,24 +59,189 @@ class MollerBhabhaInteractorTest : public celeritas_test::InteractorHostTestBase
         ASSERT_TRUE(interaction);
 
         // Check change to parent track
-        EXPECT_GT(this->particle_track().energy().value(),
-                  interaction.energy.value());
-        EXPECT_LT(0, interaction.energy.value());
+        const real_type inc_energy = this->particle_track().energy().value();
+        EXPECT_GT(inc_energy, interaction.energy.value());
+        EXPECT_LE(0, interaction.energy.value());
         EXPECT_SOFT_EQ(1.0, celeritas::norm(interaction.direction));
         EXPECT_EQ(celeritas::Action::scattered, interaction.action);
 
-        // XXX Check secondaries
+        // Check secondaries
+        ASSERT_EQ(1, interaction.secondaries.size());
+        const Secondary electron(interaction.secondaries.front());
+        EXPECT_TRUE(electron);
+        EXPECT_EQ(pointers_.electron_id, electron.def_id);
+        EXPECT_LE(electron_cut_.value() * (1 - 1e-12),
+                  electron.energy.value());
+        if (this->particle_track().def_id() == pointers_.electron_id)
+        {
+            // Primary is the more energetic of the two electrons
+            EXPECT_GE(interaction.energy.value() * (1 + 1e-12),
+                      electron.energy.value());
+        }
+        EXPECT_SOFT_EQ(1.0, celeritas::norm(electron.direction));
 
         // Check conservation between primary and secondaries
         this->check_conservation(interaction);
     }
 
+    //! Cross section at the given cut for the incident particle
+    real_type calc_xs(real_type cut) const
+    {
+        return MollerBhabhaMicroXsCalculator(
+            pointers_, MevEnergy{cut}, this->particle_track())();
+    }
+
   protected:
     celeritas::MollerBhabhaInteractorPointers pointers_;
+    MevEnergy                                 electron_cut_{0.1};
 };
 
 //---------------------------------------------------------------------------//
 // TESTS
 //---------------------------------------------------------------------------//
 
-TEST_F(MollerBhabhaInteractorTest, basic) {}
+TEST_F(MollerBhabhaInteractorTest, micro_xs)
+{
+    using celeritas::constants::pi;
+    using celeritas::constants::re_electron;
+    const real_type prefactor = 2 * pi * re_electron * re_electron
+                                * 0.5109989461;
+
+    // For a cut much smaller than the (ultrarelativistic) energy, both tend
+    // to the Rutherford cross section for free electrons
+    this->set_inc_particle(pdg::electron(), MevEnergy{1e3});
+    EXPECT_SOFT_NEAR(prefactor / 1.0, this->calc_xs(1.0), 1e-2);
+    this->set_inc_particle(pdg::positron(), MevEnergy{1e3});
+    EXPECT_SOFT_NEAR(prefactor / 1.0, this->calc_xs(1.0), 1e-2);
+
+    // Maximum energy transfer is half the energy for identical particles
+    this->set_inc_particle(pdg::electron(), MevEnergy{10});
+    EXPECT_GT(this->calc_xs(4.999), 0);
+    EXPECT_EQ(0, this->calc_xs(5.0));
+    EXPECT_GT(this->calc_xs(0.1), this->calc_xs(1.0));
+    this->set_inc_particle(pdg::positron(), MevEnergy{10});
+    EXPECT_GT(this->calc_xs(5.0), 0);
+    EXPECT_EQ(0, this->calc_xs(10.0));
+    EXPECT_GT(this->calc_xs(0.1), this->calc_xs(1.0));
+}
+
+TEST_F(MollerBhabhaInteractorTest, basic)
+{
+    const int num_samples = 4;
+    this->resize_secondaries(num_samples);
+
+    MollerBhabhaInteractor interact(pointers_,
+                                    electron_cut_,
+                                    this->particle_track(),
+                                    this->direction(),
+                                    this->secondary_allocator());
+    RandomEngine&          rng_engine = this->rng();
+
+    std::vector<double> delta_energy;
+    std::vector<double> delta_costheta;
+    for (int i = 0; i < num_samples; ++i)
+    {
+        Interaction result = interact(rng_engine);
+        SCOPED_TRACE(result);
+        this->sanity_check(result);
+
+        EXPECT_EQ(result.secondaries.data(),
+                  this->secondary_allocator().get().data() + i);
+        const Secondary delta(result.secondaries[0]);
+        delta_energy.push_back(delta.energy.value());
+        delta_costheta.push_back(delta.direction[2]);
+    }
+    EXPECT_EQ(num_samples, this->secondary_allocator().get().size());
+
+    // Note: these are "gold" values based on the host RNG.
+    const double expected_delta_energy[]
+        = {0.103146971213343, 0.179766818708193, 0.321451561517837,
+           0.267330986790683};
+    const double expected_delta_costheta[]
+        = {0.317873395376735, 0.406045970227007, 0.51354353490047,
+           0.478049598095563};
+    EXPECT_VEC_NEAR(expected_delta_energy, delta_energy, this->secondary_tol());
+    EXPECT_VEC_NEAR(
+        expected_delta_costheta, delta_costheta, this->secondary_tol());
+
+    // Next sample should fail because we're out of secondary buffer space
+    {
+        Interaction result = interact(rng_engine);
+        EXPECT_EQ(0, result.secondaries.size());
+        EXPECT_EQ(celeritas::Action::failed, result.action);
+    }
+}
+
+TEST_F(MollerBhabhaInteractorTest, spectrum)
+{
+    const int num_samples = 20000;
+
+    for (auto pdg : {pdg::electron(), pdg::positron()})
+    {
+        SCOPED_TRACE(pdg.get());
+        this->set_inc_particle(pdg, MevEnergy{10});
+        this->resize_secondaries(num_samples);
+        MollerBhabhaInteractor interact(pointers_,
+                                        electron_cut_,
+                                        this->particle_track(),
+                                        this->direction(),
+                                        this->secondary_allocator());
+        RandomEngine&          rng_engine = this->rng();
+
+        const double        edges[] = {0.2, 1.0, 4.0};
+        std::vector<double> above(std::end(edges) - std::begin(edges), 0.0);
+        for (int i = 0; i < num_samples; ++i)
+        {
+            Interaction result = interact(rng_engine);
+            const Secondary delta(result.secondaries.front());
+            for (auto j : celeritas::range(above.size()))
+            {
+                if (delta.energy.value() > edges[j])
+                {
+                    above[j] += 1.0 / num_samples;
+                }
+            }
+        }
+
+        // Sampled spectrum is consistent with the restricted cross section
+        const real_type total = this->calc_xs(electron_cut_.value());
+        for (auto j : celeritas::range(above.size()))
+        {
+            EXPECT_NEAR(this->calc_xs(edges[j]) / total, above[j], 0.01)
+                << "above " << edges[j] << " MeV";
+        }
+    }
+}
+
+TEST_F(MollerBhabhaInteractorTest, stress_test)
+{
+    RandomEngine& rng_engine = this->rng();
+
+    for (auto pdg : {pdg::electron(), pdg::positron()})
+    {
+        for (double inc_e : {0.201, 1.0, 10.0, 1e3, 1e5, 1e8})
+        {
+            this->set_inc_particle(pdg, MevEnergy{inc_e});
+            for (const Real3& inc_dir : {Real3{0, 0, 1},
+                                         Real3{1, 0, 0},
+                                         Real3{1e-9, 0, 1},
+                                         Real3{1, 1, 1}})
+            {
+                SCOPED_TRACE("Incident direction: " + to_string(inc_dir));
+                this->set_inc_direction(inc_dir);
+                this->resize_secondaries(16);
+                MollerBhabhaInteractor interact(pointers_,
+                                                electron_cut_,
+                                                this->particle_track(),
+                                                this->direction(),
+                                                this->secondary_allocator());
+                for (int i = 0; i < 16; ++i)
+                {
+                    Interaction result = interact(rng_engine);
+                    SCOPED_TRACE(result);
+                    this->sanity_check(result);
+                }
+            }
+        }
+    }
+}
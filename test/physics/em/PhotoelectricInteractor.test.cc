@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #include "physics/em/PhotoelectricInteractor.hh"
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include "celeritas_test.hh"
 #include "base/ArrayUtils.hh"
@@ -103,10 +105,11 @@ class PhotoelectricInteractorTest
         ASSERT_GT(2, interaction.secondaries.size());
         if (interaction.secondaries.size() == 1)
         {
-            const auto& electron = interaction.secondaries.front();
+            const Secondary electron(interaction.secondaries.front());
             EXPECT_TRUE(electron);
             EXPECT_EQ(pointers_.electron_id, electron.def_id);
-            EXPECT_GT(this->particle_track().energy().value(),
+            EXPECT_GT(this->particle_track().energy().value()
+                          * (1 + this->secondary_tol()),
                       electron.energy.value());
             EXPECT_LT(0, electron.energy.value());
             EXPECT_SOFT_EQ(1.0, celeritas::norm(electron.direction));
@@ -118,6 +121,26 @@ class PhotoelectricInteractorTest
         // this->check_conservation(interaction);
     }
 
+    // Interpolate the cross section of each subshell within a shared grid bin
+    std::vector<real_type> calc_shell_xs(const celeritas::LivermoreElement& el,
+                                         celeritas::size_type bin,
+                                         real_type            frac) const
+    {
+        const auto       num_shells = el.shells.size();
+        const real_type* cum_lo = el.shell_cum_xs.data() + bin * num_shells;
+        const real_type* cum_hi = cum_lo + num_shells;
+
+        std::vector<real_type> result;
+        real_type              prev = 0;
+        for (auto j : celeritas::range(num_shells))
+        {
+            real_type cum = cum_lo[j] + frac * (cum_hi[j] - cum_lo[j]);
+            result.push_back(cum - prev);
+            prev = cum;
+        }
+        return result;
+    }
+
   protected:
     std::shared_ptr<LivermoreParams>           livermore_params_;
     celeritas::PhotoelectricInteractorPointers pointers_;
@@ -159,9 +182,10 @@ TEST_F(PhotoelectricInteractorTest, basic)
                   this->secondary_allocator().get().data() + i);
 
         // Add actual results to vector
-        energy_electron.push_back(result.secondaries.front().energy.value());
-        costheta_electron.push_back(celeritas::dot_product(
-            result.secondaries.front().direction, this->direction()));
+        const Secondary electron(result.secondaries.front());
+        energy_electron.push_back(electron.energy.value());
+        costheta_electron.push_back(
+            celeritas::dot_product(electron.direction, this->direction()));
         energy_deposition.push_back(result.energy_deposition.value());
     }
 
@@ -174,8 +198,10 @@ TEST_F(PhotoelectricInteractorTest, basic)
         0.1217302869581, 0.8769397871407, -0.1414717733267, -0.2414106440617};
     const double expected_energy_deposition[]
         = {0.00037116, 0.00037116, 0.00029864, 0.00030165};
-    EXPECT_VEC_SOFT_EQ(expected_energy_electron, energy_electron);
-    EXPECT_VEC_SOFT_EQ(expected_costheta_electron, costheta_electron);
+    EXPECT_VEC_NEAR(
+        expected_energy_electron, energy_electron, this->secondary_tol());
+    EXPECT_VEC_NEAR(
+        expected_costheta_electron, costheta_electron, this->secondary_tol());
     EXPECT_VEC_SOFT_EQ(expected_energy_deposition, energy_deposition);
 
     // Next sample should fail because we're out of secondary buffer space
@@ -186,6 +212,223 @@ TEST_F(PhotoelectricInteractorTest, basic)
     }
 }
 
+TEST_F(PhotoelectricInteractorTest, shared_shell_grid)
+{
+    std::string           data_path = this->test_data_path("physics/em", "");
+    LivermoreParamsReader read_element_data(data_path.c_str());
+    const LivermoreParams::ElementInput inp = read_element_data(19);
+
+    const auto& el         = data_.elements.front();
+    const auto  num_shells = el.shells.size();
+    ASSERT_EQ(inp.shells.size(), num_shells);
+    ASSERT_LT(1, el.shell_energy.size());
+    EXPECT_EQ(el.shell_energy.size() * num_shells, el.shell_cum_xs.size());
+    EXPECT_TRUE(std::is_sorted(el.shell_energy.begin(), el.shell_energy.end()));
+    EXPECT_TRUE(std::is_sorted(el.shell_cum_xs.begin(),
+                               el.shell_cum_xs.begin() + num_shells));
+
+    // Default grid is the union of the tabulated energies below the threshold
+    const real_type thresh = el.thresh_low.value();
+    EXPECT_EQ(thresh, el.shell_energy.back());
+    for (auto j : celeritas::range(num_shells))
+    {
+        const auto& shell = inp.shells[j];
+        for (auto i : celeritas::range(shell.energy.size()))
+        {
+            const real_type energy = shell.energy[i];
+            if (energy >= thresh)
+                break;
+            auto iter = std::upper_bound(
+                el.shell_energy.begin(), el.shell_energy.end(), energy);
+            ASSERT_TRUE(iter != el.shell_energy.begin()
+                        && *(iter - 1) == energy)
+                << "at " << energy;
+            auto bin = iter - el.shell_energy.begin() - 1;
+            EXPECT_SOFT_EQ(shell.xs[i], this->calc_shell_xs(el, bin, 0)[j])
+                << "at " << energy;
+
+            if (i == 0)
+            {
+                // Edge is duplicated, and the subshell is closed at the first
+                ASSERT_TRUE(el.shell_energy[bin - 1] == energy)
+                    << "at " << energy;
+                EXPECT_EQ(0, this->calc_shell_xs(el, bin - 1, 0)[j])
+                    << "at " << energy;
+            }
+        }
+    }
+}
+
+TEST_F(PhotoelectricInteractorTest, resampled_shell_grid)
+{
+    std::string           data_path = this->test_data_path("physics/em", "");
+    LivermoreParamsReader read_element_data(data_path.c_str());
+    const LivermoreParams::ElementInput inp = read_element_data(19);
+
+    // Opt in to lossy resampling
+    LivermoreParams::Input li;
+    li.elements.push_back(inp);
+    li.shell_xs_tol = 0.01;
+    this->set_livermore_params(li);
+
+    const auto& el         = data_.elements.front();
+    const auto  num_shells = el.shells.size();
+    ASSERT_EQ(inp.shells.size(), num_shells);
+    ASSERT_LT(1, el.shell_energy.size());
+    EXPECT_EQ(el.shell_energy.size() * num_shells, el.shell_cum_xs.size());
+    EXPECT_TRUE(std::is_sorted(el.shell_energy.begin(), el.shell_energy.end()));
+
+    // Grid ends at the threshold and includes every binding energy below it
+    const real_type thresh = el.thresh_low.value();
+    EXPECT_EQ(thresh, el.shell_energy.back());
+    celeritas::size_type separate_size = 0;
+    for (const auto& shell : inp.shells)
+    {
+        separate_size += shell.energy.size() + shell.xs.size();
+        if (shell.energy.front() < thresh)
+        {
+            EXPECT_TRUE(std::binary_search(el.shell_energy.begin(),
+                                           el.shell_energy.end(),
+                                           shell.energy.front()))
+                << "at " << shell.energy.front();
+        }
+    }
+
+    // Resampled table is smaller than the separate subshell tables
+    EXPECT_LT(el.shell_energy.size() + el.shell_cum_xs.size(), separate_size);
+
+    // Open subshell cross sections match to within the tolerance at every
+    // tabulated energy below the threshold
+    for (const auto& tabulated : inp.shells)
+    {
+        for (real_type energy : tabulated.energy)
+        {
+            if (energy >= thresh)
+                break;
+            auto bin = std::upper_bound(el.shell_energy.begin(),
+                                        el.shell_energy.end(),
+                                        energy)
+                       - el.shell_energy.begin() - 1;
+            const real_type frac
+                = (energy - el.shell_energy[bin])
+                  / (el.shell_energy[bin + 1] - el.shell_energy[bin]);
+            const auto actual = this->calc_shell_xs(el, bin, frac);
+
+            real_type total = 0;
+            real_type error = 0;
+            for (auto j : celeritas::range(num_shells))
+            {
+                const auto& shell = inp.shells[j];
+                if (energy <= shell.energy.front())
+                    continue;
+                celeritas::ValueGrid grid;
+                grid.energy = celeritas::make_span(shell.energy);
+                grid.xs     = celeritas::make_span(shell.xs);
+                grid.interp = celeritas::Interp::linear;
+                real_type expected = celeritas::XsCalculator(grid)(energy);
+                total += expected;
+                error += std::fabs(actual[j] - expected);
+            }
+            EXPECT_LE(error, 0.01 * total * (1 + 1e-12)) << "at " << energy;
+        }
+    }
+}
+
+TEST_F(PhotoelectricInteractorTest, shell_selection)
+{
+    std::string           data_path = this->test_data_path("physics/em", "");
+    LivermoreParamsReader read_element_data(data_path.c_str());
+    const LivermoreParams::ElementInput inp = read_element_data(19);
+
+    // Separate subshell tables, as stored before the shared grid
+    std::vector<celeritas::ValueGrid> shell_grids;
+    for (const auto& shell : inp.shells)
+    {
+        celeritas::ValueGrid grid;
+        grid.energy = celeritas::make_span(shell.energy);
+        grid.xs     = celeritas::make_span(shell.xs);
+        grid.interp = celeritas::Interp::linear;
+        shell_grids.push_back(grid);
+    }
+
+    // Select a subshell from the separate tables as the interactor used to
+    auto select_shell = [&](real_type energy, real_type cutoff) {
+        const auto last_shell = inp.shells.size() - 1;
+        real_type  xs         = 0;
+        for (auto j : celeritas::range(last_shell))
+        {
+            if (energy > inp.shells[j].binding_energy.value())
+            {
+                xs += celeritas::XsCalculator(shell_grids[j])(energy)
+                      / (energy * energy * energy);
+                if (xs >= cutoff)
+                    return j;
+            }
+        }
+        return last_shell;
+    };
+
+    // Sample energies log-uniformly between the lowest edge and threshold
+    const real_type thresh     = inp.thresh_low.value();
+    real_type       min_energy = thresh;
+    for (const auto& shell : inp.shells)
+    {
+        min_energy = std::min(min_energy, shell.energy.front());
+    }
+    const int num_energies = 64;
+    const int num_samples  = 32;
+
+    ElementDefId  el_id{0};
+    RandomEngine& rng_engine   = this->rng();
+    int           num_compared = 0;
+    for (int i : celeritas::range(num_energies))
+    {
+        const real_type energy
+            = min_energy
+              * std::pow(thresh / min_energy, (i + 0.5) / num_energies);
+        SCOPED_TRACE("Incident energy: " + std::to_string(energy));
+        this->set_inc_particle(pdg::gamma(), MevEnergy{energy});
+        this->resize_secondaries(num_samples);
+
+        // Normalize by the total cross section of the open subshells
+        real_type micro_xs = 0;
+        for (auto j : celeritas::range(inp.shells.size()))
+        {
+            if (energy > inp.shells[j].binding_energy.value())
+            {
+                micro_xs += celeritas::XsCalculator(shell_grids[j])(energy)
+                            / (energy * energy * energy);
+            }
+        }
+
+        PhotoelectricInteractor interact(pointers_,
+                                         data_,
+                                         el_id,
+                                         micro_xs,
+                                         this->particle_track(),
+                                         this->direction(),
+                                         this->secondary_allocator());
+        for (int j = 0; j < num_samples; ++j)
+        {
+            // The first random number sets the cross section cutoff
+            const RandomEngine& rng_state = rng_engine;
+            RandomEngine        rng_copy(rng_state);
+            const real_type cutoff
+                = celeritas::generate_canonical(rng_copy) * micro_xs;
+            const auto expected = select_shell(energy, cutoff);
+
+            // The deposited energy is the selected shell's binding energy
+            Interaction result = interact(rng_engine);
+            ASSERT_TRUE(result);
+            EXPECT_EQ(inp.shells[expected].binding_energy.value(),
+                      result.energy_deposition.value())
+                << "with cutoff " << cutoff;
+            ++num_compared;
+        }
+    }
+    EXPECT_EQ(num_energies * num_samples, num_compared);
+}
+
 TEST_F(PhotoelectricInteractorTest, stress_test)
 {
     RandomEngine& rng_engine = this->rng();
@@ -238,3 +481,58 @@ TEST_F(PhotoelectricInteractorTest, stress_test)
         = {15.99755859375, 16.09204101562, 13.79919433594, 8.590209960938, 2};
     EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
 }
+
+TEST_F(PhotoelectricInteractorTest, precalculated_micro_xs)
+{
+    ElementDefId el_id{0};
+
+    for (double inc_e : {0.0001, 0.001, 0.01, 1.0, 1000.0})
+    {
+        SCOPED_TRACE("Incident energy: " + std::to_string(inc_e));
+        this->set_inc_particle(pdg::gamma(), MevEnergy{inc_e});
+        this->resize_secondaries(16);
+
+        // Cross section as calculated during element selection
+        celeritas::PhotoelectricMicroXsCalculator calc_micro_xs(
+            pointers_, data_, this->particle_track());
+        real_type micro_xs = calc_micro_xs(el_id);
+        EXPECT_LT(0, micro_xs);
+
+        PhotoelectricInteractor interact(pointers_,
+                                         data_,
+                                         el_id,
+                                         this->particle_track(),
+                                         this->direction(),
+                                         this->secondary_allocator());
+        PhotoelectricInteractor interact_cached(pointers_,
+                                                data_,
+                                                el_id,
+                                                micro_xs,
+                                                this->particle_track(),
+                                                this->direction(),
+                                                this->secondary_allocator());
+
+        // Both interactors must give identical results from identical streams
+        RandomEngine rng_engine;
+        RandomEngine rng_engine_cached;
+        for (int i = 0; i < 8; ++i)
+        {
+            Interaction expected = interact(rng_engine);
+            Interaction actual   = interact_cached(rng_engine_cached);
+            ASSERT_EQ(expected.secondaries.size(), actual.secondaries.size());
+            EXPECT_EQ(expected.energy_deposition.value(),
+                      actual.energy_deposition.value());
+            if (!expected.secondaries.empty())
+            {
+                const Secondary expected_electron(
+                    expected.secondaries.front());
+                const Secondary actual_electron(actual.secondaries.front());
+                EXPECT_EQ(expected_electron.energy.value(),
+                          actual_electron.energy.value());
+                EXPECT_EQ(expected_electron.direction,
+                          actual_electron.direction);
+            }
+        }
+        EXPECT_EQ(rng_engine.count(), rng_engine_cached.count());
+    }
+}
@@ -7,15 +7,25 @@
 //---------------------------------------------------------------------------//
 #include "physics/em/RayleighInteractor.hh"
 
+#include <cmath>
+#include <memory>
 #include "celeritas_test.hh"
 #include "base/ArrayUtils.hh"
+#include "base/Constants.hh"
 #include "base/Range.hh"
 #include "physics/base/Units.hh"
+#include "physics/em/RayleighMicroXsCalculator.hh"
+#include "physics/em/RayleighParams.hh"
 #include "../InteractorHostTestBase.hh"
 #include "../InteractionIO.hh"
 
+using celeritas::ElementDefId;
 using celeritas::RayleighInteractor;
-namespace pdg = celeritas::pdg;
+using celeritas::RayleighMicroXsCalculator;
+using celeritas::RayleighParams;
+using celeritas::units::AmuMass;
+namespace constants = celeritas::constants;
+namespace pdg       = celeritas::pdg;
 
 //---------------------------------------------------------------------------//
 // TEST HARNESS
@@ -33,7 +43,6 @@ class RayleighInteractorTest : public celeritas_test::InteractorHostTestBase
         constexpr auto zero   = celeritas::zero_quantity();
         constexpr auto stable = ParticleDef::stable_decay_constant();
 
-        // XXX Update these based on particles needed by interactor
         Base::set_particle_params(
             {{"electron",
               pdg::electron(),
@@ -41,12 +50,36 @@ class RayleighInteractorTest : public celeritas_test::InteractorHostTestBase
               ElementaryCharge{-1},
               stable},
              {"gamma", pdg::gamma(), zero, zero, stable}});
-        const auto& params    = this->particle_params();
-        pointers_.electron_id = params.find(pdg::electron());
-        pointers_.gamma_id    = params.find(pdg::gamma());
+        const auto& params = this->particle_params();
+        pointers_.gamma_id = params.find(pdg::gamma());
 
-        // Set default particle to incident XXX MeV photon
-        this->set_inc_particle(pdg::gamma(), MevEnergy{10});
+        MaterialParams::Input inp;
+        inp.elements  = {{1, AmuMass{1.008}, "H"},
+                        {82, AmuMass{207.2}, "Pb"}};
+        inp.materials = {
+            {1.0 * constants::na_avogadro,
+             293.0,
+             celeritas::MatterState::solid,
+             {{ElementDefId{0}, 1.0}},
+             "H"},
+            {1.0 * constants::na_avogadro,
+             293.0,
+             celeritas::MatterState::solid,
+             {{ElementDefId{1}, 1.0}},
+             "Pb"},
+        };
+        this->set_material_params(inp);
+        this->set_material("Pb");
+
+        // Ten points per decade from 1 eV to 10 GeV
+        RayleighParams::Input rayleigh_inp;
+        rayleigh_inp.log_energy = {101, std::log(1e-6), std::log(10.0) / 10};
+        rayleigh_ = std::make_shared<RayleighParams>(this->material_params(),
+                                                     rayleigh_inp);
+        data_     = rayleigh_->host_pointers();
+
+        // Set default particle to incident 1 MeV photon
+        this->set_inc_particle(pdg::gamma(), MevEnergy{1});
         this->set_inc_direction({0, 0, 1});
     }
 
@@ -54,25 +87,276 @@ class RayleighInteractorTest : public celeritas_test::InteractorHostTestBase
     {
         ASSERT_TRUE(interaction);
 
-        // Check change to parent track
-        EXPECT_GT(this->particle_track().energy().value(),
+        // Check change to parent track: elastic, no secondaries
+        EXPECT_EQ(this->particle_track().energy().value(),
                   interaction.energy.value());
-        EXPECT_LT(0, interaction.energy.value());
         EXPECT_SOFT_EQ(1.0, celeritas::norm(interaction.direction));
         EXPECT_EQ(celeritas::Action::scattered, interaction.action);
+        EXPECT_EQ(0, interaction.secondaries.size());
+        EXPECT_EQ(0, interaction.energy_deposition.value());
+    }
 
-        // XXX Check secondaries
+    //! Exact unnormalized angular distribution in x = 1 - mu
+    static real_type
+    calc_pdf(const celeritas::Array<real_type, 3>& c, real_type x)
+    {
+        const real_type alpha[] = {0.10, 0.55, 0.35};
+        real_type       ff      = 0;
+        for (auto i : celeritas::range(3))
+        {
+            ff += alpha[i] / (1 + c[i] * x);
+        }
+        return (1 + (1 - x) * (1 - x)) * ff * ff;
+    }
 
-        // Check conservation between primary and secondaries
-        this->check_conservation(interaction);
+    //! Reference cumulative distribution at x, integrated on a fine grid
+    real_type calc_cdf(ElementDefId el, real_type energy, real_type x) const
+    {
+        auto c = rayleigh_->screening(el);
+        for (real_type& ci : c)
+        {
+            ci *= 2 * energy * energy;
+        }
+        // Integrate in ln(x) from a negligibly small angle
+        auto integrate = [&c](real_type upper) {
+            const real_type lower = 1e-24;
+            const int       n     = 20000;
+            const real_type h     = std::log(upper / lower) / n;
+            real_type       result = lower * calc_pdf(c, 0);
+            for (auto i : celeritas::range(n + 1))
+            {
+                const real_type xi = lower * std::exp(i * h);
+                const int       weight
+                    = (i == 0 || i == n) ? 1 : (i % 2 == 1 ? 4 : 2);
+                result += h / 3 * weight * xi * calc_pdf(c, xi);
+            }
+            return result;
+        };
+        return integrate(x) / integrate(2);
     }
 
   protected:
     celeritas::RayleighInteractorPointers pointers_;
+    std::shared_ptr<RayleighParams>       rayleigh_;
+    celeritas::RayleighParamsPointers     data_;
 };
 
 //---------------------------------------------------------------------------//
 // TESTS
 //---------------------------------------------------------------------------//
 
-TEST_F(RayleighInteractorTest, basic) {}
+TEST_F(RayleighInteractorTest, params)
+{
+    EXPECT_EQ(2, data_.num_elements());
+    EXPECT_EQ(128, data_.num_angles);
+
+    const real_type thomson = 8 * constants::pi / 3 * constants::re_electron
+                              * constants::re_electron;
+
+    // At low energy the atom scatters coherently: sigma = Z^2 sigma_T
+    EXPECT_SOFT_NEAR(thomson, data_.xs[data_.row(ElementDefId{0}, 0)], 1e-5);
+    EXPECT_SOFT_NEAR(
+        82 * 82 * thomson, data_.xs[data_.row(ElementDefId{1}, 0)], 1e-5);
+
+    // Screening lengths scale as Z^{-1/3}
+    auto h_screen  = rayleigh_->screening(ElementDefId{0});
+    auto pb_screen = rayleigh_->screening(ElementDefId{1});
+    EXPECT_SOFT_EQ(std::pow(82.0, 2.0 / 3), h_screen[0] / pb_screen[0]);
+    EXPECT_SOFT_EQ(25.0, h_screen[1] / h_screen[0]);
+
+    // Tabulated CDF matches the exact distribution
+    for (auto el : {ElementDefId{0}, ElementDefId{1}})
+    {
+        for (auto e : {0, 50, 60, 100})
+        {
+            const celeritas::size_type row = data_.row(el, e);
+            const real_type energy
+                = std::exp(data_.log_energy.front + e * data_.log_energy.delta);
+            const real_type* cdf = data_.cdf.data() + row * data_.num_angles;
+            EXPECT_EQ(0, cdf[0]);
+            EXPECT_EQ(1, cdf[data_.num_angles - 1]);
+            for (auto j : {1, 32, 64, 96})
+            {
+                const real_type delta = (std::log(2.0) - data_.log_x_min[row])
+                                        / (data_.num_angles - 2);
+                const real_type x
+                    = std::exp(data_.log_x_min[row] + (j - 1) * delta);
+                EXPECT_SOFT_NEAR(calc_cdf(el, energy, x), cdf[j], 1e-6);
+            }
+        }
+    }
+}
+
+TEST_F(RayleighInteractorTest, micro_xs)
+{
+    const real_type pi_re2 = constants::pi * constants::re_electron
+                             * constants::re_electron;
+    std::vector<real_type> xs;
+    for (real_type energy : {1e-7, 1e-3, 1.0, 1e4})
+    {
+        this->set_inc_particle(pdg::gamma(), MevEnergy{energy});
+        RayleighMicroXsCalculator calc_xs(
+            pointers_, data_, this->particle_track());
+        xs.push_back(calc_xs(ElementDefId{1}) / (82 * 82 * pi_re2));
+    }
+    // Thomson limit, then suppression by the form factor
+    EXPECT_SOFT_NEAR(8.0 / 3, xs[0], 1e-5);
+    EXPECT_GT(xs[0], xs[1]);
+    EXPECT_GT(xs[1], xs[2]);
+
+    // High energy limit: 2 sum_ij alpha_i alpha_j ln(c_i/c_j)/(c_i - c_j)
+    {
+        const real_type alpha[] = {0.10, 0.55, 0.35};
+        auto            c       = rayleigh_->screening(ElementDefId{1});
+        real_type       expected = 0;
+        for (auto i : celeritas::range(3))
+        {
+            c[i] *= 2 * 1e4 * 1e4;
+        }
+        for (auto i : celeritas::range(3))
+        {
+            for (auto j : celeritas::range(3))
+            {
+                expected += alpha[i] * alpha[j]
+                            * (i == j ? 1 / c[i]
+                                      : std::log(c[i] / c[j]) / (c[i] - c[j]));
+            }
+        }
+        EXPECT_SOFT_NEAR(2 * expected, xs[3], 1e-4);
+    }
+
+    // Power-law extrapolation above the grid
+    this->set_inc_particle(pdg::gamma(), MevEnergy{1e5});
+    RayleighMicroXsCalculator calc_xs(pointers_, data_, this->particle_track());
+    EXPECT_SOFT_NEAR(
+        xs[3] / 100, calc_xs(ElementDefId{1}) / (82 * 82 * pi_re2), 1e-4);
+}
+
+TEST_F(RayleighInteractorTest, basic)
+{
+    const int num_samples = 4;
+
+    RayleighInteractor interact(pointers_,
+                                data_,
+                                ElementDefId{1},
+                                this->particle_track(),
+                                this->direction());
+    RandomEngine&      rng_engine = this->rng();
+
+    std::vector<double> costheta;
+    std::vector<int>    rng_count;
+    for (int i = 0; i < num_samples; ++i)
+    {
+        rng_engine.reset_count();
+        Interaction result = interact(rng_engine);
+        SCOPED_TRACE(result);
+        this->sanity_check(result);
+        costheta.push_back(result.direction[2]);
+        rng_count.push_back(rng_engine.count());
+    }
+
+    // Sampling never rejects, so every sample takes the same number of draws
+    const int expected_rng_count[] = {6, 6, 6, 6};
+    EXPECT_VEC_EQ(expected_rng_count, rng_count);
+
+    // Note: these are "gold" values based on the host RNG.
+    const double expected_costheta[] = {0.991748551381525,
+                                        0.999754400244783,
+                                        0.807219719687167,
+                                        0.996439968391347};
+    EXPECT_VEC_SOFT_EQ(expected_costheta, costheta);
+}
+
+TEST_F(RayleighInteractorTest, thomson_distribution)
+{
+    // Below the screening scale of hydrogen the distribution is 1 + mu^2
+    this->set_inc_particle(pdg::gamma(), MevEnergy{1e-5});
+    this->set_inc_direction({1, 0, 0});
+
+    RayleighInteractor interact(pointers_,
+                                data_,
+                                ElementDefId{0},
+                                this->particle_track(),
+                                this->direction());
+    RandomEngine&      rng_engine = this->rng();
+
+    const int num_samples = 20000;
+    double    sum_mu      = 0;
+    double    sum_mu_sq   = 0;
+    for (int i = 0; i < num_samples; ++i)
+    {
+        Interaction result = interact(rng_engine);
+        double      mu     = result.direction[0];
+        sum_mu += mu;
+        sum_mu_sq += mu * mu;
+    }
+    EXPECT_NEAR(0, sum_mu / num_samples, 0.01);
+    EXPECT_NEAR(0.4, sum_mu_sq / num_samples, 0.01);
+}
+
+TEST_F(RayleighInteractorTest, form_factor_distribution)
+{
+    // Lead at 1 MeV: most scattering is within a few degrees
+    RayleighInteractor interact(pointers_,
+                                data_,
+                                ElementDefId{1},
+                                this->particle_track(),
+                                this->direction());
+    RandomEngine&      rng_engine = this->rng();
+
+    const double edges[]     = {1e-5, 1e-4, 1e-3, 1e-2, 1e-1};
+    const int    num_samples = 20000;
+    std::vector<double> below(std::end(edges) - std::begin(edges), 0.0);
+    for (int i = 0; i < num_samples; ++i)
+    {
+        Interaction result = interact(rng_engine);
+        double      x      = 1 - result.direction[2];
+        for (auto j : celeritas::range(below.size()))
+        {
+            if (x < edges[j])
+            {
+                below[j] += 1.0 / num_samples;
+            }
+        }
+    }
+
+    std::vector<double> expected;
+    for (double x : edges)
+    {
+        expected.push_back(this->calc_cdf(ElementDefId{1}, 1.0, x));
+    }
+    for (auto j : celeritas::range(below.size()))
+    {
+        EXPECT_NEAR(expected[j], below[j], 0.015) << "at x=" << edges[j];
+    }
+}
+
+TEST_F(RayleighInteractorTest, stress_test)
+{
+    RandomEngine& rng_engine = this->rng();
+
+    for (double inc_e : {1e-5, 0.0123, 1.0, 314.0, 1e8})
+    {
+        this->set_inc_particle(pdg::gamma(), MevEnergy{inc_e});
+        for (const Real3& inc_dir :
+             {Real3{0, 0, 1}, Real3{1, 0, 0}, Real3{1e-9, 0, 1}, Real3{1, 1, 1}})
+        {
+            SCOPED_TRACE("Incident direction: " + to_string(inc_dir));
+            this->set_inc_direction(inc_dir);
+            for (auto el : {ElementDefId{0}, ElementDefId{1}})
+            {
+                RayleighInteractor interact(pointers_,
+                                            data_,
+                                            el,
+                                            this->particle_track(),
+                                            this->direction());
+                for (int i = 0; i < 16; ++i)
+                {
+                    Interaction result = interact(rng_engine);
+                    SCOPED_TRACE(result);
+                    this->sanity_check(result);
+                }
+            }
+        }
+    }
+}
@@ -7,15 +7,22 @@
 //---------------------------------------------------------------------------//
 #include "physics/em/UrbanInteractor.hh"
 
+#include <cmath>
+#include <memory>
+#include <random>
 #include "celeritas_test.hh"
 #include "base/ArrayUtils.hh"
+#include "base/Constants.hh"
 #include "base/Range.hh"
 #include "physics/base/Units.hh"
+#include "physics/em/UrbanMfpCalculator.hh"
+#include "physics/em/UrbanParams.hh"
+#include "physics/material/MaterialView.hh"
 #include "../InteractorHostTestBase.hh"
 #include "../InteractionIO.hh"
 
 using celeritas::UrbanInteractor;
-namespace pdg = celeritas::pdg;
+using namespace celeritas;
 
 //---------------------------------------------------------------------------//
 // TEST HARNESS
@@ -28,51 +35,306 @@ class UrbanInteractorTest : public celeritas_test::InteractorHostTestBase
   protected:
     void SetUp() override
     {
-        using celeritas::ParticleDef;
         using namespace celeritas::units;
-        constexpr auto zero   = celeritas::zero_quantity();
         constexpr auto stable = ParticleDef::stable_decay_constant();
 
-        // XXX Update these based on particles needed by interactor
-        Base::set_particle_params(
-            {{"electron",
-              pdg::electron(),
-              MevMass{0.5109989461},
-              ElementaryCharge{-1},
-              stable},
-             {"gamma", pdg::gamma(), zero, zero, stable}});
+        Base::set_particle_params({{"electron",
+                                    pdg::electron(),
+                                    MevMass{0.5109989461},
+                                    ElementaryCharge{-1},
+                                    stable},
+                                   {"positron",
+                                    pdg::positron(),
+                                    MevMass{0.5109989461},
+                                    ElementaryCharge{1},
+                                    stable}});
         const auto& params    = this->particle_params();
         pointers_.electron_id = params.find(pdg::electron());
-        pointers_.gamma_id    = params.find(pdg::gamma());
+        pointers_.positron_id = params.find(pdg::positron());
 
-        // Set default particle to incident XXX MeV photon
-        this->set_inc_particle(pdg::gamma(), MevEnergy{10});
+        // Set default particle to incident 10 MeV electron
+        this->set_inc_particle(pdg::electron(), MevEnergy{10});
         this->set_inc_direction({0, 0, 1});
+
+        // Create test materials
+        Base::set_material_params({
+            {
+                {1, AmuMass{1.008}, "H"},
+                {11, AmuMass{22.98976928}, "Na"},
+                {53, AmuMass{126.90447}, "I"},
+            },
+            {
+                {1e-5 * constants::na_avogadro,
+                 100.0,
+                 MatterState::gas,
+                 {{ElementDefId{0}, 1.0}},
+                 "H2"},
+                {0.05 * constants::na_avogadro,
+                 293.0,
+                 MatterState::solid,
+                 {{ElementDefId{1}, 0.5}, {ElementDefId{2}, 0.5}},
+                 "NaI"},
+            },
+        });
+        this->set_material("NaI");
+
+        // Ten points per decade from 1 keV to 100 MeV
+        UrbanParams::Input inp;
+        inp.log_energy = {51, std::log(1e-3), std::log(10.0) / 10};
+        urban_         = std::make_shared<UrbanParams>(
+            this->material_params(), inp);
+        data_ = urban_->host_pointers();
     }
 
     void sanity_check(const Interaction& interaction) const
     {
         ASSERT_TRUE(interaction);
 
-        // Check change to parent track
-        EXPECT_GT(this->particle_track().energy().value(),
+        // Only the direction changes
+        EXPECT_EQ(this->particle_track().energy().value(),
                   interaction.energy.value());
-        EXPECT_LT(0, interaction.energy.value());
         EXPECT_SOFT_EQ(1.0, celeritas::norm(interaction.direction));
         EXPECT_EQ(celeritas::Action::scattered, interaction.action);
+        EXPECT_EQ(0, interaction.secondaries.size());
+    }
 
-        // XXX Check secondaries
+    //! Create an interactor for the current particle and material
+    UrbanInteractor make_interactor(real_type path, real_type end_energy)
+    {
+        return UrbanInteractor(pointers_,
+                               data_,
+                               this->material_track(),
+                               this->particle_track(),
+                               path,
+                               MevEnergy{end_energy},
+                               this->direction());
+    }
 
-        // Check conservation between primary and secondaries
-        this->check_conservation(interaction);
+    //! Transport mean free path at the current track energy
+    real_type lambda()
+    {
+        UrbanMfpCalculator calc_lambda(data_, this->material_track());
+        return calc_lambda(this->particle_track().energy());
+    }
+
+    //! Mean deflection cosine over the given path
+    real_type mean_costheta(real_type path, real_type end_energy)
+    {
+        const int       num_samples = 20000;
+        UrbanInteractor interact    = this->make_interactor(path, end_energy);
+        real_type       result      = 0;
+        for (int i = 0; i < num_samples; ++i)
+        {
+            result += interact(this->rng()).direction[2];
+        }
+        return result / num_samples;
     }
 
   protected:
-    celeritas::UrbanInteractorPointers pointers_;
+    UrbanInteractorPointers      pointers_;
+    std::shared_ptr<UrbanParams> urban_;
+    UrbanParamsPointers          data_;
 };
 
 //---------------------------------------------------------------------------//
 // TESTS
 //---------------------------------------------------------------------------//
 
-TEST_F(UrbanInteractorTest, basic) {}
+TEST_F(UrbanInteractorTest, params)
+{
+    EXPECT_EQ(2, data_.num_materials());
+    EXPECT_EQ(2 * 51, data_.lambda.size());
+
+    // Coefficients depend on the mass-weighted effective Z (~46.6 for NaI)
+    const UrbanMscMaterial& hydrogen_msc = data_.materials[0];
+    EXPECT_SOFT_NEAR(0.83495, hydrogen_msc.theta0[0], 1e-4);
+    EXPECT_SOFT_NEAR(1.39279, hydrogen_msc.positron[4], 1e-4);
+    EXPECT_SOFT_NEAR(1.0047, data_.materials[1].theta0[0], 1e-4);
+
+    // Tabulated mean free path matches direct calculation
+    const MaterialParamsPointers mat_ptrs = this->material_params()
+                                                .host_pointers();
+    const MaterialView           mat(mat_ptrs, MaterialDefId{1});
+    for (auto e : {0, 20, 50})
+    {
+        const MevEnergy energy{
+            std::exp(data_.log_energy.front + e * data_.log_energy.delta)};
+        real_type macro_xs = 0;
+        for (auto i : range<ElementComponentId::value_type>(2))
+        {
+            macro_xs += mat.get_element_density(ElementComponentId{i})
+                        * UrbanParams::transport_xs(
+                            mat.element_view(ElementComponentId{i}), energy);
+        }
+        EXPECT_SOFT_EQ(1 / macro_xs, data_.lambda[data_.row(
+                                         MaterialDefId{1}, e)]);
+    }
+
+    // Transport cross section scales as 1/(beta p)^2 times a logarithm that
+    // grows slowly with energy
+    const ElementView hydrogen(mat_ptrs, ElementDefId{0});
+    const real_type   xs_ratio
+        = UrbanParams::transport_xs(hydrogen, MevEnergy{1})
+          / UrbanParams::transport_xs(hydrogen, MevEnergy{10});
+    auto calc_beta_p_sq = [](real_type energy) {
+        const real_type mass  = 0.5109989461;
+        const real_type p_sq  = energy * (energy + 2 * mass);
+        const real_type total = energy + mass;
+        return p_sq * p_sq / (total * total);
+    };
+    const real_type beta_p_sq_ratio = calc_beta_p_sq(10) / calc_beta_p_sq(1);
+    EXPECT_LT(xs_ratio, beta_p_sq_ratio);
+    EXPECT_GT(xs_ratio, 0.7 * beta_p_sq_ratio);
+}
+
+TEST_F(UrbanInteractorTest, mfp)
+{
+    const MaterialParamsPointers mat_ptrs = this->material_params()
+                                                .host_pointers();
+    const MaterialView           mat(mat_ptrs, MaterialDefId{1});
+    UrbanMfpCalculator           calc_lambda(data_, this->material_track());
+
+    // Interpolation between grid points is accurate
+    for (real_type energy : {3.3e-3, 0.15, 4.2, 99.0})
+    {
+        real_type macro_xs = 0;
+        for (auto i : range<ElementComponentId::value_type>(2))
+        {
+            macro_xs += mat.get_element_density(ElementComponentId{i})
+                        * UrbanParams::transport_xs(
+                            mat.element_view(ElementComponentId{i}),
+                            MevEnergy{energy});
+        }
+        EXPECT_SOFT_NEAR(
+            1 / macro_xs, calc_lambda(MevEnergy{energy}), 2e-3)
+            << "at E=" << energy;
+    }
+
+    // Mean free path is inversely proportional to the density
+    MaterialTrackInitializer state;
+    state.def_id           = MaterialDefId{1};
+    state.density_scale    = 2;
+    this->material_track() = state;
+    UrbanMfpCalculator calc_dense(data_, this->material_track());
+    EXPECT_SOFT_EQ(0.5 * calc_lambda(MevEnergy{1}), calc_dense(MevEnergy{1}));
+
+    // Radiation length is also inversely proportional to the density, so
+    // halving the path in the denser material samples identical deflections
+    this->set_inc_particle(pdg::electron(), MevEnergy{1});
+    const real_type dense_path = 0.01 * this->lambda();
+    for (real_type end_energy : {1.0, 0.7})
+    {
+        std::mt19937    dense_rng;
+        UrbanInteractor interact_dense
+            = this->make_interactor(dense_path, end_energy);
+        this->material_track() = {MaterialDefId{1}, 1};
+        std::mt19937    rng;
+        UrbanInteractor interact
+            = this->make_interactor(2 * dense_path, end_energy);
+        this->material_track() = state;
+        for (int i = 0; i < 8; ++i)
+        {
+            EXPECT_SOFT_EQ(interact(rng).direction[2],
+                           interact_dense(dense_rng).direction[2])
+                << "at E_end=" << end_energy << ", sample " << i;
+        }
+    }
+}
+
+TEST_F(UrbanInteractorTest, basic)
+{
+    UrbanInteractor interact = this->make_interactor(0.01, 10);
+    RandomEngine&   rng_engine = this->rng();
+
+    std::vector<double> costheta;
+    for (int i = 0; i < 4; ++i)
+    {
+        Interaction result = interact(rng_engine);
+        SCOPED_TRACE(result);
+        this->sanity_check(result);
+        costheta.push_back(result.direction[2]);
+    }
+
+    // Note: these are "gold" values based on the host RNG.
+    const double expected_costheta[] = {0.999928932858908,
+                                        0.99671444163281,
+                                        0.992618521500439,
+                                        0.997491922476282};
+    EXPECT_VEC_SOFT_EQ(expected_costheta, costheta);
+}
+
+TEST_F(UrbanInteractorTest, moments)
+{
+    // Mean cosine is exp(-t/lambda) in every sampling regime
+    for (auto pdg : {pdg::electron(), pdg::positron()})
+    {
+        SCOPED_TRACE(pdg.get());
+        for (real_type energy : {0.01, 1.0, 50.0})
+        {
+            this->set_inc_particle(pdg, MevEnergy{energy});
+            const real_type lambda = this->lambda();
+            for (real_type tau : {1e-3, 0.1, 1.0, 3.0})
+            {
+                EXPECT_NEAR(std::exp(-tau),
+                            this->mean_costheta(tau * lambda, energy),
+                            0.01)
+                    << "at E=" << energy << ", tau=" << tau;
+            }
+        }
+    }
+
+    // Distribution becomes isotropic for very long paths
+    this->set_inc_particle(pdg::electron(), MevEnergy{1});
+    EXPECT_NEAR(0, this->mean_costheta(10 * this->lambda(), 1.0), 0.02);
+
+    // Large energy loss along the step: lambda is linear in the path length
+    for (real_type end_energy : {0.8, 0.4})
+    {
+        const real_type lambda_start = this->lambda();
+        const real_type lambda_end   = UrbanMfpCalculator(
+            data_, this->material_track())(MevEnergy{end_energy});
+        const real_type path = 0.5 * lambda_end;
+        const real_type tau  = path * std::log(lambda_start / lambda_end)
+                              / (lambda_start - lambda_end);
+        EXPECT_NEAR(
+            std::exp(-tau), this->mean_costheta(path, end_energy), 0.01)
+            << "at E_end=" << end_energy;
+    }
+}
+
+TEST_F(UrbanInteractorTest, stress_test)
+{
+    RandomEngine& rng_engine = this->rng();
+
+    for (const char* mat : {"H2", "NaI"})
+    {
+        this->set_material(mat);
+        for (auto pdg : {pdg::electron(), pdg::positron()})
+        {
+            for (double inc_e : {1e-3, 0.1, 10.0, 100.0})
+            {
+                this->set_inc_particle(pdg, MevEnergy{inc_e});
+                const real_type lambda = this->lambda();
+                for (const Real3& inc_dir : {Real3{0, 0, 1},
+                                             Real3{1, 0, 0},
+                                             Real3{1e-9, 0, 1},
+                                             Real3{1, 1, 1}})
+                {
+                    SCOPED_TRACE("Incident direction: " + to_string(inc_dir));
+                    this->set_inc_direction(inc_dir);
+                    for (real_type tau : {1e-8, 1e-3, 0.5, 20.0})
+                    {
+                        UrbanInteractor interact
+                            = this->make_interactor(tau * lambda, inc_e);
+                        for (int i = 0; i < 4; ++i)
+                        {
+                            Interaction result = interact(rng_engine);
+                            SCOPED_TRACE(result);
+                            this->sanity_check(result);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
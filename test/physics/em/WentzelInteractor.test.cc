@@ -7,15 +7,24 @@
 //---------------------------------------------------------------------------//
 #include "physics/em/WentzelInteractor.hh"
 
+#include <cmath>
+#include <memory>
+#include <vector>
 #include "celeritas_test.hh"
 #include "base/ArrayUtils.hh"
+#include "base/Constants.hh"
 #include "base/Range.hh"
 #include "physics/base/Units.hh"
+#include "physics/em/WentzelMicroXsCalculator.hh"
+#include "physics/em/WentzelParams.hh"
+#include "physics/material/ElementSelector.hh"
+#include "physics/material/MaterialTrackView.hh"
+#include "physics/material/MaterialView.hh"
 #include "../InteractorHostTestBase.hh"
 #include "../InteractionIO.hh"
 
 using celeritas::WentzelInteractor;
-namespace pdg = celeritas::pdg;
+using namespace celeritas;
 
 //---------------------------------------------------------------------------//
 // TEST HARNESS
@@ -28,51 +37,361 @@ class WentzelInteractorTest : public celeritas_test::InteractorHostTestBase
   protected:
     void SetUp() override
     {
-        using celeritas::ParticleDef;
         using namespace celeritas::units;
-        constexpr auto zero   = celeritas::zero_quantity();
         constexpr auto stable = ParticleDef::stable_decay_constant();
 
-        // XXX Update these based on particles needed by interactor
-        Base::set_particle_params(
-            {{"electron",
-              pdg::electron(),
-              MevMass{0.5109989461},
-              ElementaryCharge{-1},
-              stable},
-             {"gamma", pdg::gamma(), zero, zero, stable}});
+        Base::set_particle_params({{"electron",
+                                    pdg::electron(),
+                                    MevMass{0.5109989461},
+                                    ElementaryCharge{-1},
+                                    stable},
+                                   {"positron",
+                                    pdg::positron(),
+                                    MevMass{0.5109989461},
+                                    ElementaryCharge{1},
+                                    stable},
+                                   {"mu_minus",
+                                    pdg::mu_minus(),
+                                    MevMass{105.6583745},
+                                    ElementaryCharge{-1},
+                                    stable},
+                                   {"mu_plus",
+                                    pdg::mu_plus(),
+                                    MevMass{105.6583745},
+                                    ElementaryCharge{1},
+                                    stable}});
         const auto& params    = this->particle_params();
         pointers_.electron_id = params.find(pdg::electron());
-        pointers_.gamma_id    = params.find(pdg::gamma());
+        pointers_.positron_id = params.find(pdg::positron());
+        pointers_.mu_minus_id = params.find(pdg::mu_minus());
+        pointers_.mu_plus_id  = params.find(pdg::mu_plus());
 
-        // Set default particle to incident XXX MeV photon
-        this->set_inc_particle(pdg::gamma(), MevEnergy{10});
+        // Set default particle to incident 10 MeV electron
+        this->set_inc_particle(pdg::electron(), MevEnergy{10});
         this->set_inc_direction({0, 0, 1});
+
+        // Create test materials
+        Base::set_material_params({
+            {
+                {1, AmuMass{1.008}, "H"},
+                {11, AmuMass{22.98976928}, "Na"},
+                {53, AmuMass{126.90447}, "I"},
+            },
+            {
+                {1e-5 * constants::na_avogadro,
+                 100.0,
+                 MatterState::gas,
+                 {{ElementDefId{0}, 1.0}},
+                 "H2"},
+                {0.05 * constants::na_avogadro,
+                 293.0,
+                 MatterState::solid,
+                 {{ElementDefId{1}, 0.5}, {ElementDefId{2}, 0.5}},
+                 "NaI"},
+            },
+        });
+        this->set_material("NaI");
+
+        // Ten points per decade from 1 keV to 100 GeV
+        WentzelParams::Input inp;
+        inp.log_energy = {81, std::log(1e-3), std::log(10.0) / 10};
+        wentzel_       = std::make_shared<WentzelParams>(
+            this->material_params(), inp);
+        data_ = wentzel_->host_pointers();
     }
 
     void sanity_check(const Interaction& interaction) const
     {
         ASSERT_TRUE(interaction);
 
-        // Check change to parent track
-        EXPECT_GT(this->particle_track().energy().value(),
+        // Only the direction changes
+        EXPECT_EQ(this->particle_track().energy().value(),
                   interaction.energy.value());
-        EXPECT_LT(0, interaction.energy.value());
         EXPECT_SOFT_EQ(1.0, celeritas::norm(interaction.direction));
         EXPECT_EQ(celeritas::Action::scattered, interaction.action);
+        EXPECT_EQ(0, interaction.secondaries.size());
+    }
+
+    //! Create an interactor for the current particle
+    WentzelInteractor make_interactor(ElementDefId el, real_type costheta_limit)
+    {
+        return WentzelInteractor(pointers_,
+                                 data_,
+                                 el,
+                                 this->particle_track(),
+                                 costheta_limit,
+                                 this->direction());
+    }
 
-        // XXX Check secondaries
+    //! Cross section for the current particle
+    real_type micro_xs(ElementDefId el, real_type costheta_limit) const
+    {
+        WentzelMicroXsCalculator calc_xs(
+            pointers_, data_, this->particle_track(), costheta_limit);
+        return calc_xs(el);
+    }
 
-        // Check conservation between primary and secondaries
-        this->check_conservation(interaction);
+    //! Screening parameter for the current particle
+    real_type screening(ElementDefId el) const
+    {
+        return detail::WentzelTableView(data_, this->particle_track())
+            .screening(el);
     }
 
   protected:
-    celeritas::WentzelInteractorPointers pointers_;
+    WentzelInteractorPointers      pointers_;
+    std::shared_ptr<WentzelParams> wentzel_;
+    WentzelParamsPointers          data_;
 };
 
 //---------------------------------------------------------------------------//
 // TESTS
 //---------------------------------------------------------------------------//
 
-TEST_F(WentzelInteractorTest, basic) {}
+TEST_F(WentzelInteractorTest, params)
+{
+    EXPECT_EQ(3, data_.num_elements());
+    EXPECT_EQ(3 * 81, data_.screening.size());
+    EXPECT_SOFT_EQ(53, data_.atomic_number[2]);
+
+    // Tabulated values match direct calculation
+    const MaterialParamsPointers mat_ptrs = this->material_params()
+                                                .host_pointers();
+    for (auto el : range<ElementDefId::value_type>(3))
+    {
+        const ElementView element(mat_ptrs, ElementDefId{el});
+        for (auto e : {0, 40, 80})
+        {
+            const MevEnergy energy{
+                std::exp(data_.log_energy.front + e * data_.log_energy.delta)};
+            const size_type row = data_.row(ElementDefId{el}, e);
+            EXPECT_SOFT_EQ(WentzelParams::screening(element, energy),
+                           data_.screening[row]);
+            EXPECT_SOFT_EQ(WentzelParams::form_factor(element, energy),
+                           data_.form_factor[row]);
+        }
+    }
+
+    // Screening is inversely proportional to p^2 at high energy, and the
+    // form factor coefficient is proportional to it
+    const ElementView iodine(mat_ptrs, ElementDefId{2});
+    EXPECT_SOFT_NEAR(100,
+                     WentzelParams::screening(iodine, MevEnergy{100})
+                         / WentzelParams::screening(iodine, MevEnergy{1000}),
+                     1e-2);
+    EXPECT_SOFT_NEAR(100,
+                     WentzelParams::form_factor(iodine, MevEnergy{1000})
+                         / WentzelParams::form_factor(iodine, MevEnergy{100}),
+                     1e-2);
+
+    // Hydrogen uses the proton charge radius
+    const ElementView hydrogen(mat_ptrs, ElementDefId{0});
+    const real_type   hbar_c = 197.3269804e-13; // MeV cm
+    const real_type   p_sq   = 100 * (100 + 2 * 0.5109989461);
+    EXPECT_SOFT_NEAR(p_sq * ipow<2>(0.84e-13 / hbar_c) / 6,
+                     WentzelParams::form_factor(hydrogen, MevEnergy{100}),
+                     1e-6);
+}
+
+TEST_F(WentzelInteractorTest, scaling)
+{
+    // Interpolation between grid points is accurate
+    const MaterialParamsPointers mat_ptrs = this->material_params()
+                                                .host_pointers();
+    const ElementView            sodium(mat_ptrs, ElementDefId{1});
+    for (real_type energy : {3.3e-3, 0.15, 4.2, 99.0})
+    {
+        this->set_inc_particle(pdg::electron(), MevEnergy{energy});
+        EXPECT_SOFT_NEAR(
+            WentzelParams::screening(sodium, MevEnergy{energy}),
+            this->screening(ElementDefId{1}),
+            1e-3)
+            << "at E=" << energy;
+    }
+
+    // A muon has the screening of an electron with the same speed, reduced
+    // by the square of the momentum ratio
+    const real_type mass_ratio = 105.6583745 / 0.5109989461;
+    this->set_inc_particle(pdg::mu_plus(), MevEnergy{1000});
+    EXPECT_SOFT_NEAR(WentzelParams::screening(
+                         sodium, MevEnergy{1000 / mass_ratio})
+                         / (mass_ratio * mass_ratio),
+                     this->screening(ElementDefId{1}),
+                     1e-3);
+    EXPECT_SOFT_NEAR(
+        WentzelParams::form_factor(sodium, MevEnergy{1000 / mass_ratio})
+            * mass_ratio * mass_ratio,
+        detail::WentzelTableView(data_, this->particle_track())
+            .form_factor(ElementDefId{1}),
+        1e-3);
+}
+
+TEST_F(WentzelInteractorTest, micro_xs)
+{
+    using constants::pi;
+    using constants::re_electron;
+
+    // Pure single scattering is the integral over all angles
+    this->set_inc_particle(pdg::electron(), MevEnergy{1});
+    const real_type mass      = 0.5109989461;
+    const real_type p_sq      = 1 * (1 + 2 * mass);
+    const real_type beta_p_sq = p_sq * p_sq / ipow<2>(1 + mass);
+    const real_type screen    = this->screening(ElementDefId{2});
+    const real_type total_xs  = 2 * pi * 53 * 54 * ipow<2>(re_electron * mass)
+                               / beta_p_sq * 2 / (screen * (2 + screen));
+    EXPECT_SOFT_EQ(total_xs, this->micro_xs(ElementDefId{2}, 1));
+
+    // The hard part of a mixed scheme is a fraction of the total
+    const real_type costheta_limit = std::cos(0.1);
+    const real_type hard_xs = this->micro_xs(ElementDefId{2}, costheta_limit);
+    EXPECT_SOFT_EQ(total_xs * screen * (1 + costheta_limit)
+                       / (2 * (1 - costheta_limit + screen)),
+                   hard_xs);
+    EXPECT_SOFT_EQ(0, this->micro_xs(ElementDefId{2}, -1));
+
+    // Positrons have the same rate; Z(Z+1) includes the atomic electrons
+    this->set_inc_particle(pdg::positron(), MevEnergy{1});
+    EXPECT_SOFT_EQ(total_xs, this->micro_xs(ElementDefId{2}, 1));
+    EXPECT_SOFT_NEAR((1 * 2) / (53 * 54.0),
+                     this->micro_xs(ElementDefId{0}, 1)
+                         / this->micro_xs(ElementDefId{2}, 1)
+                         * this->screening(ElementDefId{0})
+                         / this->screening(ElementDefId{2}),
+                     1e-2);
+
+    // Total single scattering rate depends only on the speed
+    const real_type mass_ratio = 105.6583745 / mass;
+    this->set_inc_particle(pdg::mu_minus(), MevEnergy{mass_ratio});
+    EXPECT_SOFT_NEAR(total_xs, this->micro_xs(ElementDefId{2}, 1), 1e-3);
+}
+
+TEST_F(WentzelInteractorTest, basic)
+{
+    WentzelInteractor interact   = this->make_interactor(ElementDefId{2}, 1);
+    RandomEngine&     rng_engine = this->rng();
+
+    std::vector<double> costheta;
+    for (int i = 0; i < 4; ++i)
+    {
+        Interaction result = interact(rng_engine);
+        SCOPED_TRACE(result);
+        this->sanity_check(result);
+        costheta.push_back(result.direction[2]);
+    }
+
+    // Note: these are "gold" values based on the host RNG.
+    const double expected_costheta[] = {0.999990266756393,
+                                        0.999997675629448,
+                                        0.999942391646288,
+                                        0.99999239734604};
+    EXPECT_VEC_SOFT_EQ(expected_costheta, costheta);
+}
+
+TEST_F(WentzelInteractorTest, distribution)
+{
+    // Hard collisions of a high-energy muon are suppressed by the nuclear
+    // form factor
+    this->set_inc_particle(pdg::mu_minus(), MevEnergy{1000});
+    const ElementDefId iodine{2};
+    const real_type    costheta_limit = 1 - 1e-4;
+
+    WentzelInteractor interact = this->make_interactor(iodine, costheta_limit);
+
+    const int num_samples = 20000;
+    int       num_deflect = 0;
+    real_type sum_mu      = 0;
+    for (int i = 0; i < num_samples; ++i)
+    {
+        Interaction result = interact(this->rng());
+        if (result.direction[2] < 1)
+        {
+            ++num_deflect;
+            sum_mu += 1 - result.direction[2];
+            EXPECT_LE(result.direction[2], costheta_limit * (1 + 1e-12));
+        }
+    }
+
+    // Expected acceptance: 1/(mu + 2A) is uniformly distributed
+    const detail::WentzelTableView table(data_, this->particle_track());
+    const real_type screen      = table.screening(iodine);
+    const real_type form_factor = table.form_factor(iodine);
+    const real_type beta_sq
+        = 1 - ipow<2>(105.6583745 / (1000 + 105.6583745));
+    const real_type u_lo       = 1 / (2 + screen);
+    const real_type u_hi       = 1 / (1 - costheta_limit + screen);
+    const int       num_points = 100000;
+    real_type       accept     = 0;
+    real_type       accept_mu  = 0;
+    for (int i = 0; i < num_points; ++i)
+    {
+        const real_type u    = u_lo + (i + 0.5) * (u_hi - u_lo) / num_points;
+        const real_type mu   = 1 / u - screen;
+        const real_type spin = 1 - 0.5 * beta_sq * mu;
+        const real_type g    = spin
+                            * (53 / (54 * ipow<4>(1 + form_factor * mu))
+                               + 1 / 54.0);
+        accept += g;
+        accept_mu += g * mu;
+    }
+    accept_mu /= accept;
+    accept /= num_points;
+
+    const real_type frac_deflect = real_type(num_deflect) / num_samples;
+    EXPECT_NEAR(accept, frac_deflect, 0.02);
+    EXPECT_SOFT_NEAR(accept_mu, sum_mu / num_deflect, 0.1);
+}
+
+TEST_F(WentzelInteractorTest, stress_test)
+{
+    RandomEngine&          rng_engine = this->rng();
+    std::vector<real_type> storage(3);
+
+    for (const char* mat : {"H2", "NaI"})
+    {
+        this->set_material(mat);
+        const MaterialView material = this->material_track().material_view();
+        for (auto pdg : {pdg::electron(),
+                         pdg::positron(),
+                         pdg::mu_minus(),
+                         pdg::mu_plus()})
+        {
+            for (double inc_e : {1e-3, 0.1, 10.0, 1e4, 1e8})
+            {
+                this->set_inc_particle(pdg, MevEnergy{inc_e});
+                for (real_type costheta_limit : {1.0, 0.999, 0.0})
+                {
+                    // Choose the target element by cross section
+                    WentzelMicroXsCalculator calc_xs(pointers_,
+                                                     data_,
+                                                     this->particle_track(),
+                                                     costheta_limit);
+                    ElementSelector select_el(
+                        material, calc_xs, make_span(storage));
+                    EXPECT_GT(select_el.material_micro_xs(), 0);
+
+                    for (const Real3& inc_dir : {Real3{0, 0, 1},
+                                                 Real3{1, 0, 0},
+                                                 Real3{1e-9, 0, 1},
+                                                 Real3{1, 1, 1}})
+                    {
+                        SCOPED_TRACE("Incident direction: "
+                                     + to_string(inc_dir));
+                        this->set_inc_direction(inc_dir);
+                        for (int i = 0; i < 4; ++i)
+                        {
+                            const ElementDefId el
+                                = material.elements()[select_el(rng_engine)
+                                                          .get()]
+                                      .element;
+                            WentzelInteractor interact
+                                = this->make_interactor(el, costheta_limit);
+                            Interaction result = interact(rng_engine);
+                            SCOPED_TRACE(result);
+                            this->sanity_check(result);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
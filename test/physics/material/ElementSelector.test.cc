@@ -7,10 +7,13 @@
 //---------------------------------------------------------------------------//
 #include "physics/material/ElementSelector.hh"
 
+#include <cmath>
 #include <memory>
 #include <random>
 #include "celeritas_test.hh"
 #include "base/Range.hh"
+#include "physics/material/ElementCdfParams.hh"
+#include "physics/material/ElementCdfSelector.hh"
 #include "physics/material/MaterialParams.hh"
 
 using namespace celeritas;
@@ -203,3 +206,79 @@ TEST_F(ElementSelectorTest, fancy_xs)
                        select_el.elemental_micro_xs());
     EXPECT_SOFT_EQ(0.014965228148605575, select_el.material_micro_xs());
 }
+
+//! Tabulated selection reproduces the direct calculation at grid points
+TEST_F(ElementSelectorTest, tabulated)
+{
+    // Cross section whose element weighting changes with energy
+    auto calc_micro_xs = [this](ElementDefId el_id, units::MevEnergy energy) {
+        ElementView el(host_mats, el_id);
+        return el.cbrt_z() * std::pow(energy.value(), el_id.get() * 0.5);
+    };
+
+    ElementCdfParams::Input inp;
+    inp.log_energy = {61, std::log(1e-2), std::log(10.0) / 10};
+    inp.micro_xs   = calc_micro_xs;
+    ElementCdfParams tables(*mats, inp);
+    const ElementCdfParamsPointers data = tables.host_pointers();
+    EXPECT_EQ(4, data.num_materials());
+
+    const MaterialDefId mat_id = mats->find("everything_weighted");
+    MaterialView        material(host_mats, mat_id);
+
+    for (real_type e : {1e-2, 1.0, 100.0})
+    {
+        // Direct selection
+        units::MevEnergy energy{e};
+        ElementSelector  select_direct(
+            material,
+            [&](ElementDefId el) { return calc_micro_xs(el, energy); },
+            make_span(storage));
+
+        // Tabulated selection
+        ElementCdfSelector select_el(data, mat_id, energy);
+        EXPECT_EQ(4, select_el.num_elements());
+        EXPECT_SOFT_EQ(select_direct.material_micro_xs(),
+                       select_el.material_micro_xs());
+
+        // Sampled frequencies match the exact probabilities
+        const int        num_samples = 10000;
+        std::vector<int> tally(material.num_elements(), 0);
+        for (CELER_MAYBE_UNUSED auto i : range(num_samples))
+        {
+            auto el_id = select_el(rng);
+            ASSERT_LT(el_id.get(), tally.size());
+            ++tally[el_id.get()];
+        }
+        for (auto i : range(material.num_elements()))
+        {
+            real_type expected = material.elements()[i].fraction
+                                 * select_direct.elemental_micro_xs()[i]
+                                 / select_direct.material_micro_xs();
+            EXPECT_NEAR(expected, real_type(tally[i]) / num_samples, 0.02)
+                << "at E = " << e << ", element " << i;
+        }
+    }
+
+    // Interpolation between grid points
+    ElementCdfSelector select_el(data, mat_id, units::MevEnergy{0.15});
+    EXPECT_SOFT_NEAR(
+        calc_micro_xs(ElementDefId{0}, units::MevEnergy{0.15}) * 0.48
+            + calc_micro_xs(ElementDefId{1}, units::MevEnergy{0.15}) * 0.24
+            + calc_micro_xs(ElementDefId{2}, units::MevEnergy{0.15}) * 0.16
+            + calc_micro_xs(ElementDefId{3}, units::MevEnergy{0.15}) * 0.12,
+        select_el.material_micro_xs(),
+        2e-3);
+
+    // Single element never samples
+    ElementCdfSelector select_al(data, mats->find("Al"), units::MevEnergy{1});
+    EXPECT_EQ(ElementComponentId{0}, select_al(rng));
+
+#if CELERITAS_DEBUG
+    // Vacuum has no elements to select
+    EXPECT_THROW(ElementCdfSelector(data,
+                                    mats->find("hard_vacuum"),
+                                    units::MevEnergy{1}),
+                 celeritas::DebugError);
+#endif
+}
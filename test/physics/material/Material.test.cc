@@ -5,6 +5,7 @@
 //---------------------------------------------------------------------------//
 //! \file Material.test.cc
 //---------------------------------------------------------------------------//
+#include "physics/material/ElementSelector.hh"
 #include "physics/material/ElementView.hh"
 #include "physics/material/MaterialView.hh"
 #include "physics/material/MaterialParams.hh"
@@ -15,8 +16,12 @@
 
 #include <cstring>
 #include <limits>
+#include <random>
+#include <sstream>
 #include "celeritas_test.hh"
+#include "base/Algorithms.hh"
 #include "base/DeviceVector.hh"
+#include "base/Range.hh"
 #include "physics/base/Units.hh"
 #include "physics/material/ElementDef.hh"
 #include "Material.test.hh"
@@ -79,6 +84,50 @@ TEST(MaterialUtils, radiation_length)
     EXPECT_SOFT_NEAR(5.93, calc_inv_rad_coeff(94, 244.06420), 1e-2);
 }
 
+/*!
+ * Test ionization parameters.
+ *
+ * Reference values are from the ICRU Report 37 tables and from the Sternheimer
+ * (1984) density effect parameters for aluminum (Atomic Data and Nuclear Data
+ * Tables 30, 261): plasma energy 32.86 eV, Cbar 4.24, x0 0.1708, x1 3.0127,
+ * a 0.0802, m 3.6345. The general parameterization gives slightly different
+ * values of the coefficients.
+ */
+TEST(MaterialUtils, ionization)
+{
+    using detail::calc_density_effect;
+    using detail::calc_plasma_energy;
+    using detail::get_mean_exc_energy;
+    using units::MevEnergy;
+
+    EXPECT_SOFT_EQ(19.2e-6, get_mean_exc_energy(1).value());
+    EXPECT_SOFT_EQ(166e-6, get_mean_exc_energy(13).value());
+    EXPECT_SOFT_EQ(823e-6, get_mean_exc_energy(82).value());
+    EXPECT_SOFT_EQ(966e-6, get_mean_exc_energy(98).value());
+    EXPECT_SOFT_EQ(1000e-6, get_mean_exc_energy(100).value());
+
+    // Aluminum at 2.699 g/cm^3
+    const real_type al_electron_density = 7.8346e23;
+    MevEnergy       plasma = calc_plasma_energy(al_electron_density);
+    EXPECT_SOFT_NEAR(32.86e-6, plasma.value(), 1e-3);
+
+    MatDensityEffect al = calc_density_effect(
+        get_mean_exc_energy(13), plasma, MatterState::solid);
+    EXPECT_SOFT_NEAR(4.24, al.cbar, 1e-3);
+    EXPECT_SOFT_EQ(0.2, al.x0);
+    EXPECT_SOFT_EQ(3.0, al.x1);
+    EXPECT_SOFT_EQ(3.0, al.m);
+    EXPECT_SOFT_EQ((al.cbar - 2 * std::log(10.) * al.x0) / ipow<3>(2.8),
+                   al.a);
+
+    // Same material as a gas uses the gas parameterization
+    MatDensityEffect al_gas = calc_density_effect(
+        get_mean_exc_energy(13), plasma, MatterState::gas);
+    EXPECT_SOFT_EQ(al.cbar, al_gas.cbar);
+    EXPECT_SOFT_EQ(1.6, al_gas.x0);
+    EXPECT_SOFT_EQ(4.0, al_gas.x1);
+}
+
 //---------------------------------------------------------------------------//
 // MATERIALS HOST TEST
 //---------------------------------------------------------------------------//
@@ -153,6 +202,20 @@ TEST_F(MaterialTest, material_view)
         EXPECT_SOFT_EQ(9.4365282069663997e+23, mat.electron_density());
         EXPECT_SOFT_EQ(3.5393292693170424, mat.radiation_length());
 
+        // Test ionization data
+        EXPECT_SOFT_EQ(0.00040000760709482647, mat.mean_exc_energy().value());
+        EXPECT_SOFT_EQ(std::log(mat.mean_exc_energy().value()),
+                       mat.log_mean_exc_energy());
+        MatDensityEffect de = mat.density_effect();
+        EXPECT_SOFT_EQ(5.8119645750389344, de.cbar);
+        EXPECT_SOFT_EQ(0.39470045146269261, de.x0);
+        EXPECT_SOFT_EQ(3, de.x1);
+        EXPECT_SOFT_EQ(0.22587485456941261, de.a);
+        EXPECT_SOFT_EQ(3, de.m);
+        EXPECT_SOFT_EQ(0.31451019393372365, mat.shell_correction()[0]);
+        EXPECT_SOFT_EQ(-0.0058108656295324567, mat.shell_correction()[1]);
+        EXPECT_SOFT_EQ(4.0125048657576089e-05, mat.shell_correction()[2]);
+
         // Test element view
         auto els = mat.elements();
         ASSERT_EQ(2, els.size());
@@ -171,6 +234,10 @@ TEST_F(MaterialTest, material_view)
         EXPECT_SOFT_EQ(0, mat.electron_density());
         EXPECT_SOFT_EQ(std::numeric_limits<real_type>::infinity(),
                        mat.radiation_length());
+        EXPECT_SOFT_EQ(0, mat.mean_exc_energy().value());
+        EXPECT_SOFT_EQ(0, mat.log_mean_exc_energy());
+        EXPECT_SOFT_EQ(0, mat.density_effect().cbar);
+        EXPECT_SOFT_EQ(0, mat.shell_correction()[0]);
 
         // Test element view
         auto els = mat.elements();
@@ -185,6 +252,8 @@ TEST_F(MaterialTest, material_view)
         EXPECT_SOFT_EQ(0.00017976, mat.density());
         EXPECT_SOFT_EQ(1.0739484359044669e+20, mat.electron_density());
         EXPECT_SOFT_EQ(350729.99844063615, mat.radiation_length());
+        EXPECT_SOFT_EQ(19.2e-6, mat.mean_exc_energy().value());
+        EXPECT_SOFT_EQ(8.8198194369141056, mat.density_effect().cbar);
 
         // Test element view
         auto els = mat.elements();
@@ -208,6 +277,205 @@ TEST_F(MaterialTest, element_view)
     }
 }
 
+TEST_F(MaterialTest, image)
+{
+    // Pack into a single blob and reload it at a different address
+    std::stringstream ss;
+    params->make_image().write(ss);
+    ParamsImage image = ParamsImage::read(ss);
+
+    auto ptrs = image.root<MaterialParamsPointers>();
+    ASSERT_TRUE(ptrs);
+    EXPECT_EQ(4, ptrs.elements.size());
+    EXPECT_EQ(3, ptrs.materials.size());
+    EXPECT_EQ(2, ptrs.max_element_components);
+    EXPECT_GE(ptrs.materials.data(),
+              reinterpret_cast<const MaterialDef*>(image.data().data()));
+
+    MaterialView mat(ptrs, MaterialDefId{0});
+    EXPECT_SOFT_EQ(3.6700020622594716, mat.density());
+    auto els = mat.elements();
+    ASSERT_EQ(2, els.size());
+    EXPECT_EQ(ElementDefId{3}, els[1].element);
+    EXPECT_EQ(53, ElementView(ptrs, els[1].element).atomic_number());
+}
+
+TEST(MaterialDuplicateTest, merge)
+{
+    MaterialParams::Input inp;
+    inp.elements = {
+        {11, AmuMass{22.98976928}, "Na"},
+        {53, AmuMass{126.90447}, "I"},
+        {11, AmuMass{22.98976928}, "Na_copy"},
+        {53, AmuMass{127.0}, "I_other"},
+    };
+    inp.materials = {
+        {2.948915064677e+22,
+         293.0,
+         MatterState::solid,
+         {{ElementDefId{0}, 0.5}, {ElementDefId{1}, 0.5}},
+         "NaI"},
+        // Per-volume copy referring to the aliased sodium
+        {2.948915064677e+22,
+         293.0,
+         MatterState::solid,
+         {{ElementDefId{1}, 0.5}, {ElementDefId{2}, 0.5}},
+         "NaI_vol1"},
+        // Same composition at a different temperature
+        {2.948915064677e+22,
+         100.0,
+         MatterState::solid,
+         {{ElementDefId{0}, 0.5}, {ElementDefId{1}, 0.5}},
+         "NaI_cold"},
+        // Duplicate element components are combined
+        {2.948915064677e+22,
+         293.0,
+         MatterState::solid,
+         {{ElementDefId{0}, 0.25},
+          {ElementDefId{1}, 0.5},
+          {ElementDefId{2}, 0.25}},
+         "NaI_split"},
+        // Different iodine mass
+        {2.948915064677e+22,
+         293.0,
+         MatterState::solid,
+         {{ElementDefId{0}, 0.5}, {ElementDefId{3}, 0.5}},
+         "NaI_other"},
+    };
+    MaterialParams params(inp);
+
+    // Elements
+    EXPECT_EQ(3, params.num_elements());
+    EXPECT_EQ(ElementDefId{0}, params.canonical_id(ElementDefId{0}));
+    EXPECT_EQ(ElementDefId{1}, params.canonical_id(ElementDefId{1}));
+    EXPECT_EQ(ElementDefId{0}, params.canonical_id(ElementDefId{2}));
+    EXPECT_EQ(ElementDefId{2}, params.canonical_id(ElementDefId{3}));
+    EXPECT_EQ("Na", params.id_to_label(ElementDefId{0}));
+    EXPECT_EQ("I_other", params.id_to_label(ElementDefId{2}));
+    EXPECT_EQ(ElementDefId{0}, params.find_element("Na"));
+    EXPECT_EQ(ElementDefId{1}, params.find_element("I"));
+    EXPECT_EQ(ElementDefId{0}, params.find_element("Na_copy"));
+    EXPECT_EQ(ElementDefId{2}, params.find_element("I_other"));
+    EXPECT_EQ(ElementDefId{}, params.find_element("NaI"));
+
+    // Materials
+    EXPECT_EQ(3, params.num_materials());
+    EXPECT_EQ(MaterialDefId{0}, params.canonical_id(MaterialDefId{0}));
+    EXPECT_EQ(MaterialDefId{0}, params.canonical_id(MaterialDefId{1}));
+    EXPECT_EQ(MaterialDefId{1}, params.canonical_id(MaterialDefId{2}));
+    EXPECT_EQ(MaterialDefId{0}, params.canonical_id(MaterialDefId{3}));
+    EXPECT_EQ(MaterialDefId{2}, params.canonical_id(MaterialDefId{4}));
+
+    // All names are found
+    EXPECT_EQ(MaterialDefId{0}, params.find("NaI"));
+    EXPECT_EQ(MaterialDefId{0}, params.find("NaI_vol1"));
+    EXPECT_EQ(MaterialDefId{1}, params.find("NaI_cold"));
+    EXPECT_EQ(MaterialDefId{0}, params.find("NaI_split"));
+    EXPECT_EQ(MaterialDefId{2}, params.find("NaI_other"));
+    EXPECT_EQ("NaI", params.id_to_label(MaterialDefId{0}));
+
+    // Only components of unique materials are stored
+    auto ptrs = params.host_pointers();
+    EXPECT_EQ(2, ptrs.max_element_components);
+    EXPECT_EQ(ParamsImage::padded_size<MaterialParamsPointers>(1)
+                  + ParamsImage::padded_size<ElementDef>(3)
+                  + ParamsImage::padded_size<MatElementComponent>(2 * 3)
+                  + ParamsImage::padded_size<MaterialDef>(3),
+              params.make_image().size());
+    MaterialView mat(ptrs, MaterialDefId{0});
+    ASSERT_EQ(2, mat.num_elements());
+    EXPECT_EQ(ElementDefId{0}, mat.elements()[0].element);
+    EXPECT_SOFT_EQ(0.5, mat.elements()[0].fraction);
+}
+
+TEST(MaterialDensityScaleTest, duplicated_material)
+{
+    constexpr real_type scale = 0.3;
+
+    MaterialParams::Input inp;
+    inp.elements  = {{11, AmuMass{22.98976928}, "Na"},
+                    {53, AmuMass{126.90447}, "I"}};
+    inp.materials = {
+        {2.948915064677e+22,
+         293.0,
+         MatterState::solid,
+         {{ElementDefId{0}, 0.5}, {ElementDefId{1}, 0.5}},
+         "NaI"},
+        // Explicit copy at a lower density
+        {scale * 2.948915064677e+22,
+         293.0,
+         MatterState::solid,
+         {{ElementDefId{0}, 0.5}, {ElementDefId{1}, 0.5}},
+         "NaI_foam"},
+    };
+    MaterialParams params(inp);
+    ASSERT_EQ(2, params.num_materials());
+    auto host_ptrs = params.host_pointers();
+
+    // Track in the original material at the scaled density
+    MaterialTrackState     state{MaterialDefId{0}, 1};
+    std::vector<real_type> scratch(params.max_element_components());
+    MaterialStatePointers  states;
+    states.state           = {&state, 1};
+    states.element_scratch = make_span(scratch);
+    MaterialTrackView mat_track(host_ptrs, states, ThreadId{0});
+    mat_track = MaterialTrackInitializer{MaterialDefId{0}, scale};
+    EXPECT_EQ(MaterialDefId{0}, mat_track.def_id());
+    EXPECT_SOFT_EQ(scale, mat_track.density_scale());
+    EXPECT_SOFT_EQ(std::log(scale), state.log_density_scale);
+
+    MaterialView scaled   = mat_track.material_view();
+    MaterialView expected = MaterialView(host_ptrs, MaterialDefId{1});
+    EXPECT_SOFT_EQ(expected.number_density(), scaled.number_density());
+    EXPECT_SOFT_EQ(expected.density(), scaled.density());
+    EXPECT_SOFT_EQ(expected.electron_density(), scaled.electron_density());
+    EXPECT_SOFT_EQ(expected.radiation_length(), scaled.radiation_length());
+    EXPECT_SOFT_EQ(expected.temperature(), scaled.temperature());
+    EXPECT_SOFT_EQ(expected.mean_exc_energy().value(),
+                   scaled.mean_exc_energy().value());
+    {
+        // Cbar depends only on the electron density, but the limits are
+        // shifted from the unscaled material rather than reparameterized
+        MatDensityEffect unscaled_de
+            = MaterialView(host_ptrs, MaterialDefId{0}).density_effect();
+        MatDensityEffect scaled_de = scaled.density_effect();
+        EXPECT_SOFT_EQ(expected.density_effect().cbar, scaled_de.cbar);
+        real_type x_shift = std::log(scale) / (2 * std::log(10.));
+        EXPECT_SOFT_EQ(unscaled_de.x0 - x_shift, scaled_de.x0);
+        EXPECT_SOFT_EQ(unscaled_de.x1 - x_shift, scaled_de.x1);
+        EXPECT_SOFT_EQ(unscaled_de.a, scaled_de.a);
+        EXPECT_SOFT_EQ(unscaled_de.m, scaled_de.m);
+    }
+    for (auto i : range(expected.num_elements()))
+    {
+        ElementComponentId comp{i};
+        EXPECT_SOFT_EQ(expected.get_element_density(comp),
+                       scaled.get_element_density(comp));
+    }
+
+    // Macroscopic cross sections and element selection agree
+    auto calc_micro_xs = [](ElementDefId el) -> real_type {
+        return 1.0 + 2.0 * el.get();
+    };
+    std::vector<real_type> scaled_storage(scaled.num_elements());
+    std::vector<real_type> expected_storage(expected.num_elements());
+
+    ElementSelector select_scaled(
+        scaled, calc_micro_xs, make_span(scaled_storage));
+    ElementSelector select_expected(
+        expected, calc_micro_xs, make_span(expected_storage));
+    EXPECT_SOFT_EQ(
+        select_expected.material_micro_xs() * expected.number_density(),
+        select_scaled.material_micro_xs() * scaled.number_density());
+
+    std::mt19937 rng_scaled;
+    std::mt19937 rng_expected;
+    for (int i = 0; i < 16; ++i)
+    {
+        EXPECT_EQ(select_expected(rng_expected), select_scaled(rng_scaled));
+    }
+}
+
 #if CELERITAS_USE_CUDA
 class MaterialDeviceTest : public MaterialTest
 {
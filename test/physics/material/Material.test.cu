@@ -20,13 +20,13 @@ namespace celeritas_test
 // KERNELS
 //---------------------------------------------------------------------------//
 
-__global__ void m_test_kernel(unsigned int const           size,
-                              MaterialParamsPointers const params,
-                              MaterialStatePointers const  states,
-                              const MaterialTrackState*    init,
-                              real_type*                   temperatures,
-                              real_type*                   rad_len,
-                              real_type*                   tot_z)
+__global__ void m_test_kernel(unsigned int const              size,
+                              MaterialParamsPointers const    params,
+                              MaterialStatePointers const     states,
+                              const MaterialTrackInitializer* init,
+                              real_type*                      temperatures,
+                              real_type*                      rad_len,
+                              real_type*                      tot_z)
 {
     auto tid = celeritas::KernelParamCalculator::thread_id();
     if (tid.get() >= size)
@@ -68,7 +68,7 @@ __global__ void m_test_kernel(unsigned int const           size,
 //! Run on device and return results
 MTestOutput m_test(const MTestInput& input)
 {
-    thrust::device_vector<MaterialTrackState> init = input.init;
+    thrust::device_vector<MaterialTrackInitializer> init = input.init;
     thrust::device_vector<real_type>          temperatures(input.size());
     thrust::device_vector<real_type>          rad_len(input.size());
     thrust::device_vector<real_type>          tot_z(input.size());
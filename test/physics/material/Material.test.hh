@@ -19,9 +19,9 @@ using namespace celeritas;
 //! Input data
 struct MTestInput
 {
-    MaterialParamsPointers          params;
-    MaterialStatePointers           states;
-    std::vector<MaterialTrackState> init;
+    MaterialParamsPointers                params;
+    MaterialStatePointers                 states;
+    std::vector<MaterialTrackInitializer> init;
 
     size_type size() const
     {
@@ -0,0 +1,63 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AliasDistribution.test.cc
+//---------------------------------------------------------------------------//
+#include "random/distributions/AliasDistribution.hh"
+#include "random/distributions/AliasTable.hh"
+
+#include <random>
+#include "celeritas_test.hh"
+#include "base/Range.hh"
+
+using celeritas::AliasDistribution;
+using celeritas::build_alias_table;
+using celeritas::make_span;
+using celeritas::real_type;
+using celeritas::size_type;
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(AliasDistributionTest, build)
+{
+    const real_type        weights[] = {1, 0, 3, 4};
+    std::vector<real_type> prob(4);
+    std::vector<size_type> alias(4);
+    build_alias_table(make_span(weights), make_span(prob), make_span(alias));
+
+    // Each slot holds 1/4 of the probability: recover the weights from it
+    std::vector<real_type> actual(4, 0.0);
+    for (auto i : celeritas::range(4))
+    {
+        actual[i] += prob[i] / 4;
+        actual[alias[i]] += (1 - prob[i]) / 4;
+    }
+    const double expected[] = {0.125, 0, 0.375, 0.5};
+    EXPECT_VEC_SOFT_EQ(expected, actual);
+    EXPECT_EQ(0, prob[1]);
+}
+
+TEST(AliasDistributionTest, sample)
+{
+    const real_type        weights[] = {0.5, 2, 0, 1.5, 6};
+    std::vector<real_type> prob(5);
+    std::vector<size_type> alias(5);
+    build_alias_table(make_span(weights), make_span(prob), make_span(alias));
+
+    std::mt19937      rng;
+    AliasDistribution sample_index(make_span(prob), make_span(alias));
+    std::vector<int>  counts(5, 0);
+    for (CELER_MAYBE_UNUSED auto i : celeritas::range(10000))
+    {
+        const size_type index = sample_index(rng);
+        ASSERT_LT(index, 5);
+        ++counts[index];
+    }
+    // Expected mean counts are {500, 2000, 0, 1500, 6000}
+    const int expected_counts[] = {501, 2034, 0, 1502, 5963};
+    EXPECT_VEC_EQ(expected_counts, counts);
+}
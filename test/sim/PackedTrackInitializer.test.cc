@@ -0,0 +1,96 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file PackedTrackInitializer.test.cc
+//---------------------------------------------------------------------------//
+#include "sim/TrackInitializerPointers.hh"
+
+#include <algorithm>
+#include <cmath>
+#include "celeritas_test.hh"
+#include "base/ArrayUtils.hh"
+#include "base/Constants.hh"
+#include "base/Range.hh"
+
+using namespace celeritas;
+
+namespace
+{
+//---------------------------------------------------------------------------//
+// Angle between two unit vectors
+double angle_between(const Real3& a, const Real3& b)
+{
+    return std::acos(std::min(1.0, dot_product(a, b)));
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(PackedTrackInitializerTest, size)
+{
+    EXPECT_LT(sizeof(PackedTrackInitializer), sizeof(TrackInitializer));
+}
+
+TEST(PackedTrackInitializerTest, round_trip)
+{
+    const double energies[6] = {1e-6, 1e-3, 0.511, 1.0, 123.456789, 1e5};
+    const double times[5]    = {0, 1e-12, 3.3356e-9, 1e-3, 12.5};
+
+    double max_energy_error = 0;
+    double max_time_error   = 0;
+    double max_angle        = 0;
+    for (unsigned int i : range(6u))
+    {
+        for (unsigned int j : range(5u))
+        {
+            TrackInitializer init;
+            init.sim.track_id    = TrackId{10 + i};
+            init.sim.parent_id   = TrackId{i};
+            init.sim.event_id    = EventId{j};
+            init.sim.alive       = true;
+            init.sim.time        = times[j];
+            init.geo.pos         = {1.0 / 3, -2.5e3, 1e-8 * (i + 1)};
+            init.geo.dir         = from_spherical(
+                -1 + 2.0 * (j + 0.5) / 5, 2 * constants::pi * (i + 0.25) / 6);
+            init.particle.def_id = ParticleDefId{j % 3};
+            init.particle.energy = units::MevEnergy{energies[i]};
+
+            PackedTrackInitializer packed(init);
+            TrackInitializer       result(packed);
+
+            // Identifiers and position are exact
+            EXPECT_EQ(init.sim.track_id, result.sim.track_id);
+            EXPECT_EQ(init.sim.parent_id, result.sim.parent_id);
+            EXPECT_EQ(init.sim.event_id, result.sim.event_id);
+            EXPECT_TRUE(result.sim.alive);
+            EXPECT_EQ(init.geo.pos, result.geo.pos);
+            EXPECT_EQ(init.particle.def_id, result.particle.def_id);
+
+            // Energy and time are single precision; direction is quantized
+            max_energy_error = std::max(
+                max_energy_error,
+                std::fabs(result.particle.energy.value() - energies[i])
+                    / energies[i]);
+            if (times[j] > 0)
+            {
+                max_time_error = std::max(
+                    max_time_error,
+                    std::fabs(result.sim.time - times[j]) / times[j]);
+            }
+            else
+            {
+                EXPECT_EQ(0, result.sim.time);
+            }
+            EXPECT_SOFT_EQ(1.0, norm(result.geo.dir));
+            max_angle = std::max(max_angle,
+                                 angle_between(init.geo.dir, result.geo.dir));
+        }
+    }
+    EXPECT_LE(max_energy_error, 6e-8);
+    EXPECT_LE(max_time_error, 6e-8);
+    EXPECT_LT(max_angle, 1e-4);
+}
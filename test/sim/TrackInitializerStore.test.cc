@@ -9,6 +9,9 @@
 
 #include <numeric>
 #include "celeritas_test.hh"
+#include "base/BitMaskPointers.hh"
+#include "base/DeviceVector.hh"
+#include "base/Memory.hh"
 #include "geometry/GeoParams.hh"
 #include "physics/base/SecondaryAllocatorStore.hh"
 #include "physics/base/ParticleParams.hh"
@@ -171,6 +174,47 @@ TEST_F(TrackInitTest, run)
     EXPECT_VEC_EQ(expected.track_id, output.track_id);
 }
 
+TEST_F(TrackInitTest, uninitialized_mask)
+{
+    // Track count is not a multiple of the alive mask word size
+    const size_type num_tracks = 37;
+    const size_type capacity   = 64;
+
+    // Fill a device allocation the size of the alive mask with set bits and
+    // release it, so that the store is likely to reuse the dirty memory
+    {
+        using word_type = BitMaskPointers::word_type;
+        DeviceVector<word_type> dirty(BitMaskPointers::num_words(num_tracks));
+        device_memset(dirty.device_pointers().data(),
+                      0xff,
+                      dirty.size() * sizeof(word_type));
+    }
+
+    // Allocate storage on device
+    std::vector<Primary>    primaries = generate_primaries(num_tracks);
+    StateStore              states({num_tracks, geo_params, 12345u});
+    SecondaryAllocatorStore secondaries(capacity);
+    TrackInitializerStore   track_init(num_tracks, capacity, primaries);
+
+    // Fill every slot, then kill all tracks without producing secondaries
+    track_init.extend_from_primaries();
+    track_init.initialize_tracks(states, params);
+    std::vector<size_type> alloc(num_tracks, 0);
+    std::vector<char>      alive(num_tracks, 0);
+    ITTestInput            input(alloc, alive);
+    interact(states.device_pointers(),
+             secondaries.device_pointers(),
+             input.device_pointers());
+    track_init.extend_from_secondaries(states, params);
+
+    // Every slot is vacant, and none past the end of the track vector
+    ITTestOutput output, expected;
+    output.vacancy = vacancies_test(track_init.device_pointers());
+    expected.vacancy.resize(num_tracks);
+    std::iota(expected.vacancy.begin(), expected.vacancy.end(), 0);
+    EXPECT_VEC_EQ(expected.vacancy, output.vacancy);
+}
+
 TEST_F(TrackInitTest, primaries)
 {
     const size_type num_tracks = 512;
@@ -69,13 +69,13 @@ initializers_test_kernel(TrackInitializerPointers inits, unsigned int* output)
     auto thread_id = celeritas::KernelParamCalculator::thread_id();
     if (thread_id < inits.initializers.size())
     {
-        TrackInitializer& init  = inits.initializers[thread_id.get()];
+        TrackInitializer init(inits.initializers[thread_id.get()]);
         output[thread_id.get()] = init.sim.track_id.get();
     }
 }
 
 __global__ void
-vacancies_test_kernel(TrackInitializerPointers inits, size_type* output)
+vacancies_test_kernel(TrackInitializerPointers inits, index_type* output)
 {
     auto thread_id = celeritas::KernelParamCalculator::thread_id();
     if (thread_id < inits.vacancies.size())
@@ -151,15 +151,15 @@ std::vector<unsigned int> initializers_test(TrackInitializerPointers inits)
     return host_output;
 }
 
-std::vector<size_type> vacancies_test(TrackInitializerPointers inits)
+std::vector<index_type> vacancies_test(TrackInitializerPointers inits)
 {
     // Allocate memory for results
-    std::vector<size_type> host_output(inits.vacancies.size());
+    std::vector<index_type> host_output(inits.vacancies.size());
     if (inits.vacancies.size() == 0)
     {
         return host_output;
     }
-    thrust::device_vector<size_type> output(inits.vacancies.size());
+    thrust::device_vector<index_type> output(inits.vacancies.size());
 
     // Launch a kernel to check the indices of the empty slots
     KernelParamCalculator calc_launch_params;
@@ -36,7 +36,7 @@ struct Interactor
     CELER_FUNCTION Interaction operator()()
     {
         // Create secondary particles
-        Secondary* allocated = this->allocate_secondaries(alloc_size);
+        SecondaryRecord* allocated = this->allocate_secondaries(alloc_size);
         if (!allocated)
         {
             return Interaction::from_failure();
@@ -52,11 +52,13 @@ struct Interactor
 
         // Initialize secondaries
         result.secondaries = {allocated, alloc_size};
-        for (auto& secondary : result.secondaries)
+        Secondary secondary;
+        secondary.def_id    = ParticleDefId(0);
+        secondary.energy    = units::MevEnergy(5.);
+        secondary.direction = {1., 0., 0.};
+        for (auto& record : result.secondaries)
         {
-            secondary.def_id    = ParticleDefId(0);
-            secondary.energy    = units::MevEnergy(5.);
-            secondary.direction = {1., 0., 0.};
+            record = SecondaryRecord(secondary);
         }
 
         return result;
@@ -92,7 +94,7 @@ struct ITTestOutput
 {
     std::vector<unsigned int> track_id;
     std::vector<unsigned int> initializer_id;
-    std::vector<size_type>    vacancy;
+    std::vector<index_type>   vacancy;
 };
 
 //---------------------------------------------------------------------------//
@@ -112,7 +114,7 @@ std::vector<unsigned int> initializers_test(TrackInitializerPointers inits);
 
 //---------------------------------------------------------------------------//
 //! Launch a kernel to get the indices of the vacant slots in the track vector
-std::vector<size_type> vacancies_test(TrackInitializerPointers inits);
+std::vector<index_type> vacancies_test(TrackInitializerPointers inits);
 
 //---------------------------------------------------------------------------//
 } // namespace celeritas_test
@@ -0,0 +1,387 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackingCut.test.cc
+//---------------------------------------------------------------------------//
+#include "sim/TrackingCut.hh"
+
+#include <limits>
+#include <memory>
+#include <vector>
+#include "celeritas_config.h"
+#include "celeritas_test.hh"
+#include "base/Constants.hh"
+#include "base/Range.hh"
+#include "physics/base/ParticleParams.hh"
+#include "physics/base/RegionParams.hh"
+#include "sim/TrackingCutApplier.hh"
+#include "sim/TrackingCutParams.hh"
+#include "sim/TrackingCutTallyStore.hh"
+#include "TrackingCut.test.hh"
+
+using namespace celeritas;
+using namespace celeritas_test;
+using celeritas::units::MevEnergy;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class TrackingCutTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override
+    {
+        using namespace celeritas::units;
+        constexpr auto zero   = zero_quantity();
+        constexpr auto stable = ParticleDef::stable_decay_constant();
+
+        particles = std::make_shared<ParticleParams>(ParticleParams::Input{
+            {"electron",
+             pdg::electron(),
+             MevMass{0.5109989461},
+             ElementaryCharge{-1},
+             stable},
+            {"gamma", pdg::gamma(), zero, zero, stable},
+            {"positron",
+             pdg::positron(),
+             MevMass{0.5109989461},
+             ElementaryCharge{1},
+             stable}});
+
+        // Volumes: world, detector, shield
+        RegionParams::Input region_inp;
+        region_inp.num_volumes = 3;
+        region_inp.num_models  = 1;
+        RegionParams::RegionInput shield;
+        shield.label   = "shield";
+        shield.volumes = {VolumeId{2}};
+        region_inp.regions.push_back(shield);
+        regions = std::make_shared<RegionParams>(region_inp);
+
+        inp.energy_cuts  = {{pdg::electron(), MevEnergy{0.1}},
+                           {pdg::gamma(), MevEnergy{0.01}}};
+        inp.max_time     = 1e-6 * units::second;
+        inp.kill_regions = {"shield"};
+    }
+
+    //! Add a live track
+    void add_track(ParticleDefId def_id,
+                   real_type     energy,
+                   real_type     time,
+                   VolumeId      volume)
+    {
+        ParticleTrackState particle;
+        particle.def_id = def_id;
+        particle.energy = MevEnergy{energy};
+        particle_states.push_back(particle);
+
+        SimTrackState sim;
+        sim.track_id = TrackId(sim_states.size());
+        sim.event_id = EventId{0};
+        sim.alive    = true;
+        sim.time     = time;
+        sim_states.push_back(sim);
+
+        volumes.push_back(volume);
+
+        // Track scattered during the step without losing energy
+        Interaction result;
+        result.action            = Action::scattered;
+        result.energy            = MevEnergy{energy};
+        result.direction         = {0, 0, 1};
+        result.energy_deposition = zero_quantity();
+        interactions.push_back(result);
+    }
+
+    //! Get pointers to the track states
+    TrackingCutStatePointers state_pointers()
+    {
+        TrackingCutStatePointers result;
+        result.particle.vars = make_span(particle_states);
+        result.sim.vars      = make_span(sim_states);
+        result.volume        = make_span(volumes);
+        result.interactions  = make_span(interactions);
+        return result;
+    }
+
+    std::shared_ptr<ParticleParams> particles;
+    std::shared_ptr<RegionParams>   regions;
+    TrackingCutParams::Input        inp;
+
+    std::vector<ParticleTrackState> particle_states;
+    std::vector<SimTrackState>      sim_states;
+    std::vector<VolumeId>           volumes;
+    std::vector<Interaction>        interactions;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(TrackingCutTest, params)
+{
+    TrackingCutParams   cuts(*particles, *regions, inp);
+    TrackingCutPointers ptrs = cuts.host_pointers();
+    EXPECT_VEC_SOFT_EQ((std::vector<real_type>{0.1, 0.01, 0}),
+                       std::vector<real_type>(ptrs.min_energy.begin(),
+                                              ptrs.min_energy.end()));
+    EXPECT_SOFT_EQ(1e-6, ptrs.max_time);
+    EXPECT_VEC_EQ((std::vector<char>{0, 0, 1}),
+                  std::vector<char>(ptrs.kill_volume.begin(),
+                                    ptrs.kill_volume.end()));
+
+    // Default policy kills nothing
+    TrackingCutParams defaults(
+        *particles, *regions, TrackingCutParams::Input{});
+    ptrs = defaults.host_pointers();
+    EXPECT_VEC_SOFT_EQ((std::vector<real_type>{0, 0, 0}),
+                       std::vector<real_type>(ptrs.min_energy.begin(),
+                                              ptrs.min_energy.end()));
+    EXPECT_EQ(std::numeric_limits<real_type>::infinity(), ptrs.max_time);
+    EXPECT_VEC_EQ((std::vector<char>{0, 0, 0}),
+                  std::vector<char>(ptrs.kill_volume.begin(),
+                                    ptrs.kill_volume.end()));
+}
+
+TEST_F(TrackingCutTest, errors)
+{
+    TrackingCutParams::Input bad = inp;
+    bad.kill_regions.push_back("nonexistent");
+    EXPECT_THROW(TrackingCutParams(*particles, *regions, bad),
+                 celeritas::RuntimeError);
+
+    bad = inp;
+    bad.energy_cuts.push_back({pdg::proton(), MevEnergy{1}});
+    EXPECT_THROW(TrackingCutParams(*particles, *regions, bad),
+                 celeritas::RuntimeError);
+}
+
+TEST_F(TrackingCutTest, host)
+{
+    TrackingCutParams     cuts(*particles, *regions, inp);
+    TrackingCutTallyStore tally;
+
+    const ParticleDefId electron = particles->find(pdg::electron());
+    const ParticleDefId gamma    = particles->find(pdg::gamma());
+    const ParticleDefId positron = particles->find(pdg::positron());
+
+    add_track(electron, 0.05, 0, VolumeId{1});   // Below threshold
+    add_track(gamma, 1.0, 2e-6, VolumeId{1});    // Late
+    add_track(positron, 2.0, 0, VolumeId{2});    // In shield
+    add_track(electron, 1.0, 1e-7, VolumeId{1}); // Survives
+    add_track(gamma, 0.005, 0, VolumeId{2});     // Below threshold in shield
+    add_track(positron, 0.01, 0, VolumeId{});    // Outside, no threshold
+    add_track(electron, 0.01, 0, VolumeId{0});   // Dead slot
+    sim_states.back().alive = false;
+    interactions[1].energy_deposition = MevEnergy{0.5};
+
+    apply_tracking_cuts(particles->host_pointers(),
+                        cuts.host_pointers(),
+                        this->state_pointers(),
+                        tally.host_pointers());
+
+    std::vector<int>       alive;
+    std::vector<real_type> energy;
+    std::vector<real_type> deposited;
+    for (auto i : range(sim_states.size()))
+    {
+        alive.push_back(sim_states[i].alive);
+        energy.push_back(particle_states[i].energy.value());
+        deposited.push_back(interactions[i].energy_deposition.value());
+    }
+    const int       expected_alive[]     = {0, 0, 0, 1, 0, 1, 0};
+    const real_type expected_energy[]    = {0, 0, 0, 1, 0, 0.01, 0.01};
+    const real_type expected_deposited[] = {0.05, 1.5, 2, 0, 0.005, 0, 0};
+    const Action    expected_actions[]   = {Action::cutoff_energy,
+                                       Action::cutoff_time,
+                                       Action::cutoff_region,
+                                       Action::scattered,
+                                       Action::cutoff_energy,
+                                       Action::scattered,
+                                       Action::scattered};
+    EXPECT_VEC_EQ(expected_alive, alive);
+    EXPECT_VEC_SOFT_EQ(expected_energy, energy);
+    EXPECT_VEC_SOFT_EQ(expected_deposited, deposited);
+    for (auto i : range(interactions.size()))
+    {
+        EXPECT_EQ(expected_actions[i], interactions[i].action) << "at " << i;
+    }
+    for (auto i : {0, 1, 2, 4})
+    {
+        // Killed tracks have no exiting energy
+        EXPECT_TRUE(action_killed(interactions[i].action));
+        EXPECT_EQ(0, interactions[i].energy.value()) << "at " << i;
+    }
+
+    TrackingCutTallyStore::Summary summary = tally.summary();
+    const ull_int   expected_num_tracks[]   = {2, 1, 1};
+    const real_type expected_tally_energy[] = {0.055, 1.0, 2.0};
+    EXPECT_VEC_EQ(expected_num_tracks, summary.num_tracks);
+    EXPECT_VEC_SOFT_EQ(expected_tally_energy, summary.energy);
+
+    tally.clear();
+    summary = tally.summary();
+    EXPECT_EQ(0, summary.num_tracks[0]);
+    EXPECT_EQ(0, summary.energy[0]);
+}
+
+TEST_F(TrackingCutTest, applier)
+{
+    TrackingCutParams        cuts(*particles, *regions, inp);
+    TrackingCutTallyStore    tally;
+    TrackingCutPointers      cut_ptrs   = cuts.host_pointers();
+    TrackingCutTallyPointers tally_ptrs = tally.host_pointers();
+
+    add_track(particles->find(pdg::gamma()), 0.02, 5e-6, VolumeId{2});
+    TrackingCutStatePointers states = this->state_pointers();
+
+    ParticleTrackView particle(
+        particles->host_pointers(), states.particle, ThreadId{0});
+    SimTrackView       sim(states.sim, ThreadId{0});
+    TrackingCutApplier apply_cuts(cut_ptrs, tally_ptrs);
+
+    // Time window is checked before regions
+    EXPECT_EQ(TrackingCutRule::time,
+              apply_cuts.find_rule(particle, sim, VolumeId{2}));
+    sim.time() = 0;
+    EXPECT_EQ(TrackingCutRule::region,
+              apply_cuts.find_rule(particle, sim, VolumeId{2}));
+    EXPECT_EQ(TrackingCutRule::size_,
+              apply_cuts.find_rule(particle, sim, VolumeId{1}));
+
+    Interaction& result = interactions[0];
+    EXPECT_FALSE(apply_cuts(particle, sim, VolumeId{1}, result));
+    EXPECT_TRUE(sim.alive());
+    EXPECT_EQ(Action::scattered, result.action);
+    EXPECT_SOFT_EQ(0, result.energy_deposition.value());
+    EXPECT_TRUE(apply_cuts(particle, sim, VolumeId{2}, result));
+    EXPECT_FALSE(sim.alive());
+    EXPECT_EQ(0, particle.energy().value());
+    EXPECT_EQ(Action::cutoff_region, result.action);
+    EXPECT_SOFT_EQ(0.02, result.energy_deposition.value());
+    EXPECT_EQ(1, tally.summary().num_tracks[int(TrackingCutRule::region)]);
+}
+
+TEST_F(TrackingCutTest, advance_time)
+{
+    TrackingCutParams     cuts(*particles, *regions, inp);
+    TrackingCutTallyStore tally;
+
+    // A 0.2 MeV electron travels at about 0.7c
+    add_track(particles->find(pdg::gamma()), 1.0, 0, VolumeId{1});
+    add_track(particles->find(pdg::electron()), 0.2, 0, VolumeId{1});
+    TrackingCutStatePointers states = this->state_pointers();
+
+    std::vector<int>       alive;
+    std::vector<real_type> time;
+    for (real_type step : {2.5e4, 0.5e4})
+    {
+        for (auto i : range<ThreadId::value_type>(states.size()))
+        {
+            SimTrackView sim(states.sim, ThreadId{i});
+            if (!sim.alive())
+                continue;
+            ParticleTrackView particle(
+                particles->host_pointers(), states.particle, ThreadId{i});
+            sim.advance_time(step, particle.speed());
+        }
+        apply_tracking_cuts(particles->host_pointers(),
+                            cuts.host_pointers(),
+                            states,
+                            tally.host_pointers());
+        for (const SimTrackState& sim : sim_states)
+        {
+            alive.push_back(sim.alive);
+            time.push_back(sim.time);
+        }
+    }
+
+    // The electron leaves the time window first
+    const int       expected_alive[] = {1, 0, 0, 0};
+    const real_type expected_time[]  = {2.5e4 / constants::c_light,
+                                       1.199328175305e-06,
+                                       3e4 / constants::c_light,
+                                       1.199328175305e-06};
+    EXPECT_VEC_EQ(expected_alive, alive);
+    EXPECT_VEC_SOFT_EQ(expected_time, time);
+    EXPECT_EQ(2, tally.summary().num_tracks[int(TrackingCutRule::time)]);
+}
+
+#if CELERITAS_USE_CUDA
+//---------------------------------------------------------------------------//
+// DEVICE TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(TrackingCutTest, device)
+{
+    TrackingCutParams     cuts(*particles, *regions, inp);
+    TrackingCutTallyStore tally;
+
+    const ParticleDefId electron = particles->find(pdg::electron());
+    const ParticleDefId gamma    = particles->find(pdg::gamma());
+
+    // More tracks than a warp, with some slots dead
+    for (auto i : range(40))
+    {
+        switch (i % 4)
+        {
+            case 0:
+                add_track(electron, 0.05, 0, VolumeId{1}); // Below threshold
+                break;
+            case 1:
+                add_track(gamma, 1.0, 0, VolumeId{2}); // In shield
+                break;
+            case 2:
+                add_track(gamma, 1.0, 9e-7, VolumeId{1}); // Late after step
+                break;
+            case 3:
+                add_track(electron, 1.0, 0, VolumeId{1}); // Dead slot
+                sim_states.back().alive = false;
+                break;
+        }
+    }
+
+    TCTestInput input;
+    input.particles    = particles->device_pointers();
+    input.cuts         = cuts.device_pointers();
+    input.tally        = tally.device_pointers();
+    input.particle     = particle_states;
+    input.sim          = sim_states;
+    input.volume       = volumes;
+    input.interactions = interactions;
+    input.step         = 1e4;
+
+    TCTestOutput result = tc_test(input);
+    for (auto i : range(sim_states.size()))
+    {
+        EXPECT_FALSE(result.alive[i]) << "at " << i;
+        if (i % 4 == 3)
+        {
+            // Dead tracks are untouched
+            EXPECT_EQ(0, result.time[i]);
+            EXPECT_EQ(1.0, result.energy[i]);
+            EXPECT_EQ(0, result.deposited[i]);
+            EXPECT_EQ(Action::scattered, result.action[i]);
+            continue;
+        }
+        EXPECT_EQ(0, result.energy[i]);
+        const Action expected_action[] = {
+            Action::cutoff_energy, Action::cutoff_region, Action::cutoff_time};
+        EXPECT_EQ(expected_action[i % 4], result.action[i]) << "at " << i;
+    }
+    EXPECT_SOFT_EQ(1e4 / constants::c_light, result.time[1]);
+    EXPECT_SOFT_EQ(9e-7 + 1e4 / constants::c_light, result.time[2]);
+    EXPECT_SOFT_EQ(0.05, result.deposited[0]);
+    EXPECT_SOFT_EQ(1.0, result.deposited[1]);
+    EXPECT_SOFT_EQ(1.0, result.deposited[2]);
+
+    TrackingCutTallyStore::Summary summary  = tally.summary();
+    const ull_int   expected_num_tracks[]   = {10, 10, 10};
+    const real_type expected_tally_energy[] = {0.5, 10, 10};
+    EXPECT_VEC_EQ(expected_num_tracks, summary.num_tracks);
+    EXPECT_VEC_SOFT_EQ(expected_tally_energy, summary.energy);
+}
+#endif
@@ -0,0 +1,98 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackingCut.test.cu
+//---------------------------------------------------------------------------//
+#include "sim/TrackingCut.hh"
+#include "TrackingCut.test.hh"
+
+#include <thrust/copy.h>
+#include <thrust/device_vector.h>
+#include "base/Assert.hh"
+#include "base/KernelParamCalculator.cuda.hh"
+#include "base/Range.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "sim/SimTrackView.hh"
+
+using thrust::raw_pointer_cast;
+
+namespace celeritas_test
+{
+//---------------------------------------------------------------------------//
+// KERNELS
+//---------------------------------------------------------------------------//
+
+__global__ void move_test_kernel(ParticleParamsPointers   params,
+                                 TrackingCutStatePointers states,
+                                 real_type                step)
+{
+    auto tid = celeritas::KernelParamCalculator::thread_id();
+    if (!(tid < states.size()))
+        return;
+
+    SimTrackView sim(states.sim, tid);
+    if (!sim.alive())
+        return;
+
+    ParticleTrackView particle(params, states.particle, tid);
+    sim.advance_time(step, particle.speed());
+}
+
+//---------------------------------------------------------------------------//
+// TESTING INTERFACE
+//---------------------------------------------------------------------------//
+//! Move the tracks on device and apply tracking cuts
+TCTestOutput tc_test(TCTestInput input)
+{
+    REQUIRE(input.sim.size() == input.particle.size());
+    REQUIRE(input.volume.size() == input.particle.size());
+    REQUIRE(input.interactions.size() == input.particle.size());
+
+    thrust::device_vector<ParticleTrackState> particle = input.particle;
+    thrust::device_vector<SimTrackState>      sim      = input.sim;
+    thrust::device_vector<VolumeId>           volume   = input.volume;
+    thrust::device_vector<Interaction>        interactions(input.interactions);
+
+    TrackingCutStatePointers states;
+    states.particle.vars
+        = {raw_pointer_cast(particle.data()), particle.size()};
+    states.sim.vars     = {raw_pointer_cast(sim.data()), sim.size()};
+    states.volume       = {raw_pointer_cast(volume.data()), volume.size()};
+    states.interactions = {raw_pointer_cast(interactions.data()),
+                           interactions.size()};
+
+    celeritas::KernelParamCalculator calc_launch_params;
+    auto lparams = calc_launch_params(states.size());
+    move_test_kernel<<<lparams.grid_size, lparams.block_size>>>(
+        input.particles, states, input.step);
+    CELER_CUDA_CHECK_ERROR();
+
+    device_apply_tracking_cuts(
+        input.particles, input.cuts, states, input.tally);
+    CELER_CUDA_CALL(cudaDeviceSynchronize());
+
+    std::vector<ParticleTrackState> host_particle(particle.size());
+    std::vector<SimTrackState>      host_sim(sim.size());
+    std::vector<Interaction>        host_interactions(interactions.size());
+    thrust::copy(particle.begin(), particle.end(), host_particle.begin());
+    thrust::copy(sim.begin(), sim.end(), host_sim.begin());
+    thrust::copy(
+        interactions.begin(), interactions.end(), host_interactions.begin());
+
+    TCTestOutput output;
+    for (auto i : range(host_sim.size()))
+    {
+        output.alive.push_back(host_sim[i].alive);
+        output.time.push_back(host_sim[i].time);
+        output.energy.push_back(host_particle[i].energy.value());
+        output.deposited.push_back(
+            host_interactions[i].energy_deposition.value());
+        output.action.push_back(host_interactions[i].action);
+    }
+    return output;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas_test
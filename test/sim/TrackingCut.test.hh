@@ -0,0 +1,53 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2020 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackingCut.test.hh
+//---------------------------------------------------------------------------//
+
+#include <vector>
+#include "geometry/Types.hh"
+#include "physics/base/Interaction.hh"
+#include "physics/base/ParticleParamsPointers.hh"
+#include "physics/base/ParticleStatePointers.hh"
+#include "sim/SimStatePointers.hh"
+#include "sim/TrackingCutPointers.hh"
+
+namespace celeritas_test
+{
+using namespace celeritas;
+
+//---------------------------------------------------------------------------//
+// TESTING INTERFACE
+//---------------------------------------------------------------------------//
+//! Input data
+struct TCTestInput
+{
+    ParticleParamsPointers          particles;
+    TrackingCutPointers             cuts;
+    TrackingCutTallyPointers        tally;
+    std::vector<ParticleTrackState> particle;
+    std::vector<SimTrackState>      sim;
+    std::vector<VolumeId>           volume;
+    std::vector<Interaction>        interactions;
+    real_type                       step = 0; //!< Step length of each track
+};
+
+//---------------------------------------------------------------------------//
+//! Output results
+struct TCTestOutput
+{
+    std::vector<int>       alive;
+    std::vector<real_type> time;
+    std::vector<real_type> energy;
+    std::vector<real_type> deposited;
+    std::vector<Action>    action;
+};
+
+//---------------------------------------------------------------------------//
+//! Move the tracks on device and apply tracking cuts
+TCTestOutput tc_test(TCTestInput);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas_test